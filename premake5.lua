@@ -211,6 +211,141 @@ project "game"
     -- リンカー警告を無視 (外部ライブラリPDB不足)
     linkoptions { "/ignore:4099" }
 
+--============================================================================
+-- 衝突判定ベンチマーク（ヘッドレス、Windows/Linux）
+--============================================================================
+-- ウィンドウ・D3D11なしでCollisionManagerを駆動するコマンドラインツール
+--
+-- Linux:
+--   premake5 gmake2
+--   make -C build collision_bench config=release_x64
+--   LinuxではDirectXMath（ヘッダーオンリー）とsal.hスタブが必要なため、
+--   external/DirectXMath と external/DirectX-Headers を配置すること
+project "collision_bench"
+    kind "ConsoleApp"
+    location "build/collision_bench"
+
+    targetdir (bindir .. "/%{prj.name}")
+    objdir (objdir_base .. "/%{prj.name}")
+
+    files {
+        "tools/bench/collision_bench.cpp",
+        "tools/bench/collision_bench_common.h",
+        "source/engine/c_systems/collision_world.h",
+        "source/engine/c_systems/collision_manager.h",
+        "source/engine/c_systems/collision_manager.cpp",
+        "source/engine/component/collider2d.h",
+        "source/engine/component/collider2d.cpp",
+        "source/engine/component/component_storage.h",
+        "source/engine/component/component_storage.cpp",
+        "source/engine/component/transform_hierarchy.h",
+        "source/engine/component/transform_hierarchy.cpp"
+    }
+
+    includedirs {
+        "source",
+        "source/engine",
+        "external/DirectXTK/Inc"
+    }
+
+    warnings "Extra"
+
+    filter "system:windows"
+        defines { "_WIN32_WINNT=0x0A00" }
+        buildoptions { "/utf-8", "/permissive-", "/FS" }
+
+    filter "system:linux"
+        includedirs {
+            "external/DirectXMath/Inc",
+            "external/DirectX-Headers/include/wsl/stubs"
+        }
+
+    filter {}
+
+--============================================================================
+-- 3D衝突判定ベンチマーク（ヘッドレス、Windows/Linux）
+--============================================================================
+-- 球・AABB・カプセル混在シーンでCollisionManager3Dを駆動し、
+-- SIMDナローフェーズをスカラー参照実装と照合するコマンドラインツール
+project "collision3d_bench"
+    kind "ConsoleApp"
+    location "build/collision3d_bench"
+
+    targetdir (bindir .. "/%{prj.name}")
+    objdir (objdir_base .. "/%{prj.name}")
+
+    files {
+        "tools/bench/collision3d_bench.cpp",
+        "tools/bench/collision_bench_common.h",
+        "source/engine/c_systems/collision_world.h",
+        "source/engine/c_systems/collision_manager3d.h",
+        "source/engine/c_systems/collision_manager3d.cpp",
+        "source/engine/c_systems/collision_narrowphase3d.h",
+        "source/engine/c_systems/dynamic_aabb_tree3d.h",
+        "source/engine/c_systems/dynamic_aabb_tree3d.cpp",
+        "source/engine/component/collider3d.h",
+        "source/engine/component/collider3d.cpp",
+        "source/engine/component/component_storage.h",
+        "source/engine/component/component_storage.cpp",
+        "source/engine/component/transform_hierarchy.h",
+        "source/engine/component/transform_hierarchy.cpp"
+    }
+
+    includedirs {
+        "source",
+        "source/engine",
+        "external/DirectXTK/Inc"
+    }
+
+    warnings "Extra"
+
+    filter "system:windows"
+        defines { "_WIN32_WINNT=0x0A00" }
+        buildoptions { "/utf-8", "/permissive-", "/FS" }
+
+    filter "system:linux"
+        includedirs {
+            "external/DirectXMath/Inc",
+            "external/DirectX-Headers/include/wsl/stubs"
+        }
+
+    filter {}
+
+--============================================================================
+-- イベントチャネル検証（ヘッドレス、Windows/Linux）
+--============================================================================
+-- 全ワーカーからEventChannelへイベントを投入し、配信の欠落・順序・決定性を検証する
+project "event_channel_bench"
+    kind "ConsoleApp"
+    location "build/event_channel_bench"
+
+    targetdir (bindir .. "/%{prj.name}")
+    objdir (objdir_base .. "/%{prj.name}")
+
+    files {
+        "tools/bench/event_channel_bench.cpp",
+        "source/common/utility/inline_function.h",
+        "source/engine/event/event_bus.h",
+        "source/engine/event/event_bus_stats.h",
+        "source/engine/event/event_channel.h"
+    }
+
+    includedirs {
+        "source",
+        "source/engine"
+    }
+
+    warnings "Extra"
+
+    filter "system:windows"
+        defines { "_WIN32_WINNT=0x0A00" }
+        buildoptions { "/utf-8", "/permissive-", "/FS" }
+
+    filter "system:linux"
+        links { "pthread" }
+
+    filter {}
+
 --============================================================================
 -- テスト実行ファイル (現在無効)
 --============================================================================
@@ -0,0 +1,137 @@
+//----------------------------------------------------------------------------
+//! @file   inline_function.h
+//! @brief  キャプチャを固定長バッファに直接格納する関数オブジェクト
+//!
+//! @details
+//! std::functionと異なり、容量以内のキャプチャはヒープ確保なしで保持する。
+//! 容量を超える・アラインメントが大きい・noexceptでムーブできない呼び出し
+//! 可能オブジェクトのみヒープに置く（kFitsInlineで事前に判定できる）。
+//! コピー不可・ムーブのみ可能。
+//!
+//! 使用例:
+//! @code
+//! InlineFunction<void(int), 32> fn = [this](int value) { OnValue(value); };
+//! fn(42);
+//! @endcode
+//----------------------------------------------------------------------------
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template<typename Signature, size_t Capacity = 48>
+class InlineFunction;
+
+//----------------------------------------------------------------------------
+//! @brief インラインキャプチャ関数オブジェクト
+//! @tparam R 戻り値型
+//! @tparam Args 引数型
+//! @tparam Capacity キャプチャを直接格納するバッファのバイト数
+//----------------------------------------------------------------------------
+template<typename R, typename... Args, size_t Capacity>
+class InlineFunction<R(Args...), Capacity>
+{
+public:
+    //! @brief 呼び出し可能オブジェクトFがヒープ確保なしで格納できるか
+    template<typename F>
+    static constexpr bool kFitsInline =
+        sizeof(F) <= Capacity &&
+        alignof(F) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<F>;
+
+    InlineFunction() noexcept = default;
+
+    template<typename F>
+        requires (!std::is_same_v<std::decay_t<F>, InlineFunction> &&
+                  std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+    InlineFunction(F&& fn) {  // NOLINT(google-explicit-constructor)
+        Assign(std::forward<F>(fn));
+    }
+
+    InlineFunction(InlineFunction&& other) noexcept {
+        MoveFrom(other);
+    }
+
+    InlineFunction& operator=(InlineFunction&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    InlineFunction(const InlineFunction&) = delete;
+    InlineFunction& operator=(const InlineFunction&) = delete;
+
+    ~InlineFunction() { Reset(); }
+
+    //! @brief 保持中の関数を呼び出す
+    R operator()(Args... args) const {
+        return invoke_(storage_, std::forward<Args>(args)...);
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept { return invoke_ != nullptr; }
+
+    //! @brief 保持中の関数を破棄して空にする
+    void Reset() noexcept {
+        if (manage_) {
+            manage_(storage_, nullptr);
+        }
+        invoke_ = nullptr;
+        manage_ = nullptr;
+    }
+
+private:
+    using InvokeFn = R (*)(void* storage, Args&&... args);
+    //! dstがnullptrなら破棄、非nullptrならsrcからdstへムーブしてsrcを破棄
+    using ManageFn = void (*)(void* src, void* dst) noexcept;
+
+    template<typename F>
+    void Assign(F&& fn) {
+        using Fn = std::decay_t<F>;
+        if constexpr (kFitsInline<Fn>) {
+            ::new (static_cast<void*>(storage_)) Fn(std::forward<F>(fn));
+            invoke_ = [](void* storage, Args&&... args) -> R {
+                return std::invoke(*std::launder(static_cast<Fn*>(storage)), std::forward<Args>(args)...);
+            };
+            manage_ = [](void* src, void* dst) noexcept {
+                Fn* source = std::launder(static_cast<Fn*>(src));
+                if (dst) {
+                    ::new (dst) Fn(std::move(*source));
+                }
+                source->~Fn();
+            };
+        } else {
+            // 容量超過はヒープに置き、バッファにはポインタのみ格納
+            ::new (static_cast<void*>(storage_)) Fn*(new Fn(std::forward<F>(fn)));
+            invoke_ = [](void* storage, Args&&... args) -> R {
+                return std::invoke(**std::launder(static_cast<Fn**>(storage)), std::forward<Args>(args)...);
+            };
+            manage_ = [](void* src, void* dst) noexcept {
+                Fn* heap = *std::launder(static_cast<Fn**>(src));
+                if (dst) {
+                    ::new (dst) Fn*(heap);
+                } else {
+                    delete heap;
+                }
+            };
+        }
+    }
+
+    void MoveFrom(InlineFunction& other) noexcept {
+        if (!other.manage_) return;
+        other.manage_(other.storage_, storage_);
+        invoke_ = std::exchange(other.invoke_, nullptr);
+        manage_ = std::exchange(other.manage_, nullptr);
+    }
+
+    static_assert(Capacity >= sizeof(void*), "Capacity must hold at least a pointer");
+
+    alignas(std::max_align_t) mutable std::byte storage_[Capacity];
+    InvokeFn invoke_ = nullptr;
+    ManageFn manage_ = nullptr;
+};
@@ -0,0 +1,258 @@
+//----------------------------------------------------------------------------
+//! @file   object_pool.h
+//! @brief  世代付きハンドルで参照する型別オブジェクトプール
+//!
+//! @details
+//! 固定長ブロック（BlockSize個のスロットを連続配置）単位で確保し、解放したスロットは
+//! フリーリストで再利用する。ブロックは移動しないので、生成したオブジェクトのアドレスは
+//! 解放まで変わらない（コールバックにthisを渡す既存コードがそのまま使える）。
+//! ヒープ確保はブロック追加時のみで、定常状態の生成・破棄は確保なしで済む。
+//!
+//! 所有はPoolPtr（プールへ返却するunique_ptr）、弱参照はPoolHandle（スロット番号＋世代）で行う。
+//! スロットを解放すると世代が進むため、古いハンドルのGet()はnullptrを返す。
+//!
+//! 派生型を同じプールに置く場合はSlotSize/SlotAlignを派生型の最大値にする。
+//! @code
+//!   ObjectPool<Individual, kSlotSize, kSlotAlign> pool;
+//!   PoolPtr<Elf> elf = pool.Create<Elf>("E0");
+//!   PoolHandle<Individual> handle = pool.HandleOf(elf.get());
+//!   PoolPtr<Individual> owned = std::move(elf);  // 破棄時にプールへ返却
+//! @endcode
+//!
+//! @note スレッドセーフ性: メインスレッドからのみ呼び出し可能
+//! @note プールは生成した全オブジェクトより長く生存させること
+//!       （破棄時に残っているオブジェクトはデストラクタを呼んで解放する）
+//----------------------------------------------------------------------------
+#pragma once
+
+#include "non_copyable.h"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//============================================================================
+//! @brief プールオブジェクトへの世代付きハンドル
+//============================================================================
+template<typename T>
+struct PoolHandle {
+    static constexpr uint32_t kInvalidIndex = UINT32_MAX;  //!< 無効なインデックス
+
+    uint32_t index = kInvalidIndex;  //!< スロット番号
+    uint32_t generation = 0;         //!< 世代（再利用検出用）
+
+    [[nodiscard]] bool IsValid() const noexcept {
+        return index != kInvalidIndex;
+    }
+    bool operator==(const PoolHandle& other) const noexcept {
+        return index == other.index && generation == other.generation;
+    }
+};
+
+//============================================================================
+//! @brief PoolPtr用デリーター（オブジェクトを生成元のプールへ返却する）
+//! @note 型に依存しないため、PoolPtr<Derived>からPoolPtr<Base>へ変換できる
+//============================================================================
+struct PoolDeleter {
+    using ReleaseFn = void (*)(void* pool, uint32_t index) noexcept;
+
+    ReleaseFn release = nullptr;  //!< 返却関数
+    void* pool = nullptr;         //!< 生成元プール
+    uint32_t index = 0;           //!< スロット番号
+
+    template<typename P>
+    void operator()(P* /*object*/) const noexcept {
+        if (release) {
+            release(pool, index);
+        }
+    }
+};
+
+//! @brief プールへ返却する所有ポインタ
+template<typename T>
+using PoolPtr = std::unique_ptr<T, PoolDeleter>;
+
+//============================================================================
+//! @brief プール統計
+//============================================================================
+struct PoolStats {
+    size_t live = 0;                //!< 使用中スロット数
+    size_t peak = 0;                //!< 使用中スロット数の最大値
+    size_t capacity = 0;            //!< 確保済みスロット数
+    uint64_t creates = 0;           //!< 生成回数（ResetCounters()以降）
+    uint64_t releases = 0;          //!< 解放回数（ResetCounters()以降）
+    uint64_t blockAllocations = 0;  //!< ブロック確保（ヒープ確保）回数（ResetCounters()以降）
+};
+
+//============================================================================
+//! @brief 型別オブジェクトプール
+//! @tparam T 基底型（Get()/HandleOf()の型）
+//! @tparam SlotSize 1スロットのバイト数（格納する派生型の最大サイズ）
+//! @tparam SlotAlign 1スロットのアラインメント
+//! @tparam BlockSize 1ブロックのスロット数
+//============================================================================
+template<typename T, size_t SlotSize = sizeof(T), size_t SlotAlign = alignof(T), uint32_t BlockSize = 64>
+class ObjectPool final : private NonCopyableNonMovable
+{
+    static_assert(SlotSize >= sizeof(T), "SlotSize must be at least sizeof(T)");
+    static_assert(SlotAlign >= alignof(T), "SlotAlign must be at least alignof(T)");
+
+public:
+    using Handle = PoolHandle<T>;
+
+    ObjectPool() = default;
+
+    ~ObjectPool() {
+        for (uint32_t index = 0; index < objects_.size(); ++index) {
+            if (objects_[index]) {
+                Release(index);
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------
+    //! @brief オブジェクトを生成
+    //! @tparam U 生成する型（T自身またはTの派生型）
+    //! @return 所有ポインタ（破棄時にこのプールへ返却）
+    //------------------------------------------------------------------------
+    template<typename U = T, typename... Args>
+    [[nodiscard]] PoolPtr<U> Create(Args&&... args) {
+        static_assert(std::is_base_of_v<T, U>, "U must be T or derive from T");
+        static_assert(sizeof(U) <= SlotSize, "U does not fit in the pool slot");
+        static_assert(alignof(U) <= SlotAlign, "U is over-aligned for the pool slot");
+        static_assert(std::is_same_v<T, U> || std::has_virtual_destructor_v<T>,
+                      "T must have a virtual destructor to pool derived types");
+
+        const uint32_t index = AcquireSlot();
+        U* object = nullptr;
+        try {
+            object = ::new (SlotAddress(index)) U(std::forward<Args>(args)...);
+        } catch (...) {
+            freeSlots_.push_back(index);
+            throw;
+        }
+
+        objects_[index] = object;
+        ++live_;
+        peak_ = (std::max)(peak_, live_);
+        ++creates_;
+        return PoolPtr<U>(object, PoolDeleter{ &ReleaseThunk, this, index });
+    }
+
+    //! @brief ハンドルからオブジェクトを取得
+    //! @return 解放済み・無効なハンドルならnullptr
+    [[nodiscard]] T* Get(Handle handle) const noexcept {
+        if (handle.index >= objects_.size()) return nullptr;
+        if (generations_[handle.index] != handle.generation) return nullptr;
+        return objects_[handle.index];
+    }
+
+    //! @brief オブジェクトのハンドルを取得
+    //! @return このプールのオブジェクトでなければ無効なハンドル
+    [[nodiscard]] Handle HandleOf(const T* object) const noexcept {
+        if (!object) return Handle{};
+
+        const std::byte* address = reinterpret_cast<const std::byte*>(object);
+        for (uint32_t block = 0; block < blocks_.size(); ++block) {
+            const std::byte* begin = blocks_[block]->storage;
+            if (address < begin || address >= begin + sizeof(Block::storage)) continue;
+
+            const uint32_t index = block * BlockSize +
+                static_cast<uint32_t>((address - begin) / kSlotStride);
+            if (objects_[index] == object) {
+                return Handle{ index, generations_[index] };
+            }
+            break;
+        }
+        return Handle{};
+    }
+
+    //------------------------------------------------------------------------
+    // 統計
+    //------------------------------------------------------------------------
+
+    //! @brief 統計を取得
+    [[nodiscard]] PoolStats GetStats() const noexcept {
+        PoolStats stats;
+        stats.live = live_;
+        stats.peak = peak_;
+        stats.capacity = objects_.size();
+        stats.creates = creates_;
+        stats.releases = releases_;
+        stats.blockAllocations = blockAllocations_;
+        return stats;
+    }
+
+    //! @brief 回数カウンタとピークをリセット（ピークは現在の使用数から数え直す）
+    void ResetCounters() noexcept {
+        peak_ = live_;
+        creates_ = 0;
+        releases_ = 0;
+        blockAllocations_ = 0;
+    }
+
+private:
+    //! 1スロットの間隔（各スロットの先頭がSlotAlignに揃うよう切り上げ）
+    static constexpr size_t kSlotStride = (SlotSize + SlotAlign - 1) / SlotAlign * SlotAlign;
+
+    struct Block {
+        alignas(SlotAlign) std::byte storage[kSlotStride * BlockSize];
+    };
+
+    [[nodiscard]] void* SlotAddress(uint32_t index) noexcept {
+        return blocks_[index / BlockSize]->storage + static_cast<size_t>(index % BlockSize) * kSlotStride;
+    }
+
+    [[nodiscard]] uint32_t AcquireSlot() {
+        if (freeSlots_.empty()) {
+            const uint32_t base = static_cast<uint32_t>(objects_.size());
+            blocks_.push_back(std::make_unique<Block>());
+            objects_.resize(base + BlockSize, nullptr);
+            generations_.resize(base + BlockSize, 0);
+            ++blockAllocations_;
+
+            // 若い番号から使うよう逆順に積む
+            for (uint32_t i = base + BlockSize; i > base; --i) {
+                freeSlots_.push_back(i - 1);
+            }
+        }
+
+        const uint32_t index = freeSlots_.back();
+        freeSlots_.pop_back();
+        return index;
+    }
+
+    void Release(uint32_t index) noexcept {
+        T* object = objects_[index];
+        assert(object && "ObjectPool: double release");
+
+        // 世代を先に進め、デストラクタ中のGet()では解放中のオブジェクトを返さない
+        objects_[index] = nullptr;
+        ++generations_[index];
+        object->~T();
+
+        freeSlots_.push_back(index);
+        --live_;
+        ++releases_;
+    }
+
+    static void ReleaseThunk(void* pool, uint32_t index) noexcept {
+        static_cast<ObjectPool*>(pool)->Release(index);
+    }
+
+    std::vector<std::unique_ptr<Block>> blocks_;  //!< スロットの実体（移動しない）
+    std::vector<T*> objects_;                     //!< スロット→オブジェクト（空きはnullptr）
+    std::vector<uint32_t> generations_;           //!< スロットの世代
+    std::vector<uint32_t> freeSlots_;             //!< 再利用待ちスロット
+
+    size_t live_ = 0;
+    size_t peak_ = 0;
+    uint64_t creates_ = 0;
+    uint64_t releases_ = 0;
+    uint64_t blockAllocations_ = 0;
+};
@@ -12,13 +12,20 @@
 //!       FixedUpdate()の衝突検出完了後に遅延実行されます。
 //!       これにより、コールバック内でのコライダー削除が安全に行えます。
 //!       削除されたコライダーは世代チェックによりスキップされます。
+//!
+//! @note イベントストリーム（プルAPI）:
+//!       Enter/Stay/Exitのペアイベントは種別ごとの連続配列に蓄積され、
+//!       Update()後にGetEvents()でまとめて読み出せます。
+//!       コールバックはこのストリーム上のアダプタとして発火します。
+//!
+//! @note ハンドル管理・グリッド・ペア差分・イベントは3Dと共通のCollisionWorldが担い、
+//!       このクラスは2D AABBの形状データとナローフェーズを持つ。
 //----------------------------------------------------------------------------
 #pragma once
 
-#include "common/utility/non_copyable.h"
+#include "collision_world.h"
 #include "engine/math/math_types.h"
 #include <vector>
-#include <unordered_map>
 #include <functional>
 #include <cstdint>
 #include <optional>
@@ -27,14 +34,15 @@
 
 class Collider2D;
 class GameObject;
+class Transform;
 
 //============================================================================
 // 定数定義
 //============================================================================
 namespace CollisionConstants {
-    static constexpr uint16_t kInvalidIndex = UINT16_MAX;   //!< 無効なインデックス
-    static constexpr uint8_t kDefaultLayer = 0x01;          //!< デフォルトレイヤー
-    static constexpr uint8_t kDefaultMask = 0xFF;           //!< デフォルトマスク（全レイヤーと衝突）
+    static constexpr uint16_t kInvalidIndex = CollisionWorldConstants::kInvalidIndex;  //!< 無効なインデックス
+    static constexpr uint8_t kDefaultLayer = CollisionWorldConstants::kDefaultLayer;   //!< デフォルトレイヤー
+    static constexpr uint8_t kDefaultMask = CollisionWorldConstants::kDefaultMask;     //!< デフォルトマスク（全レイヤーと衝突）
     static constexpr int kDefaultCellSize = 256;            //!< デフォルトセルサイズ
 }
 
@@ -97,27 +105,9 @@ struct AABB {
 using CollisionCallback = std::function<void(Collider2D*, Collider2D*)>;
 
 //============================================================================
-//! @brief 衝突イベント種別
-//============================================================================
-enum class CollisionEventType : uint8_t {
-    Enter,  //!< 衝突開始
-    Stay,   //!< 衝突継続
-    Exit    //!< 衝突終了
-};
-
-//============================================================================
-//! @brief キューイングされた衝突イベント
-//!
-//! コールバック発火を遅延させるためのイベント情報。
-//! 世代情報を保持し、イベント発生後に削除されたコライダーをスキップ可能。
+//! @brief 衝突ペアイベント（2D）
 //============================================================================
-struct CollisionEvent {
-    CollisionEventType type;        //!< イベント種別
-    uint16_t indexA;                //!< コライダーAのインデックス
-    uint16_t indexB;                //!< コライダーBのインデックス
-    uint16_t generationA;           //!< イベント発生時のA世代
-    uint16_t generationB;           //!< イベント発生時のB世代
-};
+using CollisionPairEvent = BasicCollisionPairEvent<ColliderHandle>;
 
 //============================================================================
 //! @brief レイキャストヒット情報
@@ -134,7 +124,7 @@ struct RaycastHit {
 //! Structure of Arrays（SoA）でデータを保持し、
 //! キャッシュ効率の良い衝突判定を行う。
 //============================================================================
-class CollisionManager final : private NonCopyableNonMovable {
+class CollisionManager final : public CollisionWorld<2, Collider2D, ColliderHandle> {
 public:
     //! @brief シングルトンインスタンス取得
     static CollisionManager& Get()
@@ -177,9 +167,6 @@ public:
     //! @brief コライダーを解除
     void Unregister(ColliderHandle handle);
 
-    //! @brief ハンドルが有効か確認
-    [[nodiscard]] bool IsValid(ColliderHandle handle) const noexcept;
-
     //! @brief 全コライダーをクリア
     void Clear();
 
@@ -190,14 +177,25 @@ public:
     void SetPosition(ColliderHandle handle, float x, float y);
     void SetSize(ColliderHandle handle, float w, float h);
     void SetOffset(ColliderHandle handle, float x, float y);
-    void SetLayer(ColliderHandle handle, uint8_t layer);
-    void SetMask(ColliderHandle handle, uint8_t mask);
-    void SetEnabled(ColliderHandle handle, bool enabled);
-    void SetTrigger(ColliderHandle handle, bool trigger);
 
-    void SetOnCollision(ColliderHandle handle, CollisionCallback cb);
-    void SetOnCollisionEnter(ColliderHandle handle, CollisionCallback cb);
-    void SetOnCollisionExit(ColliderHandle handle, CollisionCallback cb);
+    //------------------------------------------------------------------------
+    // Transform同期（一括）
+    //------------------------------------------------------------------------
+
+    //! @brief 位置を同期するTransformを設定
+    //! @param handle コライダーハンドル
+    //! @param transform 同期元（nullptrで同期解除）
+    //! @note 設定時に即座に位置を反映する。以降はSyncTransforms()で一括同期。
+    void SetSyncTransform(ColliderHandle handle, Transform* transform);
+
+    //! @brief 位置を同期するTransformを取得
+    //! @return 同期元（手動設定または無効なハンドルならnullptr）
+    [[nodiscard]] Transform* GetSyncTransform(ColliderHandle handle) const;
+
+    //! @brief 同期対象の全コライダーにTransformのワールド位置を反映
+    //! @note Update()の先頭で自動的に呼ばれる。
+    //!       変更スタンプが前回同期時から変わったTransformのみ読み書きする。
+    void SyncTransforms();
 
     //------------------------------------------------------------------------
     // データ取得
@@ -206,11 +204,9 @@ public:
     [[nodiscard]] AABB GetAABB(ColliderHandle handle) const;
     [[nodiscard]] Vector2 GetSize(ColliderHandle handle) const;
     [[nodiscard]] Vector2 GetOffset(ColliderHandle handle) const;
-    [[nodiscard]] uint8_t GetLayer(ColliderHandle handle) const;
-    [[nodiscard]] uint8_t GetMask(ColliderHandle handle) const;
-    [[nodiscard]] bool IsEnabled(ColliderHandle handle) const;
-    [[nodiscard]] bool IsTrigger(ColliderHandle handle) const;
-    [[nodiscard]] Collider2D* GetCollider(ColliderHandle handle) const;
+
+    //! @brief 前回の固定ステップ以降に位置が変化したか
+    [[nodiscard]] bool HasMoved(ColliderHandle handle) const;
 
     //------------------------------------------------------------------------
     // 更新
@@ -220,9 +216,6 @@ public:
     //! @param deltaTime フレームの経過時間
     void Update(float deltaTime);
 
-    //! @brief 固定タイムステップの間隔を取得
-    [[nodiscard]] static constexpr float GetFixedDeltaTime() noexcept { return kFixedDeltaTime; }
-
     //------------------------------------------------------------------------
     // 設定・統計
     //------------------------------------------------------------------------
@@ -230,8 +223,6 @@ public:
     void SetCellSize(int size) noexcept {
         cellSize_ = size > 0 ? size : CollisionConstants::kDefaultCellSize;
     }
-    [[nodiscard]] int GetCellSize() const noexcept { return cellSize_; }
-    [[nodiscard]] size_t GetColliderCount() const noexcept { return activeCount_; }
 
     //------------------------------------------------------------------------
     // クエリ
@@ -264,114 +255,54 @@ public:
         uint8_t layerMask = CollisionConstants::kDefaultMask);
 
 private:
-    CollisionManager() = default;
-    CollisionManager(const CollisionManager&) = delete;
-    CollisionManager& operator=(const CollisionManager&) = delete;
+    CollisionManager() { cellSize_ = CollisionConstants::kDefaultCellSize; }
 
     static inline std::unique_ptr<CollisionManager> instance_ = nullptr;
 
     //! @brief 固定タイムステップの衝突判定（内部用）
     void FixedUpdate();
 
-    //! @brief キューイングされたイベントを処理
-    //! @note FixedUpdate()終了後に呼び出される。世代チェックにより
-    //!       コールバック中に削除されたコライダーは安全にスキップされる。
-    void ProcessEventQueue();
-
-    //------------------------------------------------------------------------
-    // インデックス管理
-    //------------------------------------------------------------------------
-
-    [[nodiscard]] uint16_t AllocateIndex();
-    void FreeIndex(uint16_t index);
-
-    [[nodiscard]] static uint32_t MakePairKey(uint16_t a, uint16_t b) noexcept {
-        if (a > b) { uint16_t t = a; a = b; b = t; }
-        return (static_cast<uint32_t>(a) << 16) | b;
-    }
-    [[nodiscard]] static uint16_t GetFirstIndex(uint32_t key) noexcept {
-        return static_cast<uint16_t>(key >> 16);
-    }
-    [[nodiscard]] static uint16_t GetSecondIndex(uint32_t key) noexcept {
-        return static_cast<uint16_t>(key & 0xFFFF);
-    }
-
     //------------------------------------------------------------------------
     // グリッド
     //------------------------------------------------------------------------
 
-    struct Cell {
-        int x, y;
-        bool operator==(const Cell& other) const noexcept {
-            return x == other.x && y == other.y;
-        }
-    };
-
-    struct CellHash {
-        size_t operator()(const Cell& c) const noexcept {
-            // 負の座標を正しく処理するハッシュ関数
-            auto h1 = std::hash<int>{}(c.x);
-            auto h2 = std::hash<int>{}(c.y);
-            return h1 ^ (h2 * 0x9e3779b9 + (h1 << 6) + (h1 >> 2));
-        }
-    };
-
     [[nodiscard]] Cell ToCell(float x, float y) const noexcept;
     void RebuildGrid();
 
+    //! @brief 線分が通過するセルを始点側から順に列挙
+    //! @param visit bool(const std::vector<uint16_t>& indices, float tExit)
+    //!        tExitはセルを出る線分パラメータ（0〜1）。falseで打ち切り
+    template<typename Visitor>
+    void TraverseSegment(const Vector2& start, const Vector2& end, Visitor&& visit) const {
+        const float origin[2] = { start.x, start.y };
+        const float dir[2] = { end.x - start.x, end.y - start.y };
+        TraverseGrid(origin, dir, 1.0f, visit);
+    }
+
+    //! @brief 線分とコライダーAABBの交差判定（Liang-Barsky）
+    //! @param[out] outT 進入位置の線分パラメータ（0〜1）
+    [[nodiscard]] bool IntersectSegment(uint16_t idx, const Vector2& start,
+                                        float dx, float dy, float& outT) const noexcept;
+
     //------------------------------------------------------------------------
     // Structure of Arrays（SoA）- コライダーデータ
     //------------------------------------------------------------------------
 
     // ホットデータ（毎フレームアクセス）- 連続配置でキャッシュ効率化
+    // レイヤー・マスク・フラグ・コールバック等はCollisionWorldが保持
     std::vector<float> posX_;           //!< ワールド位置X
     std::vector<float> posY_;           //!< ワールド位置Y
     std::vector<float> halfW_;          //!< 半幅
     std::vector<float> halfH_;          //!< 半高さ
-    std::vector<uint8_t> layer_;        //!< レイヤー
-    std::vector<uint8_t> mask_;         //!< マスク
-    std::vector<uint8_t> flags_;        //!< enabled(bit0), trigger(bit1)
 
     // ウォームデータ（登録時・イベント時）
     std::vector<float> offsetX_;        //!< オフセットX
     std::vector<float> offsetY_;        //!< オフセットY
     std::vector<float> sizeW_;          //!< 元サイズ幅
     std::vector<float> sizeH_;          //!< 元サイズ高さ
+    std::vector<Transform*> syncTransforms_;  //!< 位置同期元（nullptrなら手動設定）
+    std::vector<uint64_t> syncStamps_;        //!< 前回同期時の変更スタンプ
 
-    // コールドデータ（イベント発火時のみ）
-    std::vector<Collider2D*> colliders_;           //!< Collider2Dへの参照
-    std::vector<CollisionCallback> onCollision_;
-    std::vector<CollisionCallback> onEnter_;
-    std::vector<CollisionCallback> onExit_;
-
-    // 世代管理（ハンドル有効性チェック用）
-    std::vector<uint16_t> generations_;
-
-    // フリーリスト
-    std::vector<uint16_t> freeIndices_;
-    size_t activeCount_ = 0;
-
-    // 空間ハッシュグリッド
-    int cellSize_ = CollisionConstants::kDefaultCellSize;
-    std::unordered_map<Cell, std::vector<uint16_t>, CellHash> grid_;
-
-    // 衝突ペア（ソート済み）
-    std::vector<uint32_t> previousPairs_;
-    std::vector<uint32_t> currentPairs_;
-    std::vector<uint32_t> testedPairs_;
-
-    // フラグビット定義
-    static constexpr uint8_t kFlagEnabled = 0x01;
-    static constexpr uint8_t kFlagTrigger = 0x02;
-
-    // 固定タイムステップ
-    static constexpr float kFixedDeltaTime = 1.0f / 60.0f;  //!< 60Hz
-    float accumulator_ = 0.0f;
-
-    // クエリ用バッファ（再利用でアロケーション削減）
-    mutable std::vector<uint16_t> queryBuffer_;
-
-    // 遅延イベントキュー（コールバックを衝突検出完了後に発火）
-    std::vector<CollisionEvent> eventQueue_;
-    bool processingEvents_ = false;  //!< 再入防止フラグ
+    // フラグビット定義（bit0/bit1はCollisionWorld）
+    static constexpr uint8_t kFlagMoved = 0x04;     //!< 前回の固定ステップ以降に移動した
 };
@@ -3,19 +3,103 @@
 //! @brief  3D衝突判定マネージャー実装
 //----------------------------------------------------------------------------
 #include "collision_manager3d.h"
+#include "dynamic_aabb_tree3d.h"
 #include "engine/component/collider3d.h"
 #include <algorithm>
 #include <cmath>
 
 namespace {
     constexpr size_t kInitialCapacity = 256;
+
+    //! @brief レイ vs 球（近い方の交点、t >= 0のみ）
+    bool IntersectRaySphere(const Vector3& origin, const Vector3& dir,
+                            const Vector3& center, float r, float& outT)
+    {
+        Vector3 oc = origin - center;
+        float a = dir.Dot(dir);
+        float b = 2.0f * oc.Dot(dir);
+        float c = oc.Dot(oc) - r * r;
+        float discriminant = b * b - 4 * a * c;
+        if (discriminant < 0) return false;
+
+        float t = (-b - std::sqrt(discriminant)) / (2.0f * a);
+        if (t < 0) return false;
+        outT = t;
+        return true;
+    }
+
+    //! @brief レイ vs Y軸カプセル（側面の円柱と両端の半球を個別に判定）
+    bool IntersectRayCapsule(const Vector3& origin, const Vector3& dir,
+                             const Narrowphase3D::Capsule& capsule,
+                             float& outT, Vector3& outNormal)
+    {
+        bool hit = false;
+        float bestT = 0.0f;
+        float r = capsule.radius;
+
+        // 側面（無限円柱をXZ平面で解き、Y範囲で切り取る）
+        float ox = origin.x - capsule.x;
+        float oz = origin.z - capsule.z;
+        float a = dir.x * dir.x + dir.z * dir.z;
+        if (a > 0.000001f) {
+            float b = 2.0f * (ox * dir.x + oz * dir.z);
+            float c = ox * ox + oz * oz - r * r;
+            float discriminant = b * b - 4 * a * c;
+            if (discriminant >= 0) {
+                float t = (-b - std::sqrt(discriminant)) / (2.0f * a);
+                float y = origin.y + dir.y * t;
+                if (t >= 0 &&
+                    y >= capsule.y - capsule.halfHeight &&
+                    y <= capsule.y + capsule.halfHeight) {
+                    hit = true;
+                    bestT = t;
+                    outNormal = Vector3(ox + dir.x * t, 0.0f, oz + dir.z * t);
+                }
+            }
+        }
+
+        // 両端の半球
+        for (float sign : { -1.0f, 1.0f }) {
+            Vector3 cap(capsule.x, capsule.y + sign * capsule.halfHeight, capsule.z);
+            float t;
+            if (IntersectRaySphere(origin, dir, cap, r, t) && (!hit || t < bestT)) {
+                hit = true;
+                bestT = t;
+                outNormal = origin + dir * t - cap;
+            }
+        }
+
+        if (!hit) return false;
+        outT = bestT;
+        outNormal.Normalize();
+        return true;
+    }
+}
+
+//----------------------------------------------------------------------------
+CollisionManager3D::CollisionManager3D()
+{
+    cellSize_ = CollisionConstants3D::kDefaultCellSize;
 }
 
+CollisionManager3D::~CollisionManager3D() = default;
+
 //----------------------------------------------------------------------------
-void CollisionManager3D::Initialize(int cellSize)
+void CollisionManager3D::Initialize(int cellSize, Broadphase3D broadphase)
 {
     cellSize_ = cellSize > 0 ? cellSize : CollisionConstants3D::kDefaultCellSize;
 
+    // ブロードフェーズ切り替え（ツリーのプロキシは次の固定ステップで作成）
+    broadphase_ = broadphase;
+    if (broadphase_ == Broadphase3D::DynamicTree) {
+        if (!tree_) {
+            tree_ = std::make_unique<DynamicAABBTree3D>(CollisionConstants3D::kDefaultTreeMargin);
+        }
+    } else {
+        tree_.reset();
+        std::fill(proxyIds_.begin(), proxyIds_.end(), DynamicAABBTree3D::kNullNode);
+    }
+
     // 配列を初期容量で確保
     posX_.reserve(kInitialCapacity);
     posY_.reserve(kInitialCapacity);
@@ -24,6 +108,7 @@ void CollisionManager3D::Initialize(int cellSize)
     halfH_.reserve(kInitialCapacity);
     halfD_.reserve(kInitialCapacity);
     radius_.reserve(kInitialCapacity);
+    capsuleHalfHeight_.reserve(kInitialCapacity);
     shape_.reserve(kInitialCapacity);
     layer_.reserve(kInitialCapacity);
     mask_.reserve(kInitialCapacity);
@@ -39,32 +124,39 @@ void CollisionManager3D::Initialize(int cellSize)
     onEnter_.reserve(kInitialCapacity);
     onExit_.reserve(kInitialCapacity);
     generations_.reserve(kInitialCapacity);
+    proxyIds_.reserve(kInitialCapacity);
 }
 
 //----------------------------------------------------------------------------
 void CollisionManager3D::Shutdown()
 {
     Clear();
-    grid_.clear();
-    previousPairs_.clear();
-    currentPairs_.clear();
-    testedPairs_.clear();
+    sphereSpherePairs_.clear();
+    sphereBoxPairs_.clear();
 }
 
 //----------------------------------------------------------------------------
 Collider3DHandle CollisionManager3D::Register(Collider3D* collider, ColliderShape3D shape)
 {
-    uint16_t index = AllocateIndex();
-    Collider3DHandle handle;
-    handle.index = index;
-    handle.generation = generations_[index];
+    if (!collider) return Collider3DHandle{};
+
+    uint16_t index = AllocateSlot(collider);
+    if (index == CollisionConstants3D::kInvalidIndex) return Collider3DHandle{};
+
+    // 新しいスロットなら形状データを追加
+    if (posX_.size() < GetSlotCount()) {
+        posX_.push_back(0); posY_.push_back(0); posZ_.push_back(0);
+        halfW_.push_back(0); halfH_.push_back(0); halfD_.push_back(0);
+        radius_.push_back(0);
+        capsuleHalfHeight_.push_back(0);
+        shape_.push_back(0);
+        offsetX_.push_back(0); offsetY_.push_back(0); offsetZ_.push_back(0);
+        sizeW_.push_back(0); sizeH_.push_back(0); sizeD_.push_back(0);
+        proxyIds_.push_back(DynamicAABBTree3D::kNullNode);
+    }
 
-    colliders_[index] = collider;
     shape_[index] = static_cast<uint8_t>(shape);
-    flags_[index] = kFlagEnabled;
-
-    ++activeCount_;
-    return handle;
+    return MakeHandle(index);
 }
 
 //----------------------------------------------------------------------------
@@ -73,22 +165,12 @@ void CollisionManager3D::Unregister(Collider3DHandle handle)
     if (!IsValid(handle)) return;
 
     uint16_t index = handle.index;
-    colliders_[index] = nullptr;
-    onCollision_[index] = nullptr;
-    onEnter_[index] = nullptr;
-    onExit_[index] = nullptr;
-    flags_[index] = 0;
-
-    FreeIndex(index);
-    --activeCount_;
-}
+    if (tree_ && proxyIds_[index] != DynamicAABBTree3D::kNullNode) {
+        tree_->DestroyProxy(proxyIds_[index]);
+        proxyIds_[index] = DynamicAABBTree3D::kNullNode;
+    }
 
-//----------------------------------------------------------------------------
-bool CollisionManager3D::IsValid(Collider3DHandle handle) const noexcept
-{
-    if (!handle.IsValid()) return false;
-    if (handle.index >= generations_.size()) return false;
-    return generations_[handle.index] == handle.generation;
+    FreeSlot(index);
 }
 
 //----------------------------------------------------------------------------
@@ -97,58 +179,15 @@ void CollisionManager3D::Clear()
     posX_.clear(); posY_.clear(); posZ_.clear();
     halfW_.clear(); halfH_.clear(); halfD_.clear();
     radius_.clear();
+    capsuleHalfHeight_.clear();
     shape_.clear();
-    layer_.clear(); mask_.clear(); flags_.clear();
     offsetX_.clear(); offsetY_.clear(); offsetZ_.clear();
     sizeW_.clear(); sizeH_.clear(); sizeD_.clear();
-    colliders_.clear();
-    onCollision_.clear(); onEnter_.clear(); onExit_.clear();
-    generations_.clear();
-    freeIndices_.clear();
-    activeCount_ = 0;
-    grid_.clear();
-}
-
-//----------------------------------------------------------------------------
-uint16_t CollisionManager3D::AllocateIndex()
-{
-    if (!freeIndices_.empty()) {
-        uint16_t index = freeIndices_.back();
-        freeIndices_.pop_back();
-        return index;
+    proxyIds_.clear();
+    if (tree_) {
+        tree_->Clear();
     }
-
-    // オーバーフローチェック
-    if (colliders_.size() >= UINT16_MAX) {
-        assert(false && "Collider index overflow: too many colliders");
-        return CollisionConstants3D::kInvalidIndex;
-    }
-
-    // 新しいスロットを追加
-    uint16_t index = static_cast<uint16_t>(colliders_.size());
-    posX_.push_back(0); posY_.push_back(0); posZ_.push_back(0);
-    halfW_.push_back(0); halfH_.push_back(0); halfD_.push_back(0);
-    radius_.push_back(0);
-    shape_.push_back(0);
-    layer_.push_back(CollisionConstants3D::kDefaultLayer);
-    mask_.push_back(CollisionConstants3D::kDefaultMask);
-    flags_.push_back(0);
-    offsetX_.push_back(0); offsetY_.push_back(0); offsetZ_.push_back(0);
-    sizeW_.push_back(0); sizeH_.push_back(0); sizeD_.push_back(0);
-    colliders_.push_back(nullptr);
-    onCollision_.push_back(nullptr);
-    onEnter_.push_back(nullptr);
-    onExit_.push_back(nullptr);
-    generations_.push_back(0);
-
-    return index;
-}
-
-//----------------------------------------------------------------------------
-void CollisionManager3D::FreeIndex(uint16_t index)
-{
-    ++generations_[index];
-    freeIndices_.push_back(index);
+    ClearWorld();
 }
 
 //----------------------------------------------------------------------------
@@ -182,85 +221,27 @@ void CollisionManager3D::SetSphereRadius(Collider3DHandle handle, float r)
 }
 
 //----------------------------------------------------------------------------
-void CollisionManager3D::SetOffset(Collider3DHandle handle, const Vector3& offset)
-{
-    if (!IsValid(handle)) return;
-    uint16_t i = handle.index;
-    offsetX_[i] = offset.x;
-    offsetY_[i] = offset.y;
-    offsetZ_[i] = offset.z;
-}
-
-//----------------------------------------------------------------------------
-void CollisionManager3D::SetLayer(Collider3DHandle handle, uint8_t layer)
-{
-    if (!IsValid(handle)) return;
-    layer_[handle.index] = layer;
-}
-
-//----------------------------------------------------------------------------
-void CollisionManager3D::SetMask(Collider3DHandle handle, uint8_t mask)
-{
-    if (!IsValid(handle)) return;
-    mask_[handle.index] = mask;
-}
-
-//----------------------------------------------------------------------------
-void CollisionManager3D::SetEnabled(Collider3DHandle handle, bool enabled)
-{
-    if (!IsValid(handle)) return;
-    if (enabled) {
-        flags_[handle.index] |= kFlagEnabled;
-    } else {
-        flags_[handle.index] &= ~kFlagEnabled;
-    }
-}
-
-//----------------------------------------------------------------------------
-void CollisionManager3D::SetTrigger(Collider3DHandle handle, bool trigger)
-{
-    if (!IsValid(handle)) return;
-    if (trigger) {
-        flags_[handle.index] |= kFlagTrigger;
-    } else {
-        flags_[handle.index] &= ~kFlagTrigger;
-    }
-}
-
-//----------------------------------------------------------------------------
-void CollisionManager3D::SetOnCollision(Collider3DHandle handle, CollisionCallback3D cb)
+void CollisionManager3D::SetCapsuleHalfHeight(Collider3DHandle handle, float halfHeight)
 {
     if (!IsValid(handle)) return;
-    onCollision_[handle.index] = std::move(cb);
+    capsuleHalfHeight_[handle.index] = halfHeight > 0.0f ? halfHeight : 0.0f;
 }
 
 //----------------------------------------------------------------------------
-void CollisionManager3D::SetOnCollisionEnter(Collider3DHandle handle, CollisionCallback3D cb)
-{
-    if (!IsValid(handle)) return;
-    onEnter_[handle.index] = std::move(cb);
-}
-
-//----------------------------------------------------------------------------
-void CollisionManager3D::SetOnCollisionExit(Collider3DHandle handle, CollisionCallback3D cb)
+void CollisionManager3D::SetOffset(Collider3DHandle handle, const Vector3& offset)
 {
     if (!IsValid(handle)) return;
-    onExit_[handle.index] = std::move(cb);
+    uint16_t i = handle.index;
+    offsetX_[i] = offset.x;
+    offsetY_[i] = offset.y;
+    offsetZ_[i] = offset.z;
 }
 
 //----------------------------------------------------------------------------
 AABB3D CollisionManager3D::GetAABB(Collider3DHandle handle) const
 {
     if (!IsValid(handle)) return AABB3D();
-    uint16_t i = handle.index;
-    AABB3D aabb;
-    aabb.minX = posX_[i] - halfW_[i];
-    aabb.minY = posY_[i] - halfH_[i];
-    aabb.minZ = posZ_[i] - halfD_[i];
-    aabb.maxX = posX_[i] + halfW_[i];
-    aabb.maxY = posY_[i] + halfH_[i];
-    aabb.maxZ = posZ_[i] + halfD_[i];
-    return aabb;
+    return GetBounds(handle.index);
 }
 
 //----------------------------------------------------------------------------
@@ -286,6 +267,13 @@ float CollisionManager3D::GetRadius(Collider3DHandle handle) const
     return radius_[handle.index];
 }
 
+//----------------------------------------------------------------------------
+float CollisionManager3D::GetCapsuleHalfHeight(Collider3DHandle handle) const
+{
+    if (!IsValid(handle)) return 0.0f;
+    return capsuleHalfHeight_[handle.index];
+}
+
 //----------------------------------------------------------------------------
 Vector3 CollisionManager3D::GetOffset(Collider3DHandle handle) const
 {
@@ -295,266 +283,299 @@ Vector3 CollisionManager3D::GetOffset(Collider3DHandle handle) const
 }
 
 //----------------------------------------------------------------------------
-uint8_t CollisionManager3D::GetLayer(Collider3DHandle handle) const
+ColliderShape3D CollisionManager3D::GetShape(Collider3DHandle handle) const
 {
-    if (!IsValid(handle)) return 0;
-    return layer_[handle.index];
+    if (!IsValid(handle)) return ColliderShape3D::AABB;
+    return static_cast<ColliderShape3D>(shape_[handle.index]);
 }
 
 //----------------------------------------------------------------------------
-uint8_t CollisionManager3D::GetMask(Collider3DHandle handle) const
+void CollisionManager3D::Update(float deltaTime)
 {
-    if (!IsValid(handle)) return 0;
-    return mask_[handle.index];
+    AdvanceFixedSteps(deltaTime, [this] { FixedUpdate(); });
 }
 
 //----------------------------------------------------------------------------
-bool CollisionManager3D::IsEnabled(Collider3DHandle handle) const
+void CollisionManager3D::FixedUpdate()
 {
-    if (!IsValid(handle)) return false;
-    return (flags_[handle.index] & kFlagEnabled) != 0;
-}
+    BeginStep();
 
-//----------------------------------------------------------------------------
-bool CollisionManager3D::IsTrigger(Collider3DHandle handle) const
-{
-    if (!IsValid(handle)) return false;
-    return (flags_[handle.index] & kFlagTrigger) != 0;
+    // ブロードフェーズ（候補ペアは昇順・重複なしで得られる）
+    if (broadphase_ == Broadphase3D::DynamicTree) {
+        UpdateTree();
+        CollectCandidatePairsTree();
+    } else {
+        RebuildGrid();
+        CollectCandidatePairsGrid();
+    }
+
+    // 形状別の交差判定
+    RunNarrowphase();
+
+    // Enter/Stay/Exitをストリームへ追加し、コールバックへ配信
+    // （バッチ判定でヒット順が前後するためEndStep()内でソートされる）
+    EndStep();
 }
 
 //----------------------------------------------------------------------------
-ColliderShape3D CollisionManager3D::GetShape(Collider3DHandle handle) const
+void CollisionManager3D::CollectCandidatePairsGrid()
 {
-    if (!IsValid(handle)) return ColliderShape3D::AABB;
-    return static_cast<ColliderShape3D>(shape_[handle.index]);
+    CollectGridPairs([this](uint16_t idxA, uint16_t idxB) {
+        // レイヤーマスクチェック
+        return (layer_[idxA] & mask_[idxB]) != 0 &&
+               (layer_[idxB] & mask_[idxA]) != 0;
+    }, candidatePairs_);
 }
 
 //----------------------------------------------------------------------------
-Collider3D* CollisionManager3D::GetCollider(Collider3DHandle handle) const
+void CollisionManager3D::UpdateTree()
 {
-    if (!IsValid(handle)) return nullptr;
-    return colliders_[handle.index];
+    size_t count = flags_.size();
+    for (size_t i = 0; i < count; ++i) {
+        int32_t& proxyId = proxyIds_[i];
+        bool active = IsActiveSlot(i);
+
+        if (!active) {
+            if (proxyId != DynamicAABBTree3D::kNullNode) {
+                tree_->DestroyProxy(proxyId);
+                proxyId = DynamicAABBTree3D::kNullNode;
+            }
+            continue;
+        }
+
+        AABB3D bounds = GetBounds(static_cast<uint16_t>(i));
+        if (proxyId == DynamicAABBTree3D::kNullNode) {
+            proxyId = tree_->CreateProxy(bounds, static_cast<uint16_t>(i));
+        } else {
+            tree_->MoveProxy(proxyId, bounds);
+        }
+    }
 }
 
 //----------------------------------------------------------------------------
-void CollisionManager3D::Update(float deltaTime)
+void CollisionManager3D::CollectCandidatePairsTree()
 {
-    accumulator_ += deltaTime;
-    while (accumulator_ >= kFixedDeltaTime) {
-        FixedUpdate();
-        accumulator_ -= kFixedDeltaTime;
+    size_t count = proxyIds_.size();
+    for (size_t i = 0; i < count; ++i) {
+        if (proxyIds_[i] == DynamicAABBTree3D::kNullNode) continue;
+
+        uint16_t idxA = static_cast<uint16_t>(i);
+        tree_->Query(GetBounds(idxA), [&](uint16_t idxB) {
+            // 各ペアを小さいインデックス側からだけ拾う
+            if (idxB <= idxA) return true;
+            if ((layer_[idxA] & mask_[idxB]) == 0 ||
+                (layer_[idxB] & mask_[idxA]) == 0) {
+                return true;
+            }
+            candidatePairs_.push_back(MakePairKey(idxA, idxB));
+            return true;
+        });
     }
+
+    // ナローフェーズのバッチ構成をグリッドと揃えるため昇順に並べる
+    std::sort(candidatePairs_.begin(), candidatePairs_.end());
 }
 
 //----------------------------------------------------------------------------
-void CollisionManager3D::FixedUpdate()
+void CollisionManager3D::RunNarrowphase()
 {
-    if (activeCount_ == 0) return;
-
-    RebuildGrid();
+    constexpr uint8_t kSphere = static_cast<uint8_t>(ColliderShape3D::Sphere);
+    constexpr uint8_t kAABB = static_cast<uint8_t>(ColliderShape3D::AABB);
 
-    currentPairs_.clear();
-    testedPairs_.clear();
+    sphereSpherePairs_.clear();
+    sphereBoxPairs_.clear();
 
-    // グリッドベースの衝突判定
-    for (auto& [cell, indices] : grid_) {
-        size_t count = indices.size();
-        for (size_t i = 0; i < count; ++i) {
-            uint16_t idxA = indices[i];
-            if ((flags_[idxA] & kFlagEnabled) == 0) continue;
+    // 球-球・球-AABBはバッチへ、それ以外はその場でスカラー判定
+    for (uint32_t pairKey : candidatePairs_) {
+        uint16_t a = static_cast<uint16_t>(pairKey >> 16);
+        uint16_t b = static_cast<uint16_t>(pairKey & 0xFFFF);
+        uint8_t shapeA = shape_[a];
+        uint8_t shapeB = shape_[b];
 
-            for (size_t j = i + 1; j < count; ++j) {
-                uint16_t idxB = indices[j];
-                if ((flags_[idxB] & kFlagEnabled) == 0) continue;
-
-                // レイヤーマスクチェック
-                if ((layer_[idxA] & mask_[idxB]) == 0 ||
-                    (layer_[idxB] & mask_[idxA]) == 0) {
-                    continue;
-                }
+        if (shapeA == kSphere && shapeB == kSphere) {
+            sphereSpherePairs_.push_back(pairKey);
+        } else if (shapeA == kSphere && shapeB == kAABB) {
+            sphereBoxPairs_.push_back(pairKey);
+        } else if (shapeA == kAABB && shapeB == kSphere) {
+            sphereBoxPairs_.push_back((static_cast<uint32_t>(b) << 16) | a);
+        } else if (TestCollision(a, b)) {
+            currentPairs_.push_back(pairKey);
+        }
+    }
 
-                uint32_t pairKey = MakePairKey(idxA, idxB);
+    // 4ペアずつSIMD判定（端数は空きレーンをマスクで落とす）
+    for (size_t i = 0; i < sphereSpherePairs_.size(); i += 4) {
+        FlushSphereSphereBatch(&sphereSpherePairs_[i],
+                               (std::min)(sphereSpherePairs_.size() - i, size_t(4)));
+    }
+    for (size_t i = 0; i < sphereBoxPairs_.size(); i += 4) {
+        FlushSphereBoxBatch(&sphereBoxPairs_[i],
+                            (std::min)(sphereBoxPairs_.size() - i, size_t(4)));
+    }
+}
 
-                // 重複チェック
-                if (std::find(testedPairs_.begin(), testedPairs_.end(), pairKey) != testedPairs_.end()) {
-                    continue;
-                }
-                testedPairs_.push_back(pairKey);
+//----------------------------------------------------------------------------
+void CollisionManager3D::FlushSphereSphereBatch(const uint32_t* pairs, size_t count)
+{
+    Narrowphase3D::SphereSphereBatch batch = {};
+    for (size_t lane = 0; lane < count; ++lane) {
+        uint16_t a = static_cast<uint16_t>(pairs[lane] >> 16);
+        uint16_t b = static_cast<uint16_t>(pairs[lane] & 0xFFFF);
+        batch.ax[lane] = posX_[a]; batch.ay[lane] = posY_[a]; batch.az[lane] = posZ_[a];
+        batch.ar[lane] = radius_[a];
+        batch.bx[lane] = posX_[b]; batch.by[lane] = posY_[b]; batch.bz[lane] = posZ_[b];
+        batch.br[lane] = radius_[b];
+    }
 
-                if (TestCollision(idxA, idxB)) {
-                    currentPairs_.push_back(pairKey);
-                }
-            }
+    uint32_t hitMask = Narrowphase3D::SphereSphere4(batch) & ((1u << count) - 1);
+    for (size_t lane = 0; lane < count; ++lane) {
+        if (hitMask & (1u << lane)) {
+            currentPairs_.push_back(pairs[lane]);
         }
     }
+}
 
-    // 衝突ペアをソート
-    std::sort(currentPairs_.begin(), currentPairs_.end());
-
-    // Enter/Stay/Exit判定
-    size_t prevIdx = 0, currIdx = 0;
-    while (prevIdx < previousPairs_.size() || currIdx < currentPairs_.size()) {
-        uint32_t prevKey = (prevIdx < previousPairs_.size())
-            ? previousPairs_[prevIdx] : UINT32_MAX;
-        uint32_t currKey = (currIdx < currentPairs_.size())
-            ? currentPairs_[currIdx] : UINT32_MAX;
+//----------------------------------------------------------------------------
+void CollisionManager3D::FlushSphereBoxBatch(const uint32_t* pairs, size_t count)
+{
+    Narrowphase3D::SphereBoxBatch batch = {};
+    for (size_t lane = 0; lane < count; ++lane) {
+        uint16_t s = static_cast<uint16_t>(pairs[lane] >> 16);
+        uint16_t b = static_cast<uint16_t>(pairs[lane] & 0xFFFF);
+        batch.sx[lane] = posX_[s]; batch.sy[lane] = posY_[s]; batch.sz[lane] = posZ_[s];
+        batch.sr[lane] = radius_[s];
+        batch.bx[lane] = posX_[b]; batch.by[lane] = posY_[b]; batch.bz[lane] = posZ_[b];
+        batch.hw[lane] = halfW_[b]; batch.hh[lane] = halfH_[b]; batch.hd[lane] = halfD_[b];
+    }
 
-        if (prevKey < currKey) {
-            // Exit
-            uint16_t a = static_cast<uint16_t>(prevKey >> 16);
-            uint16_t b = static_cast<uint16_t>(prevKey & 0xFFFF);
-            if (onExit_[a] && colliders_[a] && colliders_[b]) {
-                onExit_[a](colliders_[a], colliders_[b]);
-            }
-            if (onExit_[b] && colliders_[a] && colliders_[b]) {
-                onExit_[b](colliders_[b], colliders_[a]);
-            }
-            ++prevIdx;
-        } else if (currKey < prevKey) {
-            // Enter
-            uint16_t a = static_cast<uint16_t>(currKey >> 16);
-            uint16_t b = static_cast<uint16_t>(currKey & 0xFFFF);
-            if (onEnter_[a] && colliders_[a] && colliders_[b]) {
-                onEnter_[a](colliders_[a], colliders_[b]);
-            }
-            if (onEnter_[b] && colliders_[a] && colliders_[b]) {
-                onEnter_[b](colliders_[b], colliders_[a]);
-            }
-            if (onCollision_[a] && colliders_[a] && colliders_[b]) {
-                onCollision_[a](colliders_[a], colliders_[b]);
-            }
-            if (onCollision_[b] && colliders_[a] && colliders_[b]) {
-                onCollision_[b](colliders_[b], colliders_[a]);
-            }
-            ++currIdx;
-        } else {
-            // Stay
-            uint16_t a = static_cast<uint16_t>(currKey >> 16);
-            uint16_t b = static_cast<uint16_t>(currKey & 0xFFFF);
-            if (onCollision_[a] && colliders_[a] && colliders_[b]) {
-                onCollision_[a](colliders_[a], colliders_[b]);
-            }
-            if (onCollision_[b] && colliders_[a] && colliders_[b]) {
-                onCollision_[b](colliders_[b], colliders_[a]);
-            }
-            ++prevIdx;
-            ++currIdx;
+    uint32_t hitMask = Narrowphase3D::SphereBox4(batch) & ((1u << count) - 1);
+    for (size_t lane = 0; lane < count; ++lane) {
+        if (hitMask & (1u << lane)) {
+            uint16_t s = static_cast<uint16_t>(pairs[lane] >> 16);
+            uint16_t b = static_cast<uint16_t>(pairs[lane] & 0xFFFF);
+            currentPairs_.push_back(MakePairKey(s, b));
         }
     }
-
-    std::swap(previousPairs_, currentPairs_);
 }
 
 //----------------------------------------------------------------------------
 bool CollisionManager3D::TestCollision(uint16_t indexA, uint16_t indexB) const
 {
+    using namespace Narrowphase3D;
+
     ColliderShape3D shapeA = static_cast<ColliderShape3D>(shape_[indexA]);
     ColliderShape3D shapeB = static_cast<ColliderShape3D>(shape_[indexB]);
 
-    // AABB vs AABB
-    if (shapeA == ColliderShape3D::AABB && shapeB == ColliderShape3D::AABB) {
-        float aMinX = posX_[indexA] - halfW_[indexA];
-        float aMaxX = posX_[indexA] + halfW_[indexA];
-        float aMinY = posY_[indexA] - halfH_[indexA];
-        float aMaxY = posY_[indexA] + halfH_[indexA];
-        float aMinZ = posZ_[indexA] - halfD_[indexA];
-        float aMaxZ = posZ_[indexA] + halfD_[indexA];
-
-        float bMinX = posX_[indexB] - halfW_[indexB];
-        float bMaxX = posX_[indexB] + halfW_[indexB];
-        float bMinY = posY_[indexB] - halfH_[indexB];
-        float bMaxY = posY_[indexB] + halfH_[indexB];
-        float bMinZ = posZ_[indexB] - halfD_[indexB];
-        float bMaxZ = posZ_[indexB] + halfD_[indexB];
-
-        return aMinX < bMaxX && aMaxX > bMinX &&
-               aMinY < bMaxY && aMaxY > bMinY &&
-               aMinZ < bMaxZ && aMaxZ > bMinZ;
-    }
-
-    // Sphere vs Sphere
-    if (shapeA == ColliderShape3D::Sphere && shapeB == ColliderShape3D::Sphere) {
-        float dx = posX_[indexA] - posX_[indexB];
-        float dy = posY_[indexA] - posY_[indexB];
-        float dz = posZ_[indexA] - posZ_[indexB];
-        float distSq = dx * dx + dy * dy + dz * dz;
-        float radiusSum = radius_[indexA] + radius_[indexB];
-        return distSq < radiusSum * radiusSum;
-    }
-
-    // AABB vs Sphere (or Sphere vs AABB)
-    uint16_t aabbIdx, sphereIdx;
-    if (shapeA == ColliderShape3D::AABB) {
-        aabbIdx = indexA;
-        sphereIdx = indexB;
-    } else {
-        aabbIdx = indexB;
-        sphereIdx = indexA;
+    // カプセルを先頭に寄せて組み合わせ数を減らす
+    if (shapeB == ColliderShape3D::Capsule && shapeA != ColliderShape3D::Capsule) {
+        std::swap(indexA, indexB);
+        std::swap(shapeA, shapeB);
+    }
+    // 残りは球を先頭に寄せる
+    if (shapeA == ColliderShape3D::AABB && shapeB == ColliderShape3D::Sphere) {
+        std::swap(indexA, indexB);
+        std::swap(shapeA, shapeB);
     }
 
-    float closestX = Clamp(posX_[sphereIdx],
-                           posX_[aabbIdx] - halfW_[aabbIdx],
-                           posX_[aabbIdx] + halfW_[aabbIdx]);
-    float closestY = Clamp(posY_[sphereIdx],
-                           posY_[aabbIdx] - halfH_[aabbIdx],
-                           posY_[aabbIdx] + halfH_[aabbIdx]);
-    float closestZ = Clamp(posZ_[sphereIdx],
-                           posZ_[aabbIdx] - halfD_[aabbIdx],
-                           posZ_[aabbIdx] + halfD_[aabbIdx]);
+    switch (shapeA) {
+    case ColliderShape3D::Capsule:
+        switch (shapeB) {
+        case ColliderShape3D::Capsule: return CapsuleCapsule(GetCapsuleData(indexA), GetCapsuleData(indexB));
+        case ColliderShape3D::Sphere:  return CapsuleSphere(GetCapsuleData(indexA), GetSphereData(indexB));
+        case ColliderShape3D::AABB:    return CapsuleBox(GetCapsuleData(indexA), GetBoxData(indexB));
+        }
+        break;
+    case ColliderShape3D::Sphere:
+        if (shapeB == ColliderShape3D::Sphere) {
+            return SphereSphere(GetSphereData(indexA), GetSphereData(indexB));
+        }
+        return SphereBox(GetSphereData(indexA), GetBoxData(indexB));
+    case ColliderShape3D::AABB:
+        return BoxBox(GetBoxData(indexA), GetBoxData(indexB));
+    }
+    return false;
+}
 
-    float dx = posX_[sphereIdx] - closestX;
-    float dy = posY_[sphereIdx] - closestY;
-    float dz = posZ_[sphereIdx] - closestZ;
-    float distSq = dx * dx + dy * dy + dz * dz;
-    float r = radius_[sphereIdx];
-    return distSq < r * r;
+//----------------------------------------------------------------------------
+void CollisionManager3D::GetBoundsHalfExtents(uint16_t i, float& hx, float& hy, float& hz) const noexcept
+{
+    switch (static_cast<ColliderShape3D>(shape_[i])) {
+    case ColliderShape3D::Sphere:
+        hx = hy = hz = radius_[i];
+        break;
+    case ColliderShape3D::Capsule:
+        hx = hz = radius_[i];
+        hy = capsuleHalfHeight_[i] + radius_[i];
+        break;
+    default:
+        hx = halfW_[i];
+        hy = halfH_[i];
+        hz = halfD_[i];
+        break;
+    }
+}
+
+//----------------------------------------------------------------------------
+AABB3D CollisionManager3D::GetBounds(uint16_t i) const noexcept
+{
+    float hx, hy, hz;
+    GetBoundsHalfExtents(i, hx, hy, hz);
+    AABB3D aabb;
+    aabb.minX = posX_[i] - hx;
+    aabb.minY = posY_[i] - hy;
+    aabb.minZ = posZ_[i] - hz;
+    aabb.maxX = posX_[i] + hx;
+    aabb.maxY = posY_[i] + hy;
+    aabb.maxZ = posZ_[i] + hz;
+    return aabb;
 }
 
 //----------------------------------------------------------------------------
 CollisionManager3D::Cell CollisionManager3D::ToCell(float x, float y, float z) const noexcept
 {
-    return Cell{
-        static_cast<int>(std::floor(x / cellSize_)),
-        static_cast<int>(std::floor(y / cellSize_)),
-        static_cast<int>(std::floor(z / cellSize_))
-    };
+    const float p[3] = { x, y, z };
+    return CollisionWorld::ToCell(p);
 }
 
 //----------------------------------------------------------------------------
 void CollisionManager3D::RebuildGrid()
 {
-    for (auto& [cell, indices] : grid_) {
-        indices.clear();
-    }
+    CollisionWorld::RebuildGrid([this](uint16_t i, Cell& c0, Cell& c1) {
+        // コライダーが占めるセル範囲を計算
+        float hx, hy, hz;
+        GetBoundsHalfExtents(i, hx, hy, hz);
+        c0 = ToCell(posX_[i] - hx, posY_[i] - hy, posZ_[i] - hz);
+        c1 = ToCell(posX_[i] + hx, posY_[i] + hy, posZ_[i] + hz);
+    });
+}
 
-    size_t count = flags_.size();
-    for (size_t i = 0; i < count; ++i) {
-        if ((flags_[i] & kFlagEnabled) == 0) continue;
-        if (!colliders_[i]) continue;
+//----------------------------------------------------------------------------
+bool CollisionManager3D::TestQueryAABB(uint16_t idx, const AABB3D& aabb, uint8_t layerMask) const
+{
+    if ((flags_[idx] & kFlagEnabled) == 0) return false;
+    if ((layer_[idx] & layerMask) == 0) return false;
 
-        // コライダーが占めるセル範囲を計算
-        float halfSize = 0.0f;
-        ColliderShape3D shape = static_cast<ColliderShape3D>(shape_[i]);
-        if (shape == ColliderShape3D::Sphere) {
-            halfSize = radius_[i];
-        } else {
-            // std::max({...})はWindowsマクロと競合するため手動で計算
-            halfSize = halfW_[i];
-            if (halfH_[i] > halfSize) halfSize = halfH_[i];
-            if (halfD_[i] > halfSize) halfSize = halfD_[i];
-        }
+    // AABB交差判定（球・カプセルは外接AABB）
+    return aabb.Intersects(GetBounds(idx));
+}
 
-        Cell minCell = ToCell(posX_[i] - halfSize, posY_[i] - halfSize, posZ_[i] - halfSize);
-        Cell maxCell = ToCell(posX_[i] + halfSize, posY_[i] + halfSize, posZ_[i] + halfSize);
+//----------------------------------------------------------------------------
+bool CollisionManager3D::TestQuerySphere(uint16_t idx, const BoundingSphere3D& sphere, uint8_t layerMask) const
+{
+    if ((flags_[idx] & kFlagEnabled) == 0) return false;
+    if ((layer_[idx] & layerMask) == 0) return false;
 
-        for (int cx = minCell.x; cx <= maxCell.x; ++cx) {
-            for (int cy = minCell.y; cy <= maxCell.y; ++cy) {
-                for (int cz = minCell.z; cz <= maxCell.z; ++cz) {
-                    grid_[Cell{cx, cy, cz}].push_back(static_cast<uint16_t>(i));
-                }
-            }
-        }
+    // 球交差判定
+    ColliderShape3D shape = static_cast<ColliderShape3D>(shape_[idx]);
+    if (shape == ColliderShape3D::Sphere) {
+        BoundingSphere3D colSphere(Vector3(posX_[idx], posY_[idx], posZ_[idx]), radius_[idx]);
+        return sphere.Intersects(colSphere);
+    }
+    if (shape == ColliderShape3D::Capsule) {
+        Narrowphase3D::Sphere query{ sphere.center.x, sphere.center.y, sphere.center.z, sphere.radius };
+        return Narrowphase3D::CapsuleSphere(GetCapsuleData(idx), query);
     }
+    return sphere.Intersects(GetBounds(idx));
 }
 
 //----------------------------------------------------------------------------
@@ -562,42 +583,37 @@ void CollisionManager3D::QueryAABB(const AABB3D& aabb, std::vector<Collider3D*>&
                                    uint8_t layerMask)
 {
     results.clear();
+
+    if (broadphase_ == Broadphase3D::DynamicTree) {
+        tree_->Query(aabb, [&](uint16_t idx) {
+            if (TestQueryAABB(idx, aabb, layerMask)) {
+                results.push_back(colliders_[idx]);
+            }
+            return true;
+        });
+        return;
+    }
+
     queryBuffer_.clear();
 
     Cell minCell = ToCell(aabb.minX, aabb.minY, aabb.minZ);
     Cell maxCell = ToCell(aabb.maxX, aabb.maxY, aabb.maxZ);
 
-    for (int cx = minCell.x; cx <= maxCell.x; ++cx) {
-        for (int cy = minCell.y; cy <= maxCell.y; ++cy) {
-            for (int cz = minCell.z; cz <= maxCell.z; ++cz) {
-                auto it = grid_.find(Cell{cx, cy, cz});
-                if (it == grid_.end()) continue;
-
-                for (uint16_t idx : it->second) {
-                    if (std::find(queryBuffer_.begin(), queryBuffer_.end(), idx) != queryBuffer_.end()) {
-                        continue;
-                    }
-
-                    if ((flags_[idx] & kFlagEnabled) == 0) continue;
-                    if ((layer_[idx] & layerMask) == 0) continue;
-
-                    // AABB交差判定
-                    AABB3D colAABB;
-                    colAABB.minX = posX_[idx] - halfW_[idx];
-                    colAABB.maxX = posX_[idx] + halfW_[idx];
-                    colAABB.minY = posY_[idx] - halfH_[idx];
-                    colAABB.maxY = posY_[idx] + halfH_[idx];
-                    colAABB.minZ = posZ_[idx] - halfD_[idx];
-                    colAABB.maxZ = posZ_[idx] + halfD_[idx];
-
-                    if (aabb.Intersects(colAABB)) {
-                        queryBuffer_.push_back(idx);
-                        results.push_back(colliders_[idx]);
-                    }
-                }
+    ForEachCell(minCell, maxCell, [&](const Cell& cell) {
+        auto it = grid_.find(cell);
+        if (it == grid_.end()) return;
+
+        for (uint16_t idx : it->second) {
+            if (std::find(queryBuffer_.begin(), queryBuffer_.end(), idx) != queryBuffer_.end()) {
+                continue;
+            }
+
+            if (TestQueryAABB(idx, aabb, layerMask)) {
+                queryBuffer_.push_back(idx);
+                results.push_back(colliders_[idx]);
             }
         }
-    }
+    });
 }
 
 //----------------------------------------------------------------------------
@@ -605,52 +621,43 @@ void CollisionManager3D::QuerySphere(const BoundingSphere3D& sphere, std::vector
                                      uint8_t layerMask)
 {
     results.clear();
-    queryBuffer_.clear();
 
     float r = sphere.radius;
+
+    if (broadphase_ == Broadphase3D::DynamicTree) {
+        AABB3D bounds;
+        bounds.minX = sphere.center.x - r; bounds.maxX = sphere.center.x + r;
+        bounds.minY = sphere.center.y - r; bounds.maxY = sphere.center.y + r;
+        bounds.minZ = sphere.center.z - r; bounds.maxZ = sphere.center.z + r;
+        tree_->Query(bounds, [&](uint16_t idx) {
+            if (TestQuerySphere(idx, sphere, layerMask)) {
+                results.push_back(colliders_[idx]);
+            }
+            return true;
+        });
+        return;
+    }
+
+    queryBuffer_.clear();
+
     Cell minCell = ToCell(sphere.center.x - r, sphere.center.y - r, sphere.center.z - r);
     Cell maxCell = ToCell(sphere.center.x + r, sphere.center.y + r, sphere.center.z + r);
 
-    for (int cx = minCell.x; cx <= maxCell.x; ++cx) {
-        for (int cy = minCell.y; cy <= maxCell.y; ++cy) {
-            for (int cz = minCell.z; cz <= maxCell.z; ++cz) {
-                auto it = grid_.find(Cell{cx, cy, cz});
-                if (it == grid_.end()) continue;
-
-                for (uint16_t idx : it->second) {
-                    if (std::find(queryBuffer_.begin(), queryBuffer_.end(), idx) != queryBuffer_.end()) {
-                        continue;
-                    }
-
-                    if ((flags_[idx] & kFlagEnabled) == 0) continue;
-                    if ((layer_[idx] & layerMask) == 0) continue;
-
-                    // 球交差判定
-                    ColliderShape3D shape = static_cast<ColliderShape3D>(shape_[idx]);
-                    bool intersects = false;
-
-                    if (shape == ColliderShape3D::Sphere) {
-                        BoundingSphere3D colSphere(Vector3(posX_[idx], posY_[idx], posZ_[idx]), radius_[idx]);
-                        intersects = sphere.Intersects(colSphere);
-                    } else {
-                        AABB3D colAABB;
-                        colAABB.minX = posX_[idx] - halfW_[idx];
-                        colAABB.maxX = posX_[idx] + halfW_[idx];
-                        colAABB.minY = posY_[idx] - halfH_[idx];
-                        colAABB.maxY = posY_[idx] + halfH_[idx];
-                        colAABB.minZ = posZ_[idx] - halfD_[idx];
-                        colAABB.maxZ = posZ_[idx] + halfD_[idx];
-                        intersects = sphere.Intersects(colAABB);
-                    }
-
-                    if (intersects) {
-                        queryBuffer_.push_back(idx);
-                        results.push_back(colliders_[idx]);
-                    }
-                }
+    ForEachCell(minCell, maxCell, [&](const Cell& cell) {
+        auto it = grid_.find(cell);
+        if (it == grid_.end()) return;
+
+        for (uint16_t idx : it->second) {
+            if (std::find(queryBuffer_.begin(), queryBuffer_.end(), idx) != queryBuffer_.end()) {
+                continue;
+            }
+
+            if (TestQuerySphere(idx, sphere, layerMask)) {
+                queryBuffer_.push_back(idx);
+                results.push_back(colliders_[idx]);
             }
         }
-    }
+    });
 }
 
 //----------------------------------------------------------------------------
@@ -658,7 +665,6 @@ std::optional<RaycastHit3D> CollisionManager3D::Raycast(
     const Vector3& origin, const Vector3& direction, float maxDistance,
     uint8_t layerMask)
 {
-    // 簡易実装: 全コライダーを走査
     RaycastHit3D closest;
     closest.distance = maxDistance;
     bool found = false;
@@ -666,113 +672,145 @@ std::optional<RaycastHit3D> CollisionManager3D::Raycast(
     Vector3 dir = direction;
     dir.Normalize();
 
-    size_t count = colliders_.size();
-    for (size_t i = 0; i < count; ++i) {
-        if ((flags_[i] & kFlagEnabled) == 0) continue;
-        if (!colliders_[i]) continue;
-        if ((layer_[i] & layerMask) == 0) continue;
-
-        ColliderShape3D shape = static_cast<ColliderShape3D>(shape_[i]);
-
-        if (shape == ColliderShape3D::Sphere) {
-            // レイ vs 球
-            Vector3 center(posX_[i], posY_[i], posZ_[i]);
-            Vector3 oc = origin - center;
-            float r = radius_[i];
-
-            float a = dir.Dot(dir);
-            float b = 2.0f * oc.Dot(dir);
-            float c = oc.Dot(oc) - r * r;
-            float discriminant = b * b - 4 * a * c;
-
-            if (discriminant >= 0) {
-                float t = (-b - std::sqrt(discriminant)) / (2.0f * a);
-                if (t >= 0 && t < closest.distance) {
-                    closest.distance = t;
-                    closest.point = origin + dir * t;
-                    closest.normal = closest.point - center;
-                    closest.normal.Normalize();
-                    closest.collider = colliders_[i];
+    if (broadphase_ == Broadphase3D::DynamicTree) {
+        // ツリー: 現在の最短距離より遠いノードは辿らない
+        tree_->Raycast(origin, dir, maxDistance, [&](uint16_t i, float) {
+            if (RaycastCollider(i, origin, dir, layerMask, closest)) {
+                found = true;
+            }
+            return closest.distance;
+        });
+    } else {
+        // グリッド: レイが通過するセルだけを始点側から順に調べ、
+        // 確定したヒットがセル出口より手前なら打ち切る
+        // （ヒット点を含むセルには必ずそのコライダーが登録されている）
+        TraverseRay(origin, dir, maxDistance, [&](const std::vector<uint16_t>& indices, float tExit) {
+            for (uint16_t idx : indices) {
+                if (RaycastCollider(idx, origin, dir, layerMask, closest)) {
                     found = true;
                 }
             }
-        } else {
-            // レイ vs AABB（スラブ法）
-            AABB3D aabb;
-            aabb.minX = posX_[i] - halfW_[i];
-            aabb.maxX = posX_[i] + halfW_[i];
-            aabb.minY = posY_[i] - halfH_[i];
-            aabb.maxY = posY_[i] + halfH_[i];
-            aabb.minZ = posZ_[i] - halfD_[i];
-            aabb.maxZ = posZ_[i] + halfD_[i];
-
-            float tMin = 0.0f;
-            float tMax = closest.distance;
-
-            // X軸
-            if (std::abs(dir.x) > 0.0001f) {
-                float t1 = (aabb.minX - origin.x) / dir.x;
-                float t2 = (aabb.maxX - origin.x) / dir.x;
-                if (t1 > t2) std::swap(t1, t2);
-                if (t1 > tMin) tMin = t1;
-                if (t2 < tMax) tMax = t2;
-                if (tMin > tMax) continue;
-            } else if (origin.x < aabb.minX || origin.x > aabb.maxX) {
-                continue;
-            }
+            return closest.distance >= tExit;
+        });
+    }
 
-            // Y軸
-            if (std::abs(dir.y) > 0.0001f) {
-                float t1 = (aabb.minY - origin.y) / dir.y;
-                float t2 = (aabb.maxY - origin.y) / dir.y;
-                if (t1 > t2) std::swap(t1, t2);
-                if (t1 > tMin) tMin = t1;
-                if (t2 < tMax) tMax = t2;
-                if (tMin > tMax) continue;
-            } else if (origin.y < aabb.minY || origin.y > aabb.maxY) {
-                continue;
-            }
+    if (found) {
+        return closest;
+    }
+    return std::nullopt;
+}
 
-            // Z軸
-            if (std::abs(dir.z) > 0.0001f) {
-                float t1 = (aabb.minZ - origin.z) / dir.z;
-                float t2 = (aabb.maxZ - origin.z) / dir.z;
-                if (t1 > t2) std::swap(t1, t2);
-                if (t1 > tMin) tMin = t1;
-                if (t2 < tMax) tMax = t2;
-                if (tMin > tMax) continue;
-            } else if (origin.z < aabb.minZ || origin.z > aabb.maxZ) {
-                continue;
-            }
+//----------------------------------------------------------------------------
+bool CollisionManager3D::RaycastCollider(uint16_t i, const Vector3& origin, const Vector3& dir,
+                                         uint8_t layerMask, RaycastHit3D& closest) const
+{
+    if ((flags_[i] & kFlagEnabled) == 0) return false;
+    if (!colliders_[i]) return false;
+    if ((layer_[i] & layerMask) == 0) return false;
 
-            if (tMin >= 0 && tMin < closest.distance) {
-                closest.distance = tMin;
-                closest.point = origin + dir * tMin;
-                // 法線計算（簡易）
-                Vector3 center = aabb.GetCenter();
-                Vector3 toHit = closest.point - center;
-                Vector3 halfSize = aabb.GetSize() * 0.5f;
-                // ゼロ除算防止（縮退AABBに対応）
-                constexpr float kEpsilon = 0.0001f;
-                float hx = halfSize.x > kEpsilon ? halfSize.x : kEpsilon;
-                float hy = halfSize.y > kEpsilon ? halfSize.y : kEpsilon;
-                float hz = halfSize.z > kEpsilon ? halfSize.z : kEpsilon;
-                if (std::abs(toHit.x / hx) > std::abs(toHit.y / hy) &&
-                    std::abs(toHit.x / hx) > std::abs(toHit.z / hz)) {
-                    closest.normal = Vector3(toHit.x > 0 ? 1.0f : -1.0f, 0, 0);
-                } else if (std::abs(toHit.y / hy) > std::abs(toHit.z / hz)) {
-                    closest.normal = Vector3(0, toHit.y > 0 ? 1.0f : -1.0f, 0);
-                } else {
-                    closest.normal = Vector3(0, 0, toHit.z > 0 ? 1.0f : -1.0f);
-                }
-                closest.collider = colliders_[i];
-                found = true;
-            }
+    ColliderShape3D shape = static_cast<ColliderShape3D>(shape_[i]);
+
+    if (shape == ColliderShape3D::Sphere) {
+        // レイ vs 球
+        Vector3 center(posX_[i], posY_[i], posZ_[i]);
+        float t;
+        if (IntersectRaySphere(origin, dir, center, radius_[i], t) && t < closest.distance) {
+            closest.distance = t;
+            closest.point = origin + dir * t;
+            closest.normal = closest.point - center;
+            closest.normal.Normalize();
+            closest.collider = colliders_[i];
+            return true;
         }
+        return false;
     }
 
-    if (found) {
-        return closest;
+    if (shape == ColliderShape3D::Capsule) {
+        // レイ vs カプセル
+        float t;
+        Vector3 normal;
+        if (IntersectRayCapsule(origin, dir, GetCapsuleData(i), t, normal) &&
+            t < closest.distance) {
+            closest.distance = t;
+            closest.point = origin + dir * t;
+            closest.normal = normal;
+            closest.collider = colliders_[i];
+            return true;
+        }
+        return false;
     }
-    return std::nullopt;
+
+    // レイ vs AABB（スラブ法）
+    AABB3D aabb;
+    aabb.minX = posX_[i] - halfW_[i];
+    aabb.maxX = posX_[i] + halfW_[i];
+    aabb.minY = posY_[i] - halfH_[i];
+    aabb.maxY = posY_[i] + halfH_[i];
+    aabb.minZ = posZ_[i] - halfD_[i];
+    aabb.maxZ = posZ_[i] + halfD_[i];
+
+    float tMin = 0.0f;
+    float tMax = closest.distance;
+
+    // X軸
+    if (std::abs(dir.x) > 0.0001f) {
+        float t1 = (aabb.minX - origin.x) / dir.x;
+        float t2 = (aabb.maxX - origin.x) / dir.x;
+        if (t1 > t2) std::swap(t1, t2);
+        if (t1 > tMin) tMin = t1;
+        if (t2 < tMax) tMax = t2;
+        if (tMin > tMax) return false;
+    } else if (origin.x < aabb.minX || origin.x > aabb.maxX) {
+        return false;
+    }
+
+    // Y軸
+    if (std::abs(dir.y) > 0.0001f) {
+        float t1 = (aabb.minY - origin.y) / dir.y;
+        float t2 = (aabb.maxY - origin.y) / dir.y;
+        if (t1 > t2) std::swap(t1, t2);
+        if (t1 > tMin) tMin = t1;
+        if (t2 < tMax) tMax = t2;
+        if (tMin > tMax) return false;
+    } else if (origin.y < aabb.minY || origin.y > aabb.maxY) {
+        return false;
+    }
+
+    // Z軸
+    if (std::abs(dir.z) > 0.0001f) {
+        float t1 = (aabb.minZ - origin.z) / dir.z;
+        float t2 = (aabb.maxZ - origin.z) / dir.z;
+        if (t1 > t2) std::swap(t1, t2);
+        if (t1 > tMin) tMin = t1;
+        if (t2 < tMax) tMax = t2;
+        if (tMin > tMax) return false;
+    } else if (origin.z < aabb.minZ || origin.z > aabb.maxZ) {
+        return false;
+    }
+
+    if (tMin < 0 || tMin >= closest.distance) {
+        return false;
+    }
+
+    closest.distance = tMin;
+    closest.point = origin + dir * tMin;
+    // 法線計算（簡易）
+    Vector3 center = aabb.GetCenter();
+    Vector3 toHit = closest.point - center;
+    Vector3 halfSize = aabb.GetSize() * 0.5f;
+    // ゼロ除算防止（縮退AABBに対応）
+    constexpr float kEpsilon = 0.0001f;
+    float hx = halfSize.x > kEpsilon ? halfSize.x : kEpsilon;
+    float hy = halfSize.y > kEpsilon ? halfSize.y : kEpsilon;
+    float hz = halfSize.z > kEpsilon ? halfSize.z : kEpsilon;
+    if (std::abs(toHit.x / hx) > std::abs(toHit.y / hy) &&
+        std::abs(toHit.x / hx) > std::abs(toHit.z / hz)) {
+        closest.normal = Vector3(toHit.x > 0 ? 1.0f : -1.0f, 0, 0);
+    } else if (std::abs(toHit.y / hy) > std::abs(toHit.z / hz)) {
+        closest.normal = Vector3(0, toHit.y > 0 ? 1.0f : -1.0f, 0);
+    } else {
+        closest.normal = Vector3(0, 0, toHit.z > 0 ? 1.0f : -1.0f);
+    }
+    closest.collider = colliders_[i];
+    return true;
 }
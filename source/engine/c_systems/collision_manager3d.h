@@ -3,13 +3,17 @@
 //! @brief  3D衝突判定マネージャー（DOD設計）
 //!
 //! @note スレッドセーフではない。メインスレッドからのみ呼び出すこと。
+//!
+//! @note ハンドル管理・グリッド・ペア差分・イベントストリームは2Dと共通の
+//!       CollisionWorldが担う。衝突コールバックは2Dと同様に、
+//!       固定ステップの検出完了後にイベントストリームから配信される。
 //----------------------------------------------------------------------------
 #pragma once
 
-#include "common/utility/non_copyable.h"
+#include "collision_world.h"
 #include "engine/math/math_types.h"
+#include "collision_narrowphase3d.h"
 #include <vector>
-#include <unordered_map>
 #include <functional>
 #include <cstdint>
 #include <optional>
@@ -18,24 +22,34 @@
 
 class Collider3D;
 class GameObject;
+class DynamicAABBTree3D;
 
 //============================================================================
 // 定数定義
 //============================================================================
 namespace CollisionConstants3D {
-    static constexpr uint16_t kInvalidIndex = UINT16_MAX;   //!< 無効なインデックス
-    static constexpr uint8_t kDefaultLayer = 0x01;          //!< デフォルトレイヤー
-    static constexpr uint8_t kDefaultMask = 0xFF;           //!< デフォルトマスク
+    static constexpr uint16_t kInvalidIndex = CollisionWorldConstants::kInvalidIndex;  //!< 無効なインデックス
+    static constexpr uint8_t kDefaultLayer = CollisionWorldConstants::kDefaultLayer;   //!< デフォルトレイヤー
+    static constexpr uint8_t kDefaultMask = CollisionWorldConstants::kDefaultMask;     //!< デフォルトマスク
     static constexpr int kDefaultCellSize = 100;            //!< デフォルトセルサイズ
+    static constexpr float kDefaultTreeMargin = 10.0f;      //!< 動的ツリーの葉を太らせる量
 }
 
+//============================================================================
+//! @brief 3Dブロードフェーズ方式
+//============================================================================
+enum class Broadphase3D : uint8_t {
+    Grid,           //!< 一様グリッド（大きさの揃った密なシーン向け）
+    DynamicTree     //!< 動的AABBツリー（大きさがばらつく・疎なシーン向け）
+};
+
 //============================================================================
 //! @brief 3Dコライダー形状
 //============================================================================
 enum class ColliderShape3D : uint8_t {
     AABB,       //!< 軸並行バウンディングボックス
     Sphere,     //!< 球
-    Capsule     //!< カプセル（将来実装用）
+    Capsule     //!< カプセル（Y軸に沿った線分＋半径）
 };
 
 //============================================================================
@@ -116,6 +130,11 @@ struct BoundingSphere3D {
 //============================================================================
 using CollisionCallback3D = std::function<void(Collider3D*, Collider3D*)>;
 
+//============================================================================
+//! @brief 衝突ペアイベント（3D）
+//============================================================================
+using CollisionPairEvent3D = BasicCollisionPairEvent<Collider3DHandle>;
+
 //============================================================================
 //! @brief レイキャストヒット情報
 //============================================================================
@@ -132,7 +151,7 @@ struct RaycastHit3D {
 //! Structure of Arrays（SoA）でデータを保持し、
 //! キャッシュ効率の良い衝突判定を行う。
 //============================================================================
-class CollisionManager3D final : private NonCopyableNonMovable {
+class CollisionManager3D final : public CollisionWorld<3, Collider3D, Collider3DHandle> {
 public:
     //! @brief シングルトンインスタンス取得
     static CollisionManager3D& Get()
@@ -155,13 +174,16 @@ public:
         instance_.reset();
     }
 
-    ~CollisionManager3D() = default;
+    ~CollisionManager3D();
 
     //------------------------------------------------------------------------
     // 初期化・終了
     //------------------------------------------------------------------------
 
-    void Initialize(int cellSize = CollisionConstants3D::kDefaultCellSize);
+    //! @param cellSize グリッドのセルサイズ（Gridのみ使用）
+    //! @param broadphase ブロードフェーズ方式。QueryAABB/QuerySphere/Raycastも同じ構造を使う
+    void Initialize(int cellSize = CollisionConstants3D::kDefaultCellSize,
+                    Broadphase3D broadphase = Broadphase3D::Grid);
     void Shutdown();
 
     //------------------------------------------------------------------------
@@ -170,7 +192,6 @@ public:
 
     [[nodiscard]] Collider3DHandle Register(Collider3D* collider, ColliderShape3D shape);
     void Unregister(Collider3DHandle handle);
-    [[nodiscard]] bool IsValid(Collider3DHandle handle) const noexcept;
     void Clear();
 
     //------------------------------------------------------------------------
@@ -180,15 +201,11 @@ public:
     void SetPosition(Collider3DHandle handle, const Vector3& pos);
     void SetAABBSize(Collider3DHandle handle, const Vector3& size);
     void SetSphereRadius(Collider3DHandle handle, float radius);
-    void SetOffset(Collider3DHandle handle, const Vector3& offset);
-    void SetLayer(Collider3DHandle handle, uint8_t layer);
-    void SetMask(Collider3DHandle handle, uint8_t mask);
-    void SetEnabled(Collider3DHandle handle, bool enabled);
-    void SetTrigger(Collider3DHandle handle, bool trigger);
 
-    void SetOnCollision(Collider3DHandle handle, CollisionCallback3D cb);
-    void SetOnCollisionEnter(Collider3DHandle handle, CollisionCallback3D cb);
-    void SetOnCollisionExit(Collider3DHandle handle, CollisionCallback3D cb);
+    //! @brief カプセルの線分半長を設定（半径はSetSphereRadiusと共通）
+    //! @param halfHeight 中心から線分端点までの距離（半球部分を含まない）
+    void SetCapsuleHalfHeight(Collider3DHandle handle, float halfHeight);
+    void SetOffset(Collider3DHandle handle, const Vector3& offset);
 
     //------------------------------------------------------------------------
     // データ取得
@@ -198,26 +215,21 @@ public:
     [[nodiscard]] BoundingSphere3D GetBoundingSphere(Collider3DHandle handle) const;
     [[nodiscard]] Vector3 GetSize(Collider3DHandle handle) const;
     [[nodiscard]] float GetRadius(Collider3DHandle handle) const;
+    [[nodiscard]] float GetCapsuleHalfHeight(Collider3DHandle handle) const;
     [[nodiscard]] Vector3 GetOffset(Collider3DHandle handle) const;
-    [[nodiscard]] uint8_t GetLayer(Collider3DHandle handle) const;
-    [[nodiscard]] uint8_t GetMask(Collider3DHandle handle) const;
-    [[nodiscard]] bool IsEnabled(Collider3DHandle handle) const;
-    [[nodiscard]] bool IsTrigger(Collider3DHandle handle) const;
     [[nodiscard]] ColliderShape3D GetShape(Collider3DHandle handle) const;
-    [[nodiscard]] Collider3D* GetCollider(Collider3DHandle handle) const;
 
     //------------------------------------------------------------------------
     // 更新
     //------------------------------------------------------------------------
 
     void Update(float deltaTime);
-    [[nodiscard]] static constexpr float GetFixedDeltaTime() noexcept { return kFixedDeltaTime; }
 
     //------------------------------------------------------------------------
     // 統計
     //------------------------------------------------------------------------
 
-    [[nodiscard]] size_t GetColliderCount() const noexcept { return activeCount_; }
+    [[nodiscard]] Broadphase3D GetBroadphase() const noexcept { return broadphase_; }
 
     //------------------------------------------------------------------------
     // クエリ
@@ -234,93 +246,91 @@ public:
         uint8_t layerMask = CollisionConstants3D::kDefaultMask);
 
 private:
-    CollisionManager3D() = default;
+    CollisionManager3D();
 
     static inline std::unique_ptr<CollisionManager3D> instance_ = nullptr;
 
     void FixedUpdate();
 
-    [[nodiscard]] uint16_t AllocateIndex();
-    void FreeIndex(uint16_t index);
+    //! @brief ブロードフェーズ候補ペアを収集（昇順・重複なし）
+    void CollectCandidatePairsGrid();
+    void CollectCandidatePairsTree();
 
-    [[nodiscard]] static uint32_t MakePairKey(uint16_t a, uint16_t b) noexcept {
-        if (a > b) { uint16_t t = a; a = b; b = t; }
-        return (static_cast<uint32_t>(a) << 16) | b;
-    }
+    //! @brief 全コライダーの葉をツリーへ反映
+    void UpdateTree();
 
+    //! @brief 1ペアをスカラーで判定（全形状組み合わせ対応）
     [[nodiscard]] bool TestCollision(uint16_t indexA, uint16_t indexB) const;
 
+    //! @brief 候補ペアを形状別に振り分けて判定し、ヒットをcurrentPairs_へ追加
+    void RunNarrowphase();
+    void FlushSphereSphereBatch(const uint32_t* pairs, size_t count);
+    void FlushSphereBoxBatch(const uint32_t* pairs, size_t count);
+
+    [[nodiscard]] Narrowphase3D::Sphere GetSphereData(uint16_t i) const noexcept {
+        return { posX_[i], posY_[i], posZ_[i], radius_[i] };
+    }
+    [[nodiscard]] Narrowphase3D::Box GetBoxData(uint16_t i) const noexcept {
+        return { posX_[i], posY_[i], posZ_[i], halfW_[i], halfH_[i], halfD_[i] };
+    }
+    [[nodiscard]] Narrowphase3D::Capsule GetCapsuleData(uint16_t i) const noexcept {
+        return { posX_[i], posY_[i], posZ_[i], capsuleHalfHeight_[i], radius_[i] };
+    }
+
+    //! @brief 形状を包むAABBの半サイズ
+    void GetBoundsHalfExtents(uint16_t i, float& hx, float& hy, float& hz) const noexcept;
+    [[nodiscard]] AABB3D GetBounds(uint16_t i) const noexcept;
+
     //------------------------------------------------------------------------
-    // グリッド
+    // クエリ内部処理（ブロードフェーズ共通）
     //------------------------------------------------------------------------
 
-    struct Cell {
-        int x, y, z;
-        bool operator==(const Cell& other) const noexcept {
-            return x == other.x && y == other.y && z == other.z;
-        }
-    };
-
-    struct CellHash {
-        size_t operator()(const Cell& c) const noexcept {
-            auto h1 = std::hash<int>{}(c.x);
-            auto h2 = std::hash<int>{}(c.y);
-            auto h3 = std::hash<int>{}(c.z);
-            size_t seed = h1;
-            seed ^= h2 + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-            seed ^= h3 + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-            return seed;
-        }
-    };
+    [[nodiscard]] bool TestQueryAABB(uint16_t idx, const AABB3D& aabb, uint8_t layerMask) const;
+    [[nodiscard]] bool TestQuerySphere(uint16_t idx, const BoundingSphere3D& sphere, uint8_t layerMask) const;
+
+    //! @brief 1コライダーとのレイ判定。closestより近ければ更新してtrue
+    bool RaycastCollider(uint16_t i, const Vector3& origin, const Vector3& dir,
+                         uint8_t layerMask, RaycastHit3D& closest) const;
+
+    //------------------------------------------------------------------------
+    // グリッド
+    //------------------------------------------------------------------------
 
     [[nodiscard]] Cell ToCell(float x, float y, float z) const noexcept;
     void RebuildGrid();
 
+    //! @brief レイが通過するセルを始点側から順に列挙
+    //! @param dir 正規化済みの方向
+    //! @param visit bool(const std::vector<uint16_t>& indices, float tExit)
+    //!        tExitはセルを出る距離。falseで打ち切り
+    template<typename Visitor>
+    void TraverseRay(const Vector3& origin, const Vector3& dir, float maxDistance, Visitor&& visit) const {
+        const float o[3] = { origin.x, origin.y, origin.z };
+        const float d[3] = { dir.x, dir.y, dir.z };
+        TraverseGrid(o, d, maxDistance, visit);
+    }
+
     //------------------------------------------------------------------------
     // SoA構造
     //------------------------------------------------------------------------
 
-    // ホットデータ
+    // ホットデータ（レイヤー・マスク・フラグ・コールバック等はCollisionWorldが保持）
     std::vector<float> posX_, posY_, posZ_;
     std::vector<float> halfW_, halfH_, halfD_;  // AABB半サイズ
-    std::vector<float> radius_;                  // 球半径
+    std::vector<float> radius_;                  // 球・カプセル半径
+    std::vector<float> capsuleHalfHeight_;       // カプセル線分半長
     std::vector<uint8_t> shape_;                 // ColliderShape3D
-    std::vector<uint8_t> layer_, mask_, flags_;
 
     // ウォームデータ
     std::vector<float> offsetX_, offsetY_, offsetZ_;
     std::vector<float> sizeW_, sizeH_, sizeD_;
 
-    // コールドデータ
-    std::vector<Collider3D*> colliders_;
-    std::vector<CollisionCallback3D> onCollision_;
-    std::vector<CollisionCallback3D> onEnter_;
-    std::vector<CollisionCallback3D> onExit_;
-
-    // 世代管理
-    std::vector<uint16_t> generations_;
-
-    // フリーリスト
-    std::vector<uint16_t> freeIndices_;
-    size_t activeCount_ = 0;
-
-    // 空間ハッシュグリッド
-    int cellSize_ = CollisionConstants3D::kDefaultCellSize;
-    std::unordered_map<Cell, std::vector<uint16_t>, CellHash> grid_;
-
-    // 衝突ペア
-    std::vector<uint32_t> previousPairs_;
-    std::vector<uint32_t> currentPairs_;
-    std::vector<uint32_t> testedPairs_;
-
-    // フラグビット定義
-    static constexpr uint8_t kFlagEnabled = 0x01;
-    static constexpr uint8_t kFlagTrigger = 0x02;
-
-    // 固定タイムステップ
-    static constexpr float kFixedDeltaTime = 1.0f / 60.0f;
-    float accumulator_ = 0.0f;
+    // 動的AABBツリー（DynamicTree選択時のみ生成）
+    Broadphase3D broadphase_ = Broadphase3D::Grid;
+    std::unique_ptr<DynamicAABBTree3D> tree_;
+    std::vector<int32_t> proxyIds_;             // コライダーごとの葉ID
 
-    // クエリ用バッファ
-    mutable std::vector<uint16_t> queryBuffer_;
+    // ナローフェーズ振り分け（上位16bit: 球、下位16bit: 相手）
+    std::vector<uint32_t> sphereSpherePairs_;
+    std::vector<uint32_t> sphereBoxPairs_;
 };
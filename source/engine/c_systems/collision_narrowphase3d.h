@@ -0,0 +1,245 @@
+//----------------------------------------------------------------------------
+//! @file   collision_narrowphase3d.h
+//! @brief  3D衝突判定ナローフェーズ（スカラー参照実装とSIMDバッチ実装）
+//!
+//! @details
+//! CollisionManager3Dのペア判定で使用する形状ごとの交差判定。
+//! スカラー版は検証用の参照実装を兼ねる。
+//! 球-球・球-AABBは4ペアを1バッチとしてSSEで判定する版も用意し、
+//! スカラー版と同じ演算順序・比較を使うため、FMA縮約が入らない限り
+//! 判定結果は一致する（ベンチマークの--validateで照合できる）。
+//!
+//! カプセルはY軸に沿った線分（中心±halfHeight）と半径で表す。
+//----------------------------------------------------------------------------
+#pragma once
+
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define COLLISION_NARROWPHASE_SIMD 1
+#include <xmmintrin.h>
+#else
+#define COLLISION_NARROWPHASE_SIMD 0
+#endif
+
+namespace Narrowphase3D {
+
+//============================================================================
+// 形状データ（SoAから取り出した値）
+//============================================================================
+
+//! @brief 球
+struct Sphere {
+    float x, y, z;
+    float radius;
+};
+
+//! @brief AABB（中心と半サイズ）
+struct Box {
+    float x, y, z;
+    float halfW, halfH, halfD;
+};
+
+//! @brief Y軸カプセル（中心、線分半長、半径）
+struct Capsule {
+    float x, y, z;
+    float halfHeight;
+    float radius;
+};
+
+//============================================================================
+// スカラー参照実装
+//============================================================================
+
+//! @brief [lo, hi]へのクランプ（Windowsのmin/maxマクロを避ける）
+[[nodiscard]] inline float ClampScalar(float v, float lo, float hi) noexcept
+{
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+//! @brief 区間[aMin, aMax]と[bMin, bMax]の隙間（重なっていれば0）
+[[nodiscard]] inline float IntervalGap(float aMin, float aMax, float bMin, float bMax) noexcept
+{
+    if (aMax < bMin) return bMin - aMax;
+    if (bMax < aMin) return aMin - bMax;
+    return 0.0f;
+}
+
+//! @brief AABB vs AABB
+[[nodiscard]] inline bool BoxBox(const Box& a, const Box& b) noexcept
+{
+    return a.x - a.halfW < b.x + b.halfW && a.x + a.halfW > b.x - b.halfW &&
+           a.y - a.halfH < b.y + b.halfH && a.y + a.halfH > b.y - b.halfH &&
+           a.z - a.halfD < b.z + b.halfD && a.z + a.halfD > b.z - b.halfD;
+}
+
+//! @brief 球 vs 球
+[[nodiscard]] inline bool SphereSphere(const Sphere& a, const Sphere& b) noexcept
+{
+    float dx = a.x - b.x;
+    float dy = a.y - b.y;
+    float dz = a.z - b.z;
+    float distSq = dx * dx + dy * dy + dz * dz;
+    float radiusSum = a.radius + b.radius;
+    return distSq < radiusSum * radiusSum;
+}
+
+//! @brief 球 vs AABB
+[[nodiscard]] inline bool SphereBox(const Sphere& s, const Box& b) noexcept
+{
+    float closestX = ClampScalar(s.x, b.x - b.halfW, b.x + b.halfW);
+    float closestY = ClampScalar(s.y, b.y - b.halfH, b.y + b.halfH);
+    float closestZ = ClampScalar(s.z, b.z - b.halfD, b.z + b.halfD);
+    float dx = s.x - closestX;
+    float dy = s.y - closestY;
+    float dz = s.z - closestZ;
+    float distSq = dx * dx + dy * dy + dz * dz;
+    return distSq < s.radius * s.radius;
+}
+
+//! @brief カプセル vs 球
+//!
+//! 球の中心に最も近い線分上の点を求め、半径和と比較する。
+[[nodiscard]] inline bool CapsuleSphere(const Capsule& c, const Sphere& s) noexcept
+{
+    float closestY = ClampScalar(s.y, c.y - c.halfHeight, c.y + c.halfHeight);
+    float dx = s.x - c.x;
+    float dy = s.y - closestY;
+    float dz = s.z - c.z;
+    float distSq = dx * dx + dy * dy + dz * dz;
+    float radiusSum = c.radius + s.radius;
+    return distSq < radiusSum * radiusSum;
+}
+
+//! @brief カプセル vs カプセル
+//!
+//! 両線分ともY軸に平行なので、線分間距離は
+//! 水平距離とY区間の隙間に分解できる。
+[[nodiscard]] inline bool CapsuleCapsule(const Capsule& a, const Capsule& b) noexcept
+{
+    float dx = a.x - b.x;
+    float dz = a.z - b.z;
+    float gapY = IntervalGap(a.y - a.halfHeight, a.y + a.halfHeight,
+                             b.y - b.halfHeight, b.y + b.halfHeight);
+    float distSq = dx * dx + gapY * gapY + dz * dz;
+    float radiusSum = a.radius + b.radius;
+    return distSq < radiusSum * radiusSum;
+}
+
+//! @brief カプセル vs AABB
+//!
+//! 線分はY軸に平行なので、XZは線分のX/Z座標をAABBへクランプし、
+//! YはカプセルのY区間とAABBのY区間の隙間を用いる。
+[[nodiscard]] inline bool CapsuleBox(const Capsule& c, const Box& b) noexcept
+{
+    float dx = c.x - ClampScalar(c.x, b.x - b.halfW, b.x + b.halfW);
+    float dz = c.z - ClampScalar(c.z, b.z - b.halfD, b.z + b.halfD);
+    float gapY = IntervalGap(c.y - c.halfHeight, c.y + c.halfHeight,
+                             b.y - b.halfH, b.y + b.halfH);
+    float distSq = dx * dx + gapY * gapY + dz * dz;
+    return distSq < c.radius * c.radius;
+}
+
+//============================================================================
+// 4ペアバッチ（SoA入力、結果はビットマスク）
+//============================================================================
+
+//! @brief 球-球4ペアの入力（レーンiがi番目のペア）
+struct SphereSphereBatch {
+    alignas(16) float ax[4], ay[4], az[4], ar[4];
+    alignas(16) float bx[4], by[4], bz[4], br[4];
+};
+
+//! @brief 球-AABB4ペアの入力（レーンiがi番目のペア）
+struct SphereBoxBatch {
+    alignas(16) float sx[4], sy[4], sz[4], sr[4];
+    alignas(16) float bx[4], by[4], bz[4];
+    alignas(16) float hw[4], hh[4], hd[4];
+};
+
+//! @brief 球-球4ペア（スカラー参照）
+//! @return ヒットしたレーンのビットマスク
+[[nodiscard]] inline uint32_t SphereSphere4Reference(const SphereSphereBatch& in) noexcept
+{
+    uint32_t mask = 0;
+    for (int i = 0; i < 4; ++i) {
+        Sphere a{ in.ax[i], in.ay[i], in.az[i], in.ar[i] };
+        Sphere b{ in.bx[i], in.by[i], in.bz[i], in.br[i] };
+        if (SphereSphere(a, b)) mask |= 1u << i;
+    }
+    return mask;
+}
+
+//! @brief 球-AABB4ペア（スカラー参照）
+//! @return ヒットしたレーンのビットマスク
+[[nodiscard]] inline uint32_t SphereBox4Reference(const SphereBoxBatch& in) noexcept
+{
+    uint32_t mask = 0;
+    for (int i = 0; i < 4; ++i) {
+        Sphere s{ in.sx[i], in.sy[i], in.sz[i], in.sr[i] };
+        Box b{ in.bx[i], in.by[i], in.bz[i], in.hw[i], in.hh[i], in.hd[i] };
+        if (SphereBox(s, b)) mask |= 1u << i;
+    }
+    return mask;
+}
+
+#if COLLISION_NARROWPHASE_SIMD
+
+//! @brief 球-球4ペア（SSE）
+//! @return ヒットしたレーンのビットマスク
+[[nodiscard]] inline uint32_t SphereSphere4(const SphereSphereBatch& in) noexcept
+{
+    __m128 dx = _mm_sub_ps(_mm_load_ps(in.ax), _mm_load_ps(in.bx));
+    __m128 dy = _mm_sub_ps(_mm_load_ps(in.ay), _mm_load_ps(in.by));
+    __m128 dz = _mm_sub_ps(_mm_load_ps(in.az), _mm_load_ps(in.bz));
+    __m128 distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)),
+                               _mm_mul_ps(dz, dz));
+    __m128 radiusSum = _mm_add_ps(_mm_load_ps(in.ar), _mm_load_ps(in.br));
+    __m128 hit = _mm_cmplt_ps(distSq, _mm_mul_ps(radiusSum, radiusSum));
+    return static_cast<uint32_t>(_mm_movemask_ps(hit));
+}
+
+//! @brief 球-AABB4ペア（SSE）
+//! @return ヒットしたレーンのビットマスク
+[[nodiscard]] inline uint32_t SphereBox4(const SphereBoxBatch& in) noexcept
+{
+    __m128 sx = _mm_load_ps(in.sx);
+    __m128 sy = _mm_load_ps(in.sy);
+    __m128 sz = _mm_load_ps(in.sz);
+    __m128 bx = _mm_load_ps(in.bx);
+    __m128 by = _mm_load_ps(in.by);
+    __m128 bz = _mm_load_ps(in.bz);
+    __m128 hw = _mm_load_ps(in.hw);
+    __m128 hh = _mm_load_ps(in.hh);
+    __m128 hd = _mm_load_ps(in.hd);
+
+    // ClampScalarと同じく「下限で持ち上げてから上限で抑える」順序
+    __m128 cx = _mm_min_ps(_mm_max_ps(sx, _mm_sub_ps(bx, hw)), _mm_add_ps(bx, hw));
+    __m128 cy = _mm_min_ps(_mm_max_ps(sy, _mm_sub_ps(by, hh)), _mm_add_ps(by, hh));
+    __m128 cz = _mm_min_ps(_mm_max_ps(sz, _mm_sub_ps(bz, hd)), _mm_add_ps(bz, hd));
+
+    __m128 dx = _mm_sub_ps(sx, cx);
+    __m128 dy = _mm_sub_ps(sy, cy);
+    __m128 dz = _mm_sub_ps(sz, cz);
+    __m128 distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)),
+                               _mm_mul_ps(dz, dz));
+    __m128 r = _mm_load_ps(in.sr);
+    __m128 hit = _mm_cmplt_ps(distSq, _mm_mul_ps(r, r));
+    return static_cast<uint32_t>(_mm_movemask_ps(hit));
+}
+
+#else
+
+[[nodiscard]] inline uint32_t SphereSphere4(const SphereSphereBatch& in) noexcept
+{
+    return SphereSphere4Reference(in);
+}
+
+[[nodiscard]] inline uint32_t SphereBox4(const SphereBoxBatch& in) noexcept
+{
+    return SphereBox4Reference(in);
+}
+
+#endif
+
+} // namespace Narrowphase3D
@@ -0,0 +1,733 @@
+//----------------------------------------------------------------------------
+//! @file   collision_world.h
+//! @brief  次元共通の衝突判定コア（CollisionManager / CollisionManager3D の基底）
+//!
+//! @details
+//! 2Dと3Dのマネージャーで重複していた以下の処理をテンプレートにまとめる。
+//! - ハンドルテーブル（世代・フリーリスト）と形状に依存しないSoA
+//!   （レイヤー・マスク・フラグ・コライダー参照・コールバック）
+//! - 一様グリッドのブロードフェーズ（セル範囲の登録、セル内ペア列挙、DDA走査）
+//! - 接触ペアの差分（Enter/Stay/Exit）とイベントストリーム、コールバック配信
+//! - 固定タイムステップの駆動
+//!
+//! 位置・サイズなどの形状データとナローフェーズは次元ごとに異なるため
+//! 派生クラス側が持ち、ペア列挙の判定関数としてコンパイル時に渡す
+//! （2DはAABBのインライン判定、3DはNarrowphase3Dのバッチ判定）。
+//!
+//! @tparam Dim 次元（2 または 3）
+//! @tparam ColliderT コライダーコンポーネント型
+//! @tparam HandleT ハンドル型（index / generation を持つ）
+//!
+//! @note スレッドセーフではない。メインスレッドからのみ呼び出すこと。
+//----------------------------------------------------------------------------
+#pragma once
+
+#include "common/utility/non_copyable.h"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+//============================================================================
+// 定数定義（2D/3D共通）
+//============================================================================
+namespace CollisionWorldConstants {
+    static constexpr uint16_t kInvalidIndex = UINT16_MAX;   //!< 無効なインデックス
+    static constexpr uint8_t kDefaultLayer = 0x01;          //!< デフォルトレイヤー
+    static constexpr uint8_t kDefaultMask = 0xFF;           //!< デフォルトマスク（全レイヤーと衝突）
+}
+
+//============================================================================
+//! @brief 衝突イベント種別
+//============================================================================
+enum class CollisionEventType : uint8_t {
+    Enter,  //!< 衝突開始
+    Stay,   //!< 衝突継続
+    Exit    //!< 衝突終了
+};
+
+//============================================================================
+//! @brief 衝突ペアイベント（イベントストリームの要素）
+//!
+//! 種別ごとの連続配列に格納され、GetEvents()で読み出す。
+//! ハンドルは世代を含むため、読み出し時点で削除済みのコライダーは
+//! IsValid()で検出できる。
+//!
+//! @note aはレイヤー値の小さい側（同じレイヤーならインデックスの小さい側）
+//============================================================================
+template<typename HandleT>
+struct BasicCollisionPairEvent {
+    HandleT a;                      //!< コライダーA
+    HandleT b;                      //!< コライダーB
+    uint8_t layerA = 0;             //!< イベント発生時のAのレイヤー
+    uint8_t layerB = 0;             //!< イベント発生時のBのレイヤー
+
+    //! @brief レイヤーペアキーを取得（ソート・絞り込み用）
+    [[nodiscard]] uint16_t GetLayerPairKey() const noexcept {
+        return static_cast<uint16_t>((static_cast<uint16_t>(layerA) << 8) | layerB);
+    }
+};
+
+//============================================================================
+//! @brief 次元共通の衝突判定コア
+//============================================================================
+template<int Dim, typename ColliderT, typename HandleT>
+class CollisionWorld : private NonCopyableNonMovable {
+    static_assert(Dim == 2 || Dim == 3, "CollisionWorld supports 2D and 3D only");
+
+public:
+    using Callback = std::function<void(ColliderT*, ColliderT*)>;
+    using PairEvent = BasicCollisionPairEvent<HandleT>;
+
+    //------------------------------------------------------------------------
+    // ハンドル
+    //------------------------------------------------------------------------
+
+    //! @brief ハンドルが有効か確認
+    [[nodiscard]] bool IsValid(HandleT handle) const noexcept {
+        if (handle.index >= generations_.size()) return false;
+        return generations_[handle.index] == handle.generation &&
+               colliders_[handle.index] != nullptr;
+    }
+
+    //------------------------------------------------------------------------
+    // データ設定（形状に依存しないもの）
+    //------------------------------------------------------------------------
+
+    void SetLayer(HandleT handle, uint8_t layer) {
+        if (!IsValid(handle)) return;
+        layer_[handle.index] = layer;
+    }
+
+    void SetMask(HandleT handle, uint8_t mask) {
+        if (!IsValid(handle)) return;
+        mask_[handle.index] = mask;
+    }
+
+    void SetEnabled(HandleT handle, bool enabled) {
+        if (!IsValid(handle)) return;
+        if (enabled) {
+            flags_[handle.index] |= kFlagEnabled;
+        } else {
+            flags_[handle.index] &= ~kFlagEnabled;
+        }
+    }
+
+    void SetTrigger(HandleT handle, bool trigger) {
+        if (!IsValid(handle)) return;
+        if (trigger) {
+            flags_[handle.index] |= kFlagTrigger;
+        } else {
+            flags_[handle.index] &= ~kFlagTrigger;
+        }
+    }
+
+    void SetOnCollision(HandleT handle, Callback cb) {
+        if (!IsValid(handle)) return;
+        onCollision_[handle.index] = std::move(cb);
+    }
+
+    void SetOnCollisionEnter(HandleT handle, Callback cb) {
+        if (!IsValid(handle)) return;
+        onEnter_[handle.index] = std::move(cb);
+    }
+
+    void SetOnCollisionExit(HandleT handle, Callback cb) {
+        if (!IsValid(handle)) return;
+        onExit_[handle.index] = std::move(cb);
+    }
+
+    //------------------------------------------------------------------------
+    // データ取得（形状に依存しないもの）
+    //------------------------------------------------------------------------
+
+    [[nodiscard]] uint8_t GetLayer(HandleT handle) const {
+        return IsValid(handle) ? layer_[handle.index] : uint8_t(0);
+    }
+
+    [[nodiscard]] uint8_t GetMask(HandleT handle) const {
+        return IsValid(handle) ? mask_[handle.index] : uint8_t(0);
+    }
+
+    [[nodiscard]] bool IsEnabled(HandleT handle) const {
+        return IsValid(handle) && (flags_[handle.index] & kFlagEnabled) != 0;
+    }
+
+    [[nodiscard]] bool IsTrigger(HandleT handle) const {
+        return IsValid(handle) && (flags_[handle.index] & kFlagTrigger) != 0;
+    }
+
+    [[nodiscard]] ColliderT* GetCollider(HandleT handle) const {
+        return IsValid(handle) ? colliders_[handle.index] : nullptr;
+    }
+
+    //------------------------------------------------------------------------
+    // 統計・設定
+    //------------------------------------------------------------------------
+
+    [[nodiscard]] size_t GetColliderCount() const noexcept { return activeCount_; }
+    [[nodiscard]] int GetCellSize() const noexcept { return cellSize_; }
+
+    //! @brief 固定タイムステップの間隔を取得
+    [[nodiscard]] static constexpr float GetFixedDeltaTime() noexcept { return kFixedDeltaTime; }
+
+    //! @brief 直近の固定ステップで接触していたペア（昇順のペアキー）
+    //! @note 上位16bitが小さい方のインデックス、下位16bitが大きい方
+    [[nodiscard]] std::span<const uint32_t> GetContactPairs() const noexcept { return currentPairs_; }
+
+    //------------------------------------------------------------------------
+    // イベントストリーム（プルAPI）
+    //------------------------------------------------------------------------
+
+    //! @brief 直近のUpdate()で発生した衝突イベントを取得
+    //! @param type イベント種別
+    //! @return イベント配列（次のUpdate()まで有効）
+    //! @note 1回のUpdate()で複数の固定ステップが走った場合は全ステップ分を含む。
+    //!       レイヤーペア順にソート済み（同一キー内は発生順）。
+    [[nodiscard]] std::span<const PairEvent> GetEvents(CollisionEventType type) const noexcept {
+        return events_[static_cast<size_t>(type)];
+    }
+
+    //! @brief レイヤーペアで絞り込んだ衝突イベントを取得
+    //! @param type イベント種別
+    //! @param layerA 一方のレイヤー
+    //! @param layerB もう一方のレイヤー（順不同）
+    //! @return 該当イベントの連続範囲（各要素のaはレイヤー値の小さい側）
+    [[nodiscard]] std::span<const PairEvent> GetEvents(
+        CollisionEventType type, uint8_t layerA, uint8_t layerB) const noexcept
+    {
+        const auto& stream = events_[static_cast<size_t>(type)];
+        const uint16_t key = MakeLayerPairKey(layerA, layerB);
+
+        // Update()でレイヤーペア順に整列済み
+        auto first = std::lower_bound(stream.begin(), stream.end(), key,
+            [](const PairEvent& e, uint16_t k) { return e.GetLayerPairKey() < k; });
+        auto last = std::upper_bound(first, stream.end(), key,
+            [](uint16_t k, const PairEvent& e) { return k < e.GetLayerPairKey(); });
+
+        return std::span<const PairEvent>(first, last);
+    }
+
+protected:
+    CollisionWorld() = default;
+    ~CollisionWorld() = default;
+
+    //------------------------------------------------------------------------
+    // グリッドセル
+    //------------------------------------------------------------------------
+
+    using Cell = std::array<int, Dim>;
+
+    [[nodiscard]] static constexpr Cell MakeCell(int value) noexcept {
+        Cell cell{};
+        cell.fill(value);
+        return cell;
+    }
+
+    struct CellHash {
+        size_t operator()(const Cell& c) const noexcept {
+            size_t seed = std::hash<int>{}(c[0]);
+            for (int axis = 1; axis < Dim; ++axis) {
+                seed ^= std::hash<int>{}(c[axis]) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            }
+            return seed;
+        }
+    };
+
+    //------------------------------------------------------------------------
+    // スロット管理
+    //------------------------------------------------------------------------
+
+    //! @brief スロットを確保して共通データを既定値で初期化
+    //! @return インデックス（上限超過時はkInvalidIndex）
+    //! @note 形状データの配列はGetSlotCount()に合わせて派生クラスが拡張する
+    [[nodiscard]] uint16_t AllocateSlot(ColliderT* collider)
+    {
+        uint16_t index;
+        if (!freeIndices_.empty()) {
+            index = freeIndices_.back();
+            freeIndices_.pop_back();
+        } else {
+            // オーバーフローチェック
+            if (colliders_.size() >= CollisionWorldConstants::kInvalidIndex) {
+                assert(false && "Collider index overflow: too many colliders");
+                return CollisionWorldConstants::kInvalidIndex;
+            }
+            index = static_cast<uint16_t>(colliders_.size());
+            layer_.push_back(0);
+            mask_.push_back(0);
+            flags_.push_back(0);
+            colliders_.push_back(nullptr);
+            onCollision_.emplace_back();
+            onEnter_.emplace_back();
+            onExit_.emplace_back();
+            generations_.push_back(0);
+        }
+
+        layer_[index] = CollisionWorldConstants::kDefaultLayer;
+        mask_[index] = CollisionWorldConstants::kDefaultMask;
+        flags_[index] = kFlagEnabled;
+        colliders_[index] = collider;
+        ++activeCount_;
+        return index;
+    }
+
+    //! @brief スロットを解放（世代を進めて古いハンドルを無効化）
+    void FreeSlot(uint16_t index)
+    {
+        ++generations_[index];
+        colliders_[index] = nullptr;
+        onCollision_[index] = nullptr;
+        onEnter_[index] = nullptr;
+        onExit_[index] = nullptr;
+        flags_[index] = 0;
+        freeIndices_.push_back(index);
+        --activeCount_;
+    }
+
+    [[nodiscard]] HandleT MakeHandle(uint16_t index) const noexcept {
+        HandleT handle;
+        handle.index = index;
+        handle.generation = generations_[index];
+        return handle;
+    }
+
+    //! @brief 確保済みスロット数（解放済みを含む）
+    [[nodiscard]] size_t GetSlotCount() const noexcept { return colliders_.size(); }
+
+    //! @brief 共通データ・グリッド・ペア・イベントを全て破棄
+    void ClearWorld()
+    {
+        layer_.clear();
+        mask_.clear();
+        flags_.clear();
+        colliders_.clear();
+        onCollision_.clear();
+        onEnter_.clear();
+        onExit_.clear();
+        generations_.clear();
+        freeIndices_.clear();
+        activeCount_ = 0;
+        grid_.clear();
+        gridMinCell_ = MakeCell(0);
+        gridMaxCell_ = MakeCell(-1);
+        previousPairs_.clear();
+        currentPairs_.clear();
+        candidatePairs_.clear();
+        for (auto& stream : events_) {
+            stream.clear();
+        }
+        stepEventBegin_ = {};
+        processingEvents_ = false;
+    }
+
+    //! @brief 有効なコライダーか（グリッド登録・ツリー登録の対象）
+    [[nodiscard]] bool IsActiveSlot(size_t i) const noexcept {
+        return (flags_[i] & kFlagEnabled) != 0 && colliders_[i] != nullptr;
+    }
+
+    [[nodiscard]] static uint32_t MakePairKey(uint16_t a, uint16_t b) noexcept {
+        if (a > b) { uint16_t t = a; a = b; b = t; }
+        return (static_cast<uint32_t>(a) << 16) | b;
+    }
+    [[nodiscard]] static uint16_t GetFirstIndex(uint32_t key) noexcept {
+        return static_cast<uint16_t>(key >> 16);
+    }
+    [[nodiscard]] static uint16_t GetSecondIndex(uint32_t key) noexcept {
+        return static_cast<uint16_t>(key & 0xFFFF);
+    }
+    [[nodiscard]] static uint16_t MakeLayerPairKey(uint8_t a, uint8_t b) noexcept {
+        if (a > b) { uint8_t t = a; a = b; b = t; }
+        return static_cast<uint16_t>((static_cast<uint16_t>(a) << 8) | b);
+    }
+
+    //------------------------------------------------------------------------
+    // 固定タイムステップ
+    //------------------------------------------------------------------------
+
+    //! @brief 前回分のイベントを破棄し、溜まった時間だけ固定ステップを実行
+    //! @param fixedStep void() 1固定ステップ分の処理（BeginStep〜EndStepを含む）
+    template<typename FixedStep>
+    void AdvanceFixedSteps(float deltaTime, FixedStep&& fixedStep)
+    {
+        // 前回Update()分のイベントストリームを破棄
+        for (auto& stream : events_) {
+            stream.clear();
+        }
+
+        accumulator_ += deltaTime;
+
+        bool stepped = false;
+        while (accumulator_ >= kFixedDeltaTime) {
+            fixedStep();
+            accumulator_ -= kFixedDeltaTime;
+            stepped = true;
+        }
+
+        // レイヤーペア順に整列（stableなので同一キー内はステップ順・ペア順を維持）
+        if (stepped) {
+            for (auto& stream : events_) {
+                std::stable_sort(stream.begin(), stream.end(),
+                    [](const PairEvent& lhs, const PairEvent& rhs) {
+                        return lhs.GetLayerPairKey() < rhs.GetLayerPairKey();
+                    });
+            }
+        }
+    }
+
+    //! @brief 固定ステップ開始（ペア入れ替え、イベント開始位置の記録）
+    void BeginStep()
+    {
+        for (size_t t = 0; t < kEventTypeCount; ++t) {
+            stepEventBegin_[t] = events_[t].size();
+        }
+        std::swap(previousPairs_, currentPairs_);
+        currentPairs_.clear();
+        candidatePairs_.clear();
+    }
+
+    //! @brief 固定ステップ終了（currentPairs_を確定し、差分をイベント化して配信）
+    void EndStep()
+    {
+        // ソート + 重複削除（バッチ判定や複数セルで順序・重複が生じるため）
+        std::sort(currentPairs_.begin(), currentPairs_.end());
+        currentPairs_.erase(
+            std::unique(currentPairs_.begin(), currentPairs_.end()),
+            currentPairs_.end()
+        );
+
+        DiffPairs();
+
+        // 衝突検出完了後にイベントを処理
+        ProcessEventQueue();
+    }
+
+    //------------------------------------------------------------------------
+    // グリッド
+    //------------------------------------------------------------------------
+
+    //! @brief ワールド座標をセル座標へ変換
+    [[nodiscard]] Cell ToCell(const float (&p)[Dim]) const noexcept
+    {
+        const float cs = static_cast<float>(cellSize_);
+        Cell cell;
+        for (int axis = 0; axis < Dim; ++axis) {
+            cell[axis] = static_cast<int>(std::floor(p[axis] / cs));
+        }
+        return cell;
+    }
+
+    //! @brief [c0, c1]の全セルを列挙
+    //! @param visit void(const Cell&)
+    template<typename Visitor>
+    static void ForEachCell(const Cell& c0, const Cell& c1, Visitor&& visit)
+    {
+        if constexpr (Dim == 2) {
+            for (int cy = c0[1]; cy <= c1[1]; ++cy) {
+                for (int cx = c0[0]; cx <= c1[0]; ++cx) {
+                    visit(Cell{cx, cy});
+                }
+            }
+        } else {
+            for (int cx = c0[0]; cx <= c1[0]; ++cx) {
+                for (int cy = c0[1]; cy <= c1[1]; ++cy) {
+                    for (int cz = c0[2]; cz <= c1[2]; ++cz) {
+                        visit(Cell{cx, cy, cz});
+                    }
+                }
+            }
+        }
+    }
+
+    //! @brief 有効な全コライダーをグリッドへ登録し直す
+    //! @param cellRange void(uint16_t index, Cell& c0, Cell& c1) 占有セル範囲を返す
+    template<typename CellRange>
+    void RebuildGrid(CellRange&& cellRange)
+    {
+        for (auto& [cell, indices] : grid_) {
+            indices.clear();
+        }
+
+        gridMinCell_ = MakeCell(INT_MAX);
+        gridMaxCell_ = MakeCell(INT_MIN);
+
+        const size_t count = colliders_.size();
+        for (size_t i = 0; i < count; ++i) {
+            // ホットデータ(flags_)を先にチェックしてキャッシュ効率向上
+            if (!IsActiveSlot(i)) continue;
+
+            Cell c0, c1;
+            cellRange(static_cast<uint16_t>(i), c0, c1);
+
+            for (int axis = 0; axis < Dim; ++axis) {
+                gridMinCell_[axis] = (std::min)(gridMinCell_[axis], c0[axis]);
+                gridMaxCell_[axis] = (std::max)(gridMaxCell_[axis], c1[axis]);
+            }
+
+            ForEachCell(c0, c1, [&](const Cell& cell) {
+                grid_[cell].push_back(static_cast<uint16_t>(i));
+            });
+        }
+    }
+
+    //! @brief 同じセルに入っているペアを列挙（昇順・重複なしでoutへ追加）
+    //! @param accept bool(uint16_t a, uint16_t b) レイヤー判定・形状判定
+    //! @note 無効なコライダーは事前に除外される
+    template<typename Accept>
+    void CollectGridPairs(Accept&& accept, std::vector<uint32_t>& out) const
+    {
+        const size_t begin = out.size();
+        for (const auto& [cell, indices] : grid_) {
+            const size_t count = indices.size();
+            if (count < 2) continue;
+
+            for (size_t i = 0; i + 1 < count; ++i) {
+                uint16_t idxA = indices[i];
+                if ((flags_[idxA] & kFlagEnabled) == 0) continue;
+
+                for (size_t j = i + 1; j < count; ++j) {
+                    uint16_t idxB = indices[j];
+                    if ((flags_[idxB] & kFlagEnabled) == 0) continue;
+
+                    if (accept(idxA, idxB)) {
+                        out.push_back(MakePairKey(idxA, idxB));
+                    }
+                }
+            }
+        }
+
+        // 複数セルにまたがるペアの重複を除去（まとめて処理）
+        std::sort(out.begin() + begin, out.end());
+        out.erase(std::unique(out.begin() + begin, out.end()), out.end());
+    }
+
+    //! @brief 半直線が通過するセルを始点側から順に列挙（Amanatides–Woo）
+    //! @param origin 始点
+    //! @param dir 方向（tの単位はdirの長さ）
+    //! @param tEnd 走査するパラメータの上限
+    //! @param visit bool(const std::vector<uint16_t>& indices, float tExit)
+    //!        tExitはセルを出るパラメータ。falseで打ち切り
+    template<typename Visitor>
+    void TraverseGrid(const float (&origin)[Dim], const float (&dir)[Dim], float tEnd,
+                      Visitor&& visit) const
+    {
+        for (int axis = 0; axis < Dim; ++axis) {
+            if (gridMinCell_[axis] > gridMaxCell_[axis]) return;
+        }
+
+        const float cs = static_cast<float>(cellSize_);
+
+        // 占有範囲の外側（tEndが巨大な場合を含む）を走らないようクリップ
+        float t0 = 0.0f;
+        float t1 = tEnd;
+        for (int axis = 0; axis < Dim; ++axis) {
+            float lo = static_cast<float>(gridMinCell_[axis]) * cs;
+            float hi = static_cast<float>(gridMaxCell_[axis] + 1) * cs;
+            if (std::abs(dir[axis]) < 1e-8f) {
+                if (origin[axis] < lo || origin[axis] > hi) return;
+                continue;
+            }
+            float ta = (lo - origin[axis]) / dir[axis];
+            float tb = (hi - origin[axis]) / dir[axis];
+            if (ta > tb) std::swap(ta, tb);
+            t0 = (std::max)(t0, ta);
+            t1 = (std::min)(t1, tb);
+            if (t0 > t1) return;
+        }
+
+        float p0[Dim];
+        float p1[Dim];
+        for (int axis = 0; axis < Dim; ++axis) {
+            p0[axis] = origin[axis] + dir[axis] * t0;
+            p1[axis] = origin[axis] + dir[axis] * t1;
+        }
+        Cell cell = ToCell(p0);
+        Cell last = ToCell(p1);
+
+        // 各軸で次のセル境界に達するパラメータと、1セル進むのに要するパラメータ
+        constexpr float kInf = std::numeric_limits<float>::infinity();
+        int step[Dim];
+        float tMax[Dim];
+        float tDelta[Dim];
+        int steps = 0;
+        for (int axis = 0; axis < Dim; ++axis) {
+            cell[axis] = (std::max)(gridMinCell_[axis], (std::min)(gridMaxCell_[axis], cell[axis]));
+            last[axis] = (std::max)(gridMinCell_[axis], (std::min)(gridMaxCell_[axis], last[axis]));
+
+            step[axis] = dir[axis] > 0.0f ? 1 : (dir[axis] < 0.0f ? -1 : 0);
+            if (step[axis] == 0) {
+                tMax[axis] = kInf;
+                tDelta[axis] = kInf;
+            } else {
+                float boundary = static_cast<float>(step[axis] > 0 ? cell[axis] + 1 : cell[axis]) * cs;
+                tMax[axis] = (boundary - origin[axis]) / dir[axis];
+                tDelta[axis] = cs / std::abs(dir[axis]);
+            }
+            steps += std::abs(last[axis] - cell[axis]);
+        }
+
+        for (int i = 0; ; ++i) {
+            float tExit = t1;
+            for (int axis = 0; axis < Dim; ++axis) {
+                tExit = (std::min)(tExit, tMax[axis]);
+            }
+
+            auto it = grid_.find(cell);
+            if (it != grid_.end() && !it->second.empty()) {
+                if (!visit(it->second, tExit)) return;
+            }
+            if (i >= steps) return;
+
+            // 境界に最も早く達する軸を進める
+            // （丸め誤差で終点セルを通り過ぎないよう、到達済みの軸は進めない）
+            int axis = -1;
+            for (int a = 0; a < Dim; ++a) {
+                if (cell[a] == last[a]) continue;
+                if (axis < 0 || tMax[a] < tMax[axis]) axis = a;
+            }
+            cell[axis] += step[axis];
+            tMax[axis] += tDelta[axis];
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // Structure of Arrays（SoA）- 形状に依存しないデータ
+    //------------------------------------------------------------------------
+
+    // ホットデータ
+    std::vector<uint8_t> layer_;        //!< レイヤー
+    std::vector<uint8_t> mask_;         //!< マスク
+    std::vector<uint8_t> flags_;        //!< enabled(bit0), trigger(bit1), 派生クラス定義(bit2〜)
+
+    // コールドデータ（イベント発火時のみ）
+    std::vector<ColliderT*> colliders_;
+    std::vector<Callback> onCollision_;
+    std::vector<Callback> onEnter_;
+    std::vector<Callback> onExit_;
+
+    // 世代管理・フリーリスト
+    std::vector<uint16_t> generations_;
+    std::vector<uint16_t> freeIndices_;
+    size_t activeCount_ = 0;
+
+    // 空間ハッシュグリッド
+    int cellSize_ = 0;
+    std::unordered_map<Cell, std::vector<uint16_t>, CellHash> grid_;
+    Cell gridMinCell_ = MakeCell(0);    //!< 占有セル範囲（レイ走査のクリップ用）
+    Cell gridMaxCell_ = MakeCell(-1);   //!< min > max なら空
+
+    // 衝突ペア（ソート済み）
+    std::vector<uint32_t> previousPairs_;
+    std::vector<uint32_t> currentPairs_;
+    std::vector<uint32_t> candidatePairs_;  //!< ナローフェーズ前の候補（派生クラスが使用）
+
+    // フラグビット定義
+    static constexpr uint8_t kFlagEnabled = 0x01;
+    static constexpr uint8_t kFlagTrigger = 0x02;
+
+    // 固定タイムステップ
+    static constexpr float kFixedDeltaTime = 1.0f / 60.0f;  //!< 60Hz
+    float accumulator_ = 0.0f;
+
+    // クエリ用バッファ（再利用でアロケーション削減）
+    mutable std::vector<uint16_t> queryBuffer_;
+
+private:
+    //! @brief previousPairs_とcurrentPairs_をマージ比較してイベントを追加
+    void DiffPairs()
+    {
+        size_t prevIdx = 0, currIdx = 0;
+        const size_t prevSize = previousPairs_.size();
+        const size_t currSize = currentPairs_.size();
+
+        while (prevIdx < prevSize || currIdx < currSize) {
+            uint32_t prevKey = prevIdx < prevSize ? previousPairs_[prevIdx] : UINT32_MAX;
+            uint32_t currKey = currIdx < currSize ? currentPairs_[currIdx] : UINT32_MAX;
+
+            if (prevKey < currKey) {
+                // Exit
+                PushEvent(CollisionEventType::Exit, prevKey);
+                ++prevIdx;
+            } else if (currKey < prevKey) {
+                // Enter + Stay
+                PushEvent(CollisionEventType::Enter, currKey);
+                PushEvent(CollisionEventType::Stay, currKey);
+                ++currIdx;
+            } else {
+                // Stay
+                PushEvent(CollisionEventType::Stay, currKey);
+                ++prevIdx;
+                ++currIdx;
+            }
+        }
+    }
+
+    //! @brief ペアイベントをストリームに追加
+    void PushEvent(CollisionEventType type, uint32_t pairKey)
+    {
+        uint16_t a = GetFirstIndex(pairKey);
+        uint16_t b = GetSecondIndex(pairKey);
+
+        // レイヤー値の小さい側をaに正規化（レイヤーペアでの絞り込み用）
+        if (layer_[b] < layer_[a]) std::swap(a, b);
+
+        events_[static_cast<size_t>(type)].push_back({
+            MakeHandle(a), MakeHandle(b), layer_[a], layer_[b]
+        });
+    }
+
+    //! @brief 現ステップで追加されたイベントをコールバックへ配信
+    //! @note 世代チェックによりコールバック中に削除されたコライダーは安全にスキップされる。
+    void ProcessEventQueue()
+    {
+        // 再入防止（コールバック内でUpdate()が呼ばれた場合を防ぐ）
+        if (processingEvents_) return;
+        processingEvents_ = true;
+
+        // 種別ごとにまとめて配信
+        DispatchCallbacks(CollisionEventType::Enter, onEnter_);
+        DispatchCallbacks(CollisionEventType::Stay, onCollision_);
+        DispatchCallbacks(CollisionEventType::Exit, onExit_);
+
+        processingEvents_ = false;
+    }
+
+    //! @brief 1種別分のイベントをコールバックへ配信
+    void DispatchCallbacks(CollisionEventType type, const std::vector<Callback>& callbacks)
+    {
+        const auto& stream = events_[static_cast<size_t>(type)];
+
+        // コールバック内の操作でストリームが変化しても安全なようにサイズを毎回確認
+        for (size_t i = stepEventBegin_[static_cast<size_t>(type)]; i < stream.size(); ++i) {
+            const PairEvent evt = stream[i];
+
+            // 世代チェック（コールバック中に削除された場合をスキップ）
+            if (!IsValid(evt.a) || !IsValid(evt.b)) continue;
+
+            uint16_t ia = evt.a.index;
+            uint16_t ib = evt.b.index;
+
+            // 1つ目のコールバックを発火
+            if (callbacks[ia]) callbacks[ia](colliders_[ia], colliders_[ib]);
+
+            // 1つ目のコールバック内でA/Bが削除された可能性があるため再検証
+            if (!IsValid(evt.a) || !IsValid(evt.b)) continue;
+
+            // 2つ目のコールバックを発火
+            if (callbacks[ib]) callbacks[ib](colliders_[ib], colliders_[ia]);
+        }
+    }
+
+    // イベントストリーム（種別ごと、Update()単位で蓄積）
+    static constexpr size_t kEventTypeCount = 3;
+    std::array<std::vector<PairEvent>, kEventTypeCount> events_;
+    std::array<size_t, kEventTypeCount> stepEventBegin_ = {};  //!< 現ステップの開始位置（コールバック配信用）
+    bool processingEvents_ = false;  //!< 再入防止フラグ
+};
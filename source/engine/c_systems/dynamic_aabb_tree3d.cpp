@@ -0,0 +1,353 @@
+//----------------------------------------------------------------------------
+//! @file   dynamic_aabb_tree3d.cpp
+//! @brief  3D動的AABBツリー実装
+//----------------------------------------------------------------------------
+#include "dynamic_aabb_tree3d.h"
+#include <cmath>
+
+//----------------------------------------------------------------------------
+int32_t DynamicAABBTree3D::CreateProxy(const AABB3D& aabb, uint16_t userIndex)
+{
+    int32_t id = AllocateNode();
+    nodes_[id].aabb = Fatten(aabb);
+    nodes_[id].userIndex = userIndex;
+    nodes_[id].height = 0;
+    InsertLeaf(id);
+    ++proxyCount_;
+    return id;
+}
+
+//----------------------------------------------------------------------------
+void DynamicAABBTree3D::DestroyProxy(int32_t proxyId)
+{
+    assert(proxyId >= 0 && proxyId < static_cast<int32_t>(nodes_.size()));
+    assert(nodes_[proxyId].IsLeaf());
+
+    RemoveLeaf(proxyId);
+    FreeNode(proxyId);
+    --proxyCount_;
+}
+
+//----------------------------------------------------------------------------
+bool DynamicAABBTree3D::MoveProxy(int32_t proxyId, const AABB3D& aabb)
+{
+    assert(proxyId >= 0 && proxyId < static_cast<int32_t>(nodes_.size()));
+    assert(nodes_[proxyId].IsLeaf());
+
+    if (Contains(nodes_[proxyId].aabb, aabb)) {
+        return false;
+    }
+
+    RemoveLeaf(proxyId);
+    nodes_[proxyId].aabb = Fatten(aabb);
+    InsertLeaf(proxyId);
+    return true;
+}
+
+//----------------------------------------------------------------------------
+void DynamicAABBTree3D::Clear()
+{
+    nodes_.clear();
+    root_ = kNullNode;
+    freeList_ = kNullNode;
+    proxyCount_ = 0;
+}
+
+//----------------------------------------------------------------------------
+int32_t DynamicAABBTree3D::AllocateNode()
+{
+    if (freeList_ != kNullNode) {
+        int32_t id = freeList_;
+        freeList_ = nodes_[id].parent;
+        nodes_[id] = Node();
+        return id;
+    }
+
+    nodes_.emplace_back();
+    return static_cast<int32_t>(nodes_.size() - 1);
+}
+
+//----------------------------------------------------------------------------
+void DynamicAABBTree3D::FreeNode(int32_t id)
+{
+    nodes_[id].parent = freeList_;
+    nodes_[id].height = -1;
+    freeList_ = id;
+}
+
+//----------------------------------------------------------------------------
+void DynamicAABBTree3D::InsertLeaf(int32_t leaf)
+{
+    if (root_ == kNullNode) {
+        root_ = leaf;
+        nodes_[leaf].parent = kNullNode;
+        return;
+    }
+
+    // 表面積の増分が最小になる兄弟を探す
+    AABB3D leafAABB = nodes_[leaf].aabb;
+    int32_t index = root_;
+    while (!nodes_[index].IsLeaf()) {
+        const Node& node = nodes_[index];
+        float area = SurfaceArea(node.aabb);
+        float combinedArea = SurfaceArea(Union(node.aabb, leafAABB));
+
+        // ここに新しい親を作るコスト
+        float cost = 2.0f * combinedArea;
+        // さらに下へ進む場合に祖先が広がるコスト
+        float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto descendCost = [&](int32_t child) {
+            const Node& c = nodes_[child];
+            float unionArea = SurfaceArea(Union(leafAABB, c.aabb));
+            return c.IsLeaf() ? unionArea + inheritanceCost
+                              : unionArea - SurfaceArea(c.aabb) + inheritanceCost;
+        };
+        float cost1 = descendCost(node.child1);
+        float cost2 = descendCost(node.child2);
+
+        if (cost < cost1 && cost < cost2) break;
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+
+    // 兄弟と新しい葉をまとめる親を作成
+    int32_t sibling = index;
+    int32_t newParent = AllocateNode();
+    int32_t oldParent = nodes_[sibling].parent;
+    nodes_[newParent].parent = oldParent;
+    nodes_[newParent].aabb = Union(leafAABB, nodes_[sibling].aabb);
+    nodes_[newParent].height = nodes_[sibling].height + 1;
+    nodes_[newParent].child1 = sibling;
+    nodes_[newParent].child2 = leaf;
+    nodes_[sibling].parent = newParent;
+    nodes_[leaf].parent = newParent;
+
+    if (oldParent != kNullNode) {
+        if (nodes_[oldParent].child1 == sibling) {
+            nodes_[oldParent].child1 = newParent;
+        } else {
+            nodes_[oldParent].child2 = newParent;
+        }
+    } else {
+        root_ = newParent;
+    }
+
+    Refit(nodes_[leaf].parent);
+}
+
+//----------------------------------------------------------------------------
+void DynamicAABBTree3D::RemoveLeaf(int32_t leaf)
+{
+    if (leaf == root_) {
+        root_ = kNullNode;
+        return;
+    }
+
+    int32_t parent = nodes_[leaf].parent;
+    int32_t grandParent = nodes_[parent].parent;
+    int32_t sibling = nodes_[parent].child1 == leaf ? nodes_[parent].child2 : nodes_[parent].child1;
+
+    if (grandParent != kNullNode) {
+        // 親を兄弟で置き換える
+        if (nodes_[grandParent].child1 == parent) {
+            nodes_[grandParent].child1 = sibling;
+        } else {
+            nodes_[grandParent].child2 = sibling;
+        }
+        nodes_[sibling].parent = grandParent;
+        FreeNode(parent);
+        Refit(grandParent);
+    } else {
+        root_ = sibling;
+        nodes_[sibling].parent = kNullNode;
+        FreeNode(parent);
+    }
+}
+
+//----------------------------------------------------------------------------
+void DynamicAABBTree3D::Refit(int32_t id)
+{
+    // 根まで遡りながら回転・AABB・高さを更新
+    while (id != kNullNode) {
+        id = Balance(id);
+
+        Node& node = nodes_[id];
+        const Node& c1 = nodes_[node.child1];
+        const Node& c2 = nodes_[node.child2];
+        node.height = 1 + (c1.height > c2.height ? c1.height : c2.height);
+        node.aabb = Union(c1.aabb, c2.aabb);
+
+        id = node.parent;
+    }
+}
+
+//----------------------------------------------------------------------------
+int32_t DynamicAABBTree3D::Balance(int32_t iA)
+{
+    Node& A = nodes_[iA];
+    if (A.IsLeaf() || A.height < 2) {
+        return iA;
+    }
+
+    int32_t iB = A.child1;
+    int32_t iC = A.child2;
+    Node& B = nodes_[iB];
+    Node& C = nodes_[iC];
+    int32_t balance = C.height - B.height;
+
+    auto replaceChild = [&](int32_t parent, int32_t oldChild, int32_t newChild) {
+        if (parent == kNullNode) {
+            root_ = newChild;
+        } else if (nodes_[parent].child1 == oldChild) {
+            nodes_[parent].child1 = newChild;
+        } else {
+            nodes_[parent].child2 = newChild;
+        }
+    };
+    auto maxHeight = [](int32_t a, int32_t b) { return a > b ? a : b; };
+
+    // Cを持ち上げる
+    if (balance > 1) {
+        int32_t iF = C.child1;
+        int32_t iG = C.child2;
+        Node& F = nodes_[iF];
+        Node& G = nodes_[iG];
+
+        C.child1 = iA;
+        C.parent = A.parent;
+        A.parent = iC;
+        replaceChild(C.parent, iA, iC);
+
+        if (F.height > G.height) {
+            C.child2 = iF;
+            A.child2 = iG;
+            G.parent = iA;
+            A.aabb = Union(B.aabb, G.aabb);
+            C.aabb = Union(A.aabb, F.aabb);
+            A.height = 1 + maxHeight(B.height, G.height);
+            C.height = 1 + maxHeight(A.height, F.height);
+        } else {
+            C.child2 = iG;
+            A.child2 = iF;
+            F.parent = iA;
+            A.aabb = Union(B.aabb, F.aabb);
+            C.aabb = Union(A.aabb, G.aabb);
+            A.height = 1 + maxHeight(B.height, F.height);
+            C.height = 1 + maxHeight(A.height, G.height);
+        }
+        return iC;
+    }
+
+    // Bを持ち上げる
+    if (balance < -1) {
+        int32_t iD = B.child1;
+        int32_t iE = B.child2;
+        Node& D = nodes_[iD];
+        Node& E = nodes_[iE];
+
+        B.child1 = iA;
+        B.parent = A.parent;
+        A.parent = iB;
+        replaceChild(B.parent, iA, iB);
+
+        if (D.height > E.height) {
+            B.child2 = iD;
+            A.child1 = iE;
+            E.parent = iA;
+            A.aabb = Union(C.aabb, E.aabb);
+            B.aabb = Union(A.aabb, D.aabb);
+            A.height = 1 + maxHeight(C.height, E.height);
+            B.height = 1 + maxHeight(A.height, D.height);
+        } else {
+            B.child2 = iE;
+            A.child1 = iD;
+            D.parent = iA;
+            A.aabb = Union(C.aabb, D.aabb);
+            B.aabb = Union(A.aabb, E.aabb);
+            A.height = 1 + maxHeight(C.height, D.height);
+            B.height = 1 + maxHeight(A.height, E.height);
+        }
+        return iB;
+    }
+
+    return iA;
+}
+
+//----------------------------------------------------------------------------
+AABB3D DynamicAABBTree3D::Fatten(const AABB3D& aabb) const noexcept
+{
+    AABB3D fat;
+    fat.minX = aabb.minX - margin_;
+    fat.minY = aabb.minY - margin_;
+    fat.minZ = aabb.minZ - margin_;
+    fat.maxX = aabb.maxX + margin_;
+    fat.maxY = aabb.maxY + margin_;
+    fat.maxZ = aabb.maxZ + margin_;
+    return fat;
+}
+
+//----------------------------------------------------------------------------
+AABB3D DynamicAABBTree3D::Union(const AABB3D& a, const AABB3D& b) noexcept
+{
+    AABB3D u;
+    u.minX = a.minX < b.minX ? a.minX : b.minX;
+    u.minY = a.minY < b.minY ? a.minY : b.minY;
+    u.minZ = a.minZ < b.minZ ? a.minZ : b.minZ;
+    u.maxX = a.maxX > b.maxX ? a.maxX : b.maxX;
+    u.maxY = a.maxY > b.maxY ? a.maxY : b.maxY;
+    u.maxZ = a.maxZ > b.maxZ ? a.maxZ : b.maxZ;
+    return u;
+}
+
+//----------------------------------------------------------------------------
+float DynamicAABBTree3D::SurfaceArea(const AABB3D& aabb) noexcept
+{
+    float w = aabb.maxX - aabb.minX;
+    float h = aabb.maxY - aabb.minY;
+    float d = aabb.maxZ - aabb.minZ;
+    return 2.0f * (w * h + h * d + d * w);
+}
+
+//----------------------------------------------------------------------------
+bool DynamicAABBTree3D::Contains(const AABB3D& outer, const AABB3D& inner) noexcept
+{
+    return outer.minX <= inner.minX && outer.minY <= inner.minY && outer.minZ <= inner.minZ &&
+           inner.maxX <= outer.maxX && inner.maxY <= outer.maxY && inner.maxZ <= outer.maxZ;
+}
+
+//----------------------------------------------------------------------------
+bool DynamicAABBTree3D::Overlaps(const AABB3D& a, const AABB3D& b) noexcept
+{
+    // 接触（境界が一致）も候補に含める。厳密判定はナローフェーズで行う
+    return a.minX <= b.maxX && a.maxX >= b.minX &&
+           a.minY <= b.maxY && a.maxY >= b.minY &&
+           a.minZ <= b.maxZ && a.maxZ >= b.minZ;
+}
+
+//----------------------------------------------------------------------------
+bool DynamicAABBTree3D::IntersectsRay(const AABB3D& aabb, const Vector3& origin,
+                                      const Vector3& dir, float maxDistance) noexcept
+{
+    // スラブ法
+    float tMin = 0.0f;
+    float tMax = maxDistance;
+    const float o[3] = { origin.x, origin.y, origin.z };
+    const float d[3] = { dir.x, dir.y, dir.z };
+    const float lo[3] = { aabb.minX, aabb.minY, aabb.minZ };
+    const float hi[3] = { aabb.maxX, aabb.maxY, aabb.maxZ };
+
+    for (int axis = 0; axis < 3; ++axis) {
+        if (std::abs(d[axis]) > 0.0001f) {
+            float inv = 1.0f / d[axis];
+            float t1 = (lo[axis] - o[axis]) * inv;
+            float t2 = (hi[axis] - o[axis]) * inv;
+            if (t1 > t2) { float t = t1; t1 = t2; t2 = t; }
+            if (t1 > tMin) tMin = t1;
+            if (t2 < tMax) tMax = t2;
+            if (tMin > tMax) return false;
+        } else if (o[axis] < lo[axis] || o[axis] > hi[axis]) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,145 @@
+//----------------------------------------------------------------------------
+//! @file   dynamic_aabb_tree3d.h
+//! @brief  3D動的AABBツリー（BVHブロードフェーズ）
+//!
+//! @details
+//! 葉にコライダーの「太らせた」AABBを持つ二分木。
+//! 挿入位置は表面積ヒューリスティックで選び、回転で高さを保つ。
+//! コライダーが太らせたAABBからはみ出したときだけ葉を付け替えるため、
+//! 少しずつ動く物体が多いシーンでは毎ステップの再構築が不要になる。
+//!
+//! @note スレッドセーフではない。CollisionManager3Dからのみ使用する。
+//----------------------------------------------------------------------------
+#pragma once
+
+#include "collision_manager3d.h"
+#include <vector>
+#include <cstdint>
+
+//============================================================================
+//! @brief 3D動的AABBツリー
+//============================================================================
+class DynamicAABBTree3D {
+public:
+    static constexpr int32_t kNullNode = -1;
+
+    //! @param margin 葉のAABBを各方向に広げる量
+    explicit DynamicAABBTree3D(float margin) : margin_(margin) {}
+
+    //------------------------------------------------------------------------
+    // プロキシ操作
+    //------------------------------------------------------------------------
+
+    //! @brief 葉を作成
+    //! @param aabb 形状を包む（太らせる前の）AABB
+    //! @param userIndex コライダーインデックス
+    //! @return プロキシID
+    [[nodiscard]] int32_t CreateProxy(const AABB3D& aabb, uint16_t userIndex);
+
+    //! @brief 葉を削除
+    void DestroyProxy(int32_t proxyId);
+
+    //! @brief 葉のAABBを更新
+    //! @return 太らせたAABBからはみ出して付け替えたらtrue
+    bool MoveProxy(int32_t proxyId, const AABB3D& aabb);
+
+    //! @brief 全ノードを破棄
+    void Clear();
+
+    [[nodiscard]] const AABB3D& GetFatAABB(int32_t proxyId) const { return nodes_[proxyId].aabb; }
+    [[nodiscard]] uint16_t GetUserIndex(int32_t proxyId) const { return nodes_[proxyId].userIndex; }
+    [[nodiscard]] int32_t GetHeight() const noexcept { return root_ == kNullNode ? 0 : nodes_[root_].height; }
+    [[nodiscard]] size_t GetProxyCount() const noexcept { return proxyCount_; }
+
+    //------------------------------------------------------------------------
+    // クエリ
+    //------------------------------------------------------------------------
+
+    //! @brief AABBと重なる葉を列挙
+    //! @param callback bool(uint16_t userIndex)、falseで打ち切り
+    template<typename Callback>
+    void Query(const AABB3D& aabb, Callback&& callback) const
+    {
+        if (root_ == kNullNode) return;
+
+        stack_.clear();
+        stack_.push_back(root_);
+        while (!stack_.empty()) {
+            int32_t id = stack_.back();
+            stack_.pop_back();
+
+            const Node& node = nodes_[id];
+            if (!Overlaps(node.aabb, aabb)) continue;
+
+            if (node.IsLeaf()) {
+                if (!callback(node.userIndex)) return;
+            } else {
+                stack_.push_back(node.child1);
+                stack_.push_back(node.child2);
+            }
+        }
+    }
+
+    //! @brief レイと交差する葉を列挙
+    //! @param dir 正規化済みの方向
+    //! @param callback float(uint16_t userIndex, float maxDistance)
+    //!        新しい最大距離を返す（ヒットしなければmaxDistanceをそのまま返す、0以下で打ち切り）
+    template<typename Callback>
+    void Raycast(const Vector3& origin, const Vector3& dir, float maxDistance, Callback&& callback) const
+    {
+        if (root_ == kNullNode) return;
+
+        stack_.clear();
+        stack_.push_back(root_);
+        while (!stack_.empty()) {
+            int32_t id = stack_.back();
+            stack_.pop_back();
+
+            const Node& node = nodes_[id];
+            if (!IntersectsRay(node.aabb, origin, dir, maxDistance)) continue;
+
+            if (node.IsLeaf()) {
+                maxDistance = callback(node.userIndex, maxDistance);
+                if (maxDistance <= 0.0f) return;
+            } else {
+                stack_.push_back(node.child1);
+                stack_.push_back(node.child2);
+            }
+        }
+    }
+
+private:
+    struct Node {
+        AABB3D aabb;
+        int32_t parent = kNullNode;     //!< 未使用ノードではフリーリストの次
+        int32_t child1 = kNullNode;
+        int32_t child2 = kNullNode;
+        int32_t height = -1;            //!< 葉は0、未使用は-1
+        uint16_t userIndex = 0;
+
+        [[nodiscard]] bool IsLeaf() const noexcept { return child1 == kNullNode; }
+    };
+
+    [[nodiscard]] int32_t AllocateNode();
+    void FreeNode(int32_t id);
+    void InsertLeaf(int32_t leaf);
+    void RemoveLeaf(int32_t leaf);
+    [[nodiscard]] int32_t Balance(int32_t id);
+    void Refit(int32_t id);
+
+    [[nodiscard]] AABB3D Fatten(const AABB3D& aabb) const noexcept;
+    [[nodiscard]] static AABB3D Union(const AABB3D& a, const AABB3D& b) noexcept;
+    [[nodiscard]] static float SurfaceArea(const AABB3D& aabb) noexcept;
+    [[nodiscard]] static bool Contains(const AABB3D& outer, const AABB3D& inner) noexcept;
+    [[nodiscard]] static bool Overlaps(const AABB3D& a, const AABB3D& b) noexcept;
+    [[nodiscard]] static bool IntersectsRay(const AABB3D& aabb, const Vector3& origin,
+                                            const Vector3& dir, float maxDistance) noexcept;
+
+    std::vector<Node> nodes_;
+    int32_t root_ = kNullNode;
+    int32_t freeList_ = kNullNode;
+    size_t proxyCount_ = 0;
+    float margin_;
+
+    mutable std::vector<int32_t> stack_;    //!< 走査用スタック（再利用）
+};
@@ -373,13 +373,12 @@ void SpriteBatch::Draw(const SpriteRenderer& renderer, const Transform& transfor
 
     Texture* texture = renderer.GetTexture();
 
-    // AnimatorからUV情報を取得
-    Vector2 uvCoord = animator.GetUVCoord();
-    Vector2 uvSize = animator.GetUVSize();
+    // AnimatorのUVテーブルから現在フレームの矩形を取得（ミラー時は幅が負）
+    const Vector4 uvRect = animator.GetUVRect();
 
     // フレームサイズ（テクスチャサイズ * UVサイズ）
-    float frameWidth = static_cast<float>(texture->Width()) * std::abs(uvSize.x);
-    float frameHeight = static_cast<float>(texture->Height()) * std::abs(uvSize.y);
+    float frameWidth = static_cast<float>(texture->Width()) * std::abs(uvRect.z);
+    float frameHeight = static_cast<float>(texture->Height()) * uvRect.w;
 
     // Transformからパラメータ取得
     Vector2 position = transform.GetPosition();
@@ -423,10 +422,10 @@ void SpriteBatch::Draw(const SpriteRenderer& renderer, const Transform& transfor
     };
 
     // UV座標（反転考慮）
-    float u0 = uvCoord.x;
-    float v0 = uvCoord.y;
-    float u1 = uvCoord.x + uvSize.x;
-    float v1 = uvCoord.y + uvSize.y;
+    float u0 = uvRect.x;
+    float v0 = uvRect.y;
+    float u1 = uvRect.x + uvRect.z;
+    float v1 = uvRect.y + uvRect.w;
 
     // SpriteRendererの反転
     if (renderer.IsFlipX()) std::swap(u0, u1);
@@ -11,56 +11,52 @@ Animator::Animator(uint8_t rows, uint8_t cols, uint8_t frameInterval)
     , colCount_(cols > 0 ? cols : 1)
     , frameInterval_(frameInterval > 0 ? frameInterval : 1)
 {
-    // UVサイズを計算
-    uvSize_ = Vector2(1.0f / static_cast<float>(colCount_),
-                      1.0f / static_cast<float>(rowCount_));
+    AnimatorPool& pool = Pool();
+    slot_ = pool.Allocate();
+    uvTable_ = pool.AcquireUVTable(rowCount_, colCount_);
+    RefreshRowState();
+}
+
+Animator::~Animator()
+{
+    if (AnimatorPool::IsCreated()) {
+        Pool().Release(slot_);
+    }
 }
 
 void Animator::Update([[maybe_unused]] float deltaTime)
 {
-    if (!IsPlaying()) return;
-
-    // 現在行のフレーム間隔を取得（0ならデフォルト値を使用）
-    uint8_t interval = GetRowFrameInterval(currentRow_);
-    if (interval == 0) interval = frameInterval_;
-
-    ++counter_;
-    if (counter_ >= interval) {
-        counter_ = 0;
-
-        uint8_t limit = GetCurrentRowFrameLimit();
-        uint8_t nextCol = currentCol_ + 1;
-
-        if (nextCol >= limit) {
-            if (IsLooping()) {
-                currentCol_ = 0;
-            } else {
-                // ループしない場合は最終フレームで停止
-                currentCol_ = static_cast<uint8_t>(limit - 1);
-                SetPlaying(false);
-            }
-        } else {
-            currentCol_ = nextCol;
-        }
+    Pool().Step(slot_);
+}
+
+void Animator::UpdateAll(std::span<const ComponentUpdateItem<Animator>> items)
+{
+    // フレーム数ベースのためdeltaTimeは使わない
+    AnimatorPool& pool = Pool();
+    for (const ComponentUpdateItem<Animator>& item : items) {
+        pool.MarkTick(item.component->slot_);
     }
+    pool.StepMarked();
 }
 
 void Animator::Reset()
 {
-    currentCol_ = 0;
-    counter_ = 0;
+    AnimatorPool& pool = Pool();
+    pool.col_[slot_] = 0;
+    pool.counter_[slot_] = 0;
     SetPlaying(true);
 }
 
 void Animator::SetRow(uint8_t row)
 {
-    currentRow_ = row % rowCount_;
+    AnimatorPool& pool = Pool();
+    pool.row_[slot_] = row % rowCount_;
+    RefreshRowState();
     // フレーム位置が現在の行の制限を超える場合のみ調整
-    uint8_t limit = GetCurrentRowFrameLimit();
-    if (currentCol_ >= limit) {
-        currentCol_ = 0;
+    if (pool.col_[slot_] >= pool.limit_[slot_]) {
+        pool.col_[slot_] = 0;
     }
-    counter_ = 0;
+    pool.counter_[slot_] = 0;
 }
 
 void Animator::SetRowFrameCount(uint8_t row, uint8_t frameCount)
@@ -75,6 +71,7 @@ void Animator::SetRowFrameCount(uint8_t row, uint8_t frameCount)
     } else {
         rowFrameCounts_[row] = frameCount;
     }
+    RefreshRowState();
 }
 
 uint8_t Animator::GetRowFrameCount(uint8_t row) const
@@ -102,6 +99,7 @@ void Animator::SetRowFrameInterval(uint8_t row, uint8_t frameInterval)
     if (row >= rowCount_ || row >= kMaxRows) return;
 
     rowFrameIntervals_[row] = frameInterval;
+    RefreshRowState();
 }
 
 uint8_t Animator::GetRowFrameInterval(uint8_t row) const
@@ -115,47 +113,62 @@ uint8_t Animator::GetRowFrameInterval(uint8_t row) const
 
 void Animator::SetColumn(uint8_t col)
 {
-    uint8_t limit = GetCurrentRowFrameLimit();
-    currentCol_ = col < limit ? col : static_cast<uint8_t>(limit - 1);
-    counter_ = 0;
+    AnimatorPool& pool = Pool();
+    uint8_t limit = pool.limit_[slot_];
+    pool.col_[slot_] = col < limit ? col : static_cast<uint8_t>(limit - 1);
+    pool.counter_[slot_] = 0;
 }
 
-Vector2 Animator::GetUVCoord() const
+const Vector4& Animator::GetFrameUVRect() const noexcept
 {
-    float u = uvSize_.x * static_cast<float>(currentCol_);
-    float v = uvSize_.y * static_cast<float>(currentRow_);
+    const AnimatorPool& pool = Pool();
+    return pool.GetUVRect(uvTable_, static_cast<uint32_t>(pool.row_[slot_]) * colCount_ + pool.col_[slot_]);
+}
 
-    // ミラー時は右端から描画
-    if (GetMirror()) {
-        u += uvSize_.x;
-    }
+Vector4 Animator::GetUVRect() const
+{
+    const Vector4& rect = GetFrameUVRect();
 
-    return Vector2(u, v);
+    // ミラー時は右端から負の幅で描画
+    return GetMirror()
+        ? Vector4(rect.x + rect.z, rect.y, -rect.z, rect.w)
+        : rect;
+}
+
+Vector2 Animator::GetUVCoord() const
+{
+    const Vector4 rect = GetUVRect();
+    return Vector2(rect.x, rect.y);
 }
 
 Vector2 Animator::GetUVSize() const
 {
-    // ミラー時は幅を負にする
-    return GetMirror()
-        ? Vector2(-uvSize_.x, uvSize_.y)
-        : uvSize_;
+    const Vector4 rect = GetUVRect();
+    return Vector2(rect.z, rect.w);
 }
 
 Vector4 Animator::GetSourceRect(float textureWidth, float textureHeight) const
 {
-    float frameWidth = textureWidth / static_cast<float>(colCount_);
-    float frameHeight = textureHeight / static_cast<float>(rowCount_);
-
-    float x = frameWidth * static_cast<float>(currentCol_);
-    float y = frameHeight * static_cast<float>(currentRow_);
-
-    return Vector4(x, y, frameWidth, frameHeight);
+    const Vector4& rect = GetFrameUVRect();
+    return Vector4(rect.x * textureWidth, rect.y * textureHeight,
+                   rect.z * textureWidth, rect.w * textureHeight);
 }
 
 uint8_t Animator::GetCurrentRowFrameLimit() const
 {
-    if (currentRow_ >= kMaxRows) return colCount_;
+    const uint8_t currentRow = GetRow();
+    if (currentRow >= kMaxRows) return colCount_;
 
-    uint8_t limit = rowFrameCounts_[currentRow_];
+    uint8_t limit = rowFrameCounts_[currentRow];
     return limit > 0 ? limit : colCount_;
 }
+
+void Animator::RefreshRowState() noexcept
+{
+    AnimatorPool& pool = Pool();
+    const uint8_t currentRow = pool.row_[slot_];
+
+    uint8_t interval = currentRow < kMaxRows ? rowFrameIntervals_[currentRow] : 0;
+    pool.interval_[slot_] = interval > 0 ? interval : frameInterval_;
+    pool.limit_[slot_] = GetCurrentRowFrameLimit();
+}
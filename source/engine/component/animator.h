@@ -5,9 +5,12 @@
 #pragma once
 
 #include "component.h"
+#include "component_update_registry.h"
+#include "animator_pool.h"
 #include "engine/math/math_types.h"
 #include <cstdint>
 #include <array>
+#include <span>
 
 //============================================================================
 //! @brief スプライトシートアニメーションコンポーネント
@@ -16,7 +19,9 @@
 //! 時間経過で自動的にフレームを進める。
 //! SpriteRendererと組み合わせて使用する。
 //!
-//! @note メモリレイアウト: 32バイト（16バイトアライン x 2）
+//! @note 再生状態（カウンタ・行・列・フラグ）はAnimatorPoolの並列配列にあり、
+//!       このクラスは行ごとの設定とプールのスロット番号を持つ。
+//!       UVはシート分割数ごとに共有されるUVテーブルから引く。
 //============================================================================
 class Animator : public Component {
 public:
@@ -34,12 +39,23 @@ public:
     //------------------------------------------------------------------------
     Animator(uint8_t rows = 1, uint8_t cols = 1, uint8_t frameInterval = 1);
 
+    //! @brief デストラクタ（プールのスロットを解放）
+    ~Animator() override;
+
+    Animator(const Animator&) = delete;
+    Animator& operator=(const Animator&) = delete;
+
     //------------------------------------------------------------------------
     // Component オーバーライド
     //------------------------------------------------------------------------
 
     void Update(float deltaTime) override;
 
+    //! @brief 一括更新（ComponentUpdateRegistryに登録して使用）
+    //! @note 対象に印を付けてAnimatorPool全体をSIMDで1回進めるため、
+    //!       Sequentialで登録すること（並列実行不可）
+    static void UpdateAll(std::span<const ComponentUpdateItem<Animator>> items);
+
     //------------------------------------------------------------------------
     // 再生制御
     //------------------------------------------------------------------------
@@ -48,25 +64,29 @@ public:
     void Reset();
 
     //! @brief 再生/一時停止
-    void SetPlaying(bool playing) noexcept { SetFlag(kFlagPlaying, playing); }
-    [[nodiscard]] bool IsPlaying() const noexcept { return GetFlag(kFlagPlaying); }
+    void SetPlaying(bool playing) noexcept { SetFlag(AnimatorPool::kFlagPlaying, playing); }
+    [[nodiscard]] bool IsPlaying() const noexcept { return GetFlag(AnimatorPool::kFlagPlaying); }
 
     //! @brief ループ再生の設定
-    void SetLooping(bool loop) noexcept { SetFlag(kFlagLooping, loop); }
-    [[nodiscard]] bool IsLooping() const noexcept { return GetFlag(kFlagLooping); }
+    void SetLooping(bool loop) noexcept { SetFlag(AnimatorPool::kFlagLooping, loop); }
+    [[nodiscard]] bool IsLooping() const noexcept { return GetFlag(AnimatorPool::kFlagLooping); }
 
     //------------------------------------------------------------------------
     // フレーム間隔
     //------------------------------------------------------------------------
 
     //! @brief フレーム間隔を設定（ゲームフレーム数、max 255）
-    void SetFrameInterval(uint8_t frames) noexcept { frameInterval_ = frames > 0 ? frames : 1; }
+    void SetFrameInterval(uint8_t frames) noexcept {
+        frameInterval_ = frames > 0 ? frames : 1;
+        RefreshRowState();
+    }
     [[nodiscard]] uint8_t GetFrameInterval() const noexcept { return frameInterval_; }
 
     //! @brief フレーム間隔を秒で設定（kAssumedFrameRate前提、max ~4.25秒）
     void SetFrameDuration(float seconds) noexcept {
         float frames = seconds * kAssumedFrameRate;
         frameInterval_ = frames >= 255.0f ? 255 : (frames < 1.0f ? 1 : static_cast<uint8_t>(frames));
+        RefreshRowState();
     }
 
     //------------------------------------------------------------------------
@@ -74,7 +94,7 @@ public:
     //------------------------------------------------------------------------
 
     //! @brief 現在の行を取得
-    [[nodiscard]] uint8_t GetRow() const noexcept { return currentRow_; }
+    [[nodiscard]] uint8_t GetRow() const noexcept { return Pool().row_[slot_]; }
 
     //! @brief 行を設定（先頭フレームにリセット）
     void SetRow(uint8_t row);
@@ -109,7 +129,7 @@ public:
     //------------------------------------------------------------------------
 
     //! @brief 現在の列（フレーム）を取得
-    [[nodiscard]] uint8_t GetColumn() const noexcept { return currentCol_; }
+    [[nodiscard]] uint8_t GetColumn() const noexcept { return Pool().col_[slot_]; }
 
     //! @brief 列を直接設定
     void SetColumn(uint8_t col);
@@ -122,8 +142,8 @@ public:
     //------------------------------------------------------------------------
 
     //! @brief 左右反転を設定
-    void SetMirror(bool mirror) noexcept { SetFlag(kFlagMirror, mirror); }
-    [[nodiscard]] bool GetMirror() const noexcept { return GetFlag(kFlagMirror); }
+    void SetMirror(bool mirror) noexcept { SetFlag(AnimatorPool::kFlagMirror, mirror); }
+    [[nodiscard]] bool GetMirror() const noexcept { return GetFlag(AnimatorPool::kFlagMirror); }
 
     //------------------------------------------------------------------------
     // UV座標取得（SpriteRendererで使用）
@@ -143,24 +163,30 @@ public:
     //! @return (x, y, width, height)
     [[nodiscard]] Vector4 GetSourceRect(float textureWidth, float textureHeight) const;
 
+    //! @brief 現在のフレームのUV矩形を取得
+    //! @return (u, v, w, h)。ミラー時はuが右端、wが負
+    [[nodiscard]] Vector4 GetUVRect() const;
+
 private:
+    [[nodiscard]] static AnimatorPool& Pool() noexcept { return AnimatorPool::Get(); }
+
     //! @brief 現在行の有効フレーム数を取得
     [[nodiscard]] uint8_t GetCurrentRowFrameLimit() const;
 
-    //------------------------------------------------------------------------
-    // フラグビット定義
-    //------------------------------------------------------------------------
-    static constexpr uint8_t kFlagMirror  = 0x01;  //!< bit0: 左右反転
-    static constexpr uint8_t kFlagPlaying = 0x02;  //!< bit1: 再生中
-    static constexpr uint8_t kFlagLooping = 0x04;  //!< bit2: ループ再生
+    //! @brief 現在行の有効フレーム間隔・フレーム数をプールへ反映
+    void RefreshRowState() noexcept;
+
+    //! @brief シート上の現在フレームのUV矩形（ミラー未適用）
+    [[nodiscard]] const Vector4& GetFrameUVRect() const noexcept;
 
     //! @brief フラグ設定ヘルパー
     void SetFlag(uint8_t flag, bool value) noexcept {
-        if (value) flags_ |= flag; else flags_ &= ~flag;
+        uint8_t& flags = Pool().flags_[slot_];
+        if (value) flags |= flag; else flags &= static_cast<uint8_t>(~flag);
     }
     //! @brief フラグ取得ヘルパー
     [[nodiscard]] bool GetFlag(uint8_t flag) const noexcept {
-        return (flags_ & flag) != 0;
+        return (Pool().flags_[slot_] & flag) != 0;
     }
 
     //------------------------------------------------------------------------
@@ -173,16 +199,12 @@ private:
     // 16 bytes: 行ごとのフレーム間隔（0でデフォルト値使用）
     std::array<uint8_t, kMaxRows> rowFrameIntervals_{};
 
-    // 8 bytes: UVキャッシュ
-    Vector2 uvSize_;
+    // 8 bytes: プール参照
+    uint32_t slot_ = AnimatorPool::kInvalidSlot;  //!< AnimatorPoolのスロット
+    uint32_t uvTable_ = 0;                         //!< AnimatorPoolのUVテーブル先頭
 
-    // 8 bytes: 状態（パック）
+    // 3 bytes: シート設定
     uint8_t rowCount_;            //!< シート縦分割数（行数）
     uint8_t colCount_;            //!< シート横分割数（列数）
-    uint8_t currentRow_ = 0;      //!< 現在の行
-    uint8_t currentCol_ = 0;      //!< 現在の列（フレーム）
     uint8_t frameInterval_ = 1;   //!< フレーム間隔（ゲームフレーム数）
-    uint8_t counter_ = 0;         //!< 経過フレームカウンタ
-    uint8_t flags_ = kFlagPlaying | kFlagLooping;  //!< フラグ（mirror/playing/looping）
-    uint8_t reserved_ = 0;        //!< 予約（パディング）
 };
@@ -0,0 +1,176 @@
+//----------------------------------------------------------------------------
+//! @file   animator_pool.cpp
+//! @brief  Animator再生状態プール 実装
+//----------------------------------------------------------------------------
+#include "animator_pool.h"
+
+#if ANIMATOR_POOL_SIMD
+#include <emmintrin.h>
+#endif
+
+//----------------------------------------------------------------------------
+// 更新
+//----------------------------------------------------------------------------
+
+void AnimatorPool::StepMarked() noexcept
+{
+    const size_t count = flags_.size();
+
+#if ANIMATOR_POOL_SIMD
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi8(1);
+    const __m128i playingBit = _mm_set1_epi8(static_cast<char>(kFlagPlaying));
+    const __m128i loopingBit = _mm_set1_epi8(static_cast<char>(kFlagLooping));
+
+    // mask ? a : b
+    auto select = [](__m128i mask, __m128i a, __m128i b) {
+        return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    };
+    // a >= b（符号なし）
+    auto greaterEqual = [](__m128i a, __m128i b) {
+        return _mm_cmpeq_epi8(_mm_max_epu8(a, b), a);
+    };
+
+    for (size_t i = 0; i < count; i += kLaneCount) {
+        auto* tickPtr = reinterpret_cast<__m128i*>(tick_.data() + i);
+        const __m128i notMarked = _mm_cmpeq_epi8(_mm_loadu_si128(tickPtr), zero);
+        if (_mm_movemask_epi8(notMarked) == 0xFFFF) continue;
+
+        auto* counterPtr = reinterpret_cast<__m128i*>(counter_.data() + i);
+        auto* colPtr = reinterpret_cast<__m128i*>(col_.data() + i);
+        auto* flagsPtr = reinterpret_cast<__m128i*>(flags_.data() + i);
+        const __m128i flags = _mm_loadu_si128(flagsPtr);
+        const __m128i counter = _mm_loadu_si128(counterPtr);
+        const __m128i col = _mm_loadu_si128(colPtr);
+        const __m128i interval = _mm_loadu_si128(reinterpret_cast<const __m128i*>(interval_.data() + i));
+        const __m128i limit = _mm_loadu_si128(reinterpret_cast<const __m128i*>(limit_.data() + i));
+
+        // 印あり かつ 再生中のレーンだけ進める
+        const __m128i playing = _mm_cmpeq_epi8(_mm_and_si128(flags, playingBit), playingBit);
+        const __m128i active = _mm_andnot_si128(notMarked, playing);
+
+        // カウンタが間隔に達したらフレームを送る
+        const __m128i counted = _mm_add_epi8(counter, one);
+        const __m128i advance = _mm_and_si128(active, greaterEqual(counted, interval));
+        _mm_storeu_si128(counterPtr, select(active, _mm_andnot_si128(advance, counted), counter));
+
+        // 末尾を越えたら ループ:先頭 / 非ループ:最終フレームで停止
+        const __m128i next = _mm_add_epi8(col, one);
+        const __m128i wrap = _mm_and_si128(advance, greaterEqual(next, limit));
+        const __m128i looping = _mm_cmpeq_epi8(_mm_and_si128(flags, loopingBit), loopingBit);
+        const __m128i last = _mm_andnot_si128(looping, _mm_sub_epi8(limit, one));
+        _mm_storeu_si128(colPtr, select(wrap, last, select(advance, next, col)));
+
+        const __m128i stop = _mm_andnot_si128(looping, wrap);
+        _mm_storeu_si128(flagsPtr, _mm_andnot_si128(_mm_and_si128(stop, playingBit), flags));
+
+        _mm_storeu_si128(tickPtr, zero);
+    }
+#else
+    for (size_t i = 0; i < count; ++i) {
+        if (tick_[i]) {
+            Step(static_cast<uint32_t>(i));
+            tick_[i] = 0;
+        }
+    }
+#endif
+}
+
+void AnimatorPool::Step(uint32_t slot) noexcept
+{
+    if (!(flags_[slot] & kFlagPlaying)) return;
+
+    ++counter_[slot];
+    if (counter_[slot] >= interval_[slot]) {
+        counter_[slot] = 0;
+
+        const uint8_t limit = limit_[slot];
+        const uint8_t nextCol = static_cast<uint8_t>(col_[slot] + 1);
+
+        if (nextCol >= limit) {
+            if (flags_[slot] & kFlagLooping) {
+                col_[slot] = 0;
+            } else {
+                // ループしない場合は最終フレームで停止
+                col_[slot] = static_cast<uint8_t>(limit - 1);
+                flags_[slot] &= static_cast<uint8_t>(~kFlagPlaying);
+            }
+        } else {
+            col_[slot] = nextCol;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+// スロット管理
+//----------------------------------------------------------------------------
+
+uint32_t AnimatorPool::Allocate()
+{
+    if (freeSlots_.empty()) {
+        // kLaneCount単位で拡張（末尾の未使用レーンはflags=0で変化しない）
+        const size_t base = flags_.size();
+        const size_t size = base + kLaneCount;
+        counter_.resize(size, 0);
+        interval_.resize(size, 1);
+        col_.resize(size, 0);
+        limit_.resize(size, 1);
+        row_.resize(size, 0);
+        flags_.resize(size, 0);
+        tick_.resize(size, 0);
+
+        // 若い番号から使うよう逆順に積む
+        for (size_t i = size; i > base; --i) {
+            freeSlots_.push_back(static_cast<uint32_t>(i - 1));
+        }
+    }
+
+    const uint32_t slot = freeSlots_.back();
+    freeSlots_.pop_back();
+
+    counter_[slot] = 0;
+    interval_[slot] = 1;
+    col_[slot] = 0;
+    limit_[slot] = 1;
+    row_[slot] = 0;
+    flags_[slot] = kFlagPlaying | kFlagLooping;
+    tick_[slot] = 0;
+    return slot;
+}
+
+void AnimatorPool::Release(uint32_t slot) noexcept
+{
+    if (slot >= flags_.size()) return;
+
+    flags_[slot] = 0;
+    tick_[slot] = 0;
+    freeSlots_.push_back(slot);
+}
+
+//----------------------------------------------------------------------------
+// UVテーブル
+//----------------------------------------------------------------------------
+
+uint32_t AnimatorPool::AcquireUVTable(uint8_t rows, uint8_t cols)
+{
+    const uint16_t key = static_cast<uint16_t>((rows << 8) | cols);
+    if (auto it = uvTables_.find(key); it != uvTables_.end()) {
+        return it->second;
+    }
+
+    const uint32_t table = static_cast<uint32_t>(uvRects_.size());
+    const float width = 1.0f / static_cast<float>(cols);
+    const float height = 1.0f / static_cast<float>(rows);
+
+    uvRects_.reserve(uvRects_.size() + static_cast<size_t>(rows) * cols);
+    for (uint32_t row = 0; row < rows; ++row) {
+        for (uint32_t col = 0; col < cols; ++col) {
+            uvRects_.emplace_back(width * static_cast<float>(col),
+                                  height * static_cast<float>(row),
+                                  width, height);
+        }
+    }
+
+    uvTables_.emplace(key, table);
+    return table;
+}
@@ -0,0 +1,152 @@
+//----------------------------------------------------------------------------
+//! @file   animator_pool.h
+//! @brief  Animatorの再生状態プール（SoA）とスプライトシートUVテーブル
+//!
+//! @details
+//! 全Animatorのフレーム送りに使う状態（カウンタ・間隔・行・列・有効フレーム数・フラグ）を
+//! uint8_tの並列配列で保持し、StepMarked()で16体ずつSIMDの比較・選択で一括して進める。
+//! 行ごとの設定（フレーム数・フレーム間隔）はAnimator側に残し、行の切り替え時などに
+//! 現在行の有効値だけをプールへ書き込むため、ステップ中に行ごとの表を引かない。
+//!
+//! UVテーブルはシートの分割数（行数, 列数）ごとに1つだけ作り、同じ分割のAnimatorで共有する。
+//! 各フレームのUV矩形(u, v, w, h)を行優先で並べ、描画時は添字を引くだけになる。
+//!
+//! @note スレッドセーフ性: メインスレッドからのみ呼び出し可能
+//----------------------------------------------------------------------------
+#pragma once
+
+#include "engine/math/math_types.h"
+#include "common/utility/non_copyable.h"
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define ANIMATOR_POOL_SIMD 1
+#else
+#define ANIMATOR_POOL_SIMD 0
+#endif
+
+class Animator;
+
+//============================================================================
+//! @brief Animator再生状態プール（シングルトン）
+//============================================================================
+class AnimatorPool final : private NonCopyableNonMovable
+{
+public:
+    static constexpr uint32_t kInvalidSlot = UINT32_MAX;  //!< 無効なスロット
+    static constexpr uint32_t kLaneCount = 16;            //!< 1回のSIMD演算で進めるスロット数
+
+    //------------------------------------------------------------------------
+    // フラグビット定義（Animatorと共通）
+    //------------------------------------------------------------------------
+    static constexpr uint8_t kFlagMirror  = 0x01;  //!< bit0: 左右反転
+    static constexpr uint8_t kFlagPlaying = 0x02;  //!< bit1: 再生中
+    static constexpr uint8_t kFlagLooping = 0x04;  //!< bit2: ループ再生
+
+    //! @brief シングルトンインスタンス取得
+    static AnimatorPool& Get()
+    {
+        assert(instance_ && "AnimatorPool::Create() must be called first");
+        return *instance_;
+    }
+
+    //! @brief インスタンスが生成済みか
+    [[nodiscard]] static bool IsCreated() noexcept { return instance_ != nullptr; }
+
+    //! @brief インスタンス生成
+    static void Create()
+    {
+        if (!instance_) {
+            instance_ = std::unique_ptr<AnimatorPool>(new AnimatorPool());
+        }
+    }
+
+    //! @brief インスタンス破棄
+    static void Destroy()
+    {
+        instance_.reset();
+    }
+
+    ~AnimatorPool() = default;
+
+    //------------------------------------------------------------------------
+    // 更新
+    //------------------------------------------------------------------------
+
+    //! @brief StepMarked()で進める対象に印を付ける
+    void MarkTick(uint32_t slot) noexcept { tick_[slot] = 1; }
+
+    //! @brief 印の付いた全スロットを1ゲームフレーム分進め、印を消す
+    //! @note 全スロットを16体単位で走査する（印のないスロットは変化しない）
+    void StepMarked() noexcept;
+
+    //! @brief 1スロットだけ1ゲームフレーム分進める
+    void Step(uint32_t slot) noexcept;
+
+    //------------------------------------------------------------------------
+    // 統計
+    //------------------------------------------------------------------------
+
+    //! @brief スロット配列の長さ（解放済みを含む、kLaneCountの倍数）
+    [[nodiscard]] size_t GetSlotCount() const noexcept { return flags_.size(); }
+
+    //! @brief 使用中のスロット数
+    [[nodiscard]] size_t GetActiveCount() const noexcept { return flags_.size() - freeSlots_.size(); }
+
+    //! @brief 作成済みUVテーブル数
+    [[nodiscard]] size_t GetUVTableCount() const noexcept { return uvTables_.size(); }
+
+private:
+    friend class Animator;
+
+    AnimatorPool() = default;
+
+    //------------------------------------------------------------------------
+    // スロット管理（Animatorから呼ばれる）
+    //------------------------------------------------------------------------
+
+    //! @brief スロットを確保（停止状態で初期化）
+    [[nodiscard]] uint32_t Allocate();
+
+    //! @brief スロットを解放（以降のStepMarked()では変化しない）
+    void Release(uint32_t slot) noexcept;
+
+    //------------------------------------------------------------------------
+    // UVテーブル
+    //------------------------------------------------------------------------
+
+    //! @brief 分割数に対応するUVテーブルを取得（なければ作成）
+    //! @return テーブル先頭のインデックス
+    [[nodiscard]] uint32_t AcquireUVTable(uint8_t rows, uint8_t cols);
+
+    //! @brief UV矩形を取得
+    //! @param table AcquireUVTable()の戻り値
+    //! @param frame 行 * 列数 + 列
+    [[nodiscard]] const Vector4& GetUVRect(uint32_t table, uint32_t frame) const noexcept {
+        return uvRects_[table + frame];
+    }
+
+    static inline std::unique_ptr<AnimatorPool> instance_ = nullptr;
+
+    //------------------------------------------------------------------------
+    // Structure of Arrays（SoA）- 再生状態（長さは常にkLaneCountの倍数）
+    //------------------------------------------------------------------------
+    std::vector<uint8_t> counter_;    //!< 経過フレームカウンタ
+    std::vector<uint8_t> interval_;   //!< 現在行の有効フレーム間隔
+    std::vector<uint8_t> col_;        //!< 現在の列（フレーム）
+    std::vector<uint8_t> limit_;      //!< 現在行の有効フレーム数
+    std::vector<uint8_t> row_;        //!< 現在の行
+    std::vector<uint8_t> flags_;      //!< フラグ（mirror/playing/looping）。解放済みは0
+    std::vector<uint8_t> tick_;       //!< StepMarked()の対象印
+    std::vector<uint32_t> freeSlots_; //!< 再利用待ちスロット
+
+    //------------------------------------------------------------------------
+    // UVテーブル
+    //------------------------------------------------------------------------
+    std::vector<Vector4> uvRects_;                    //!< 全テーブルのUV矩形(u, v, w, h)
+    std::unordered_map<uint16_t, uint32_t> uvTables_; //!< (行数 << 8 | 列数) → 先頭インデックス
+};
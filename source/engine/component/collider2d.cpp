@@ -23,34 +23,94 @@ void Collider2D::OnAttach()
     mgr.SetLayer(handle_, initLayer_);
     mgr.SetMask(handle_, initMask_);
     mgr.SetTrigger(handle_, initTrigger_);
+
+    if (syncWithTransform_) {
+        BindTransform();
+    }
 }
 
 void Collider2D::OnDetach()
 {
     CollisionManager::Get().Unregister(handle_);
     handle_ = ColliderHandle{};
+    transformBound_ = false;
 }
 
 void Collider2D::Update([[maybe_unused]] float deltaTime)
 {
-    // Transformと自動同期
-    if (syncWithTransform_) {
-        if (GameObject* owner = GetOwner()) {
-            if (Transform* transform = owner->GetComponent<Transform>()) {
-                Vector2 pos = transform->GetWorldPosition();
-                CollisionManager::Get().SetPosition(handle_, pos.x, pos.y);
-            }
+    // 位置はCollisionManager::SyncTransforms()で一括同期される。
+    // 登録はアタッチ時に済むため、ここではTransformがない間の再試行のみ行う。
+    if (syncWithTransform_ && !transformBound_) {
+        BindTransform();
+    }
+}
+
+void Collider2D::SyncAll(std::span<const ComponentUpdateItem<Collider2D>> items)
+{
+    // Transformがなく未登録のものだけ再試行（位置同期自体はCollisionManagerが一括で行う）
+    for (const ComponentUpdateItem<Collider2D>& item : items) {
+        Collider2D* collider = item.component;
+        if (collider->syncWithTransform_ && !collider->transformBound_) {
+            collider->BindTransform();
         }
     }
 }
 
+void Collider2D::BindTransform()
+{
+    if (!handle_.IsValid()) return;
+    if (GameObject* owner = GetOwner()) {
+        if (Transform* transform = owner->GetComponent<Transform>()) {
+            CollisionManager::Get().SetSyncTransform(handle_, transform);
+            transformBound_ = true;
+        }
+    }
+}
+
+void Collider2D::OnTransformAttached()
+{
+    if (syncWithTransform_ && !transformBound_) {
+        BindTransform();
+    }
+}
+
+void Collider2D::OnTransformDetached(const Transform* transform)
+{
+    if (!transformBound_) return;
+    auto& mgr = CollisionManager::Get();
+    if (mgr.GetSyncTransform(handle_) != transform) return;
+    mgr.SetSyncTransform(handle_, nullptr);
+    transformBound_ = false;
+
+    // 別のTransformが残っていればそちらに同期し直す
+    // （GameObject破棄中はスロットにデタッチ中のTransformが残っているため除外する）
+    if (GameObject* owner = GetOwner()) {
+        Transform* next = owner->GetComponent<Transform>();
+        if (next && next != transform) {
+            mgr.SetSyncTransform(handle_, next);
+            transformBound_ = true;
+        }
+    }
+}
+
+void Collider2D::SetSyncWithTransform(bool sync)
+{
+    syncWithTransform_ = sync;
+    if (sync) {
+        if (!transformBound_) BindTransform();
+    } else if (transformBound_) {
+        CollisionManager::Get().SetSyncTransform(handle_, nullptr);
+        transformBound_ = false;
+    }
+}
+
 //----------------------------------------------------------------------------
 // 位置
 //----------------------------------------------------------------------------
 
 void Collider2D::SetPosition(float x, float y)
 {
-    syncWithTransform_ = false;  // 手動設定に切り替え
+    SetSyncWithTransform(false);  // 手動設定に切り替え
     CollisionManager::Get().SetPosition(handle_, x, y);
 }
 
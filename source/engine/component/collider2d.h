@@ -5,9 +5,11 @@
 #pragma once
 
 #include "component.h"
+#include "component_update_registry.h"
 #include "engine/math/math_types.h"
 #include "engine/c_systems/collision_manager.h"
 #include <cstdint>
+#include <span>
 
 //============================================================================
 //! @brief 2D当たり判定コンポーネント（AABB）
@@ -34,6 +36,10 @@ public:
     void OnDetach() override;
     void Update(float deltaTime) override;
 
+    //! @brief 一括更新（ComponentUpdateRegistryに登録して使用）
+    //! @note CollisionManagerへの登録を伴うためメインスレッドで実行すること
+    static void SyncAll(std::span<const ComponentUpdateItem<Collider2D>> items);
+
     //------------------------------------------------------------------------
     // 位置（毎フレーム更新用）
     //------------------------------------------------------------------------
@@ -126,12 +132,25 @@ public:
 
     //! @brief Transformとの自動同期を設定
     //! @param sync trueで自動同期、falseで手動更新モード
-    void SetSyncWithTransform(bool sync) noexcept { syncWithTransform_ = sync; }
+    //! @note 同期はCollisionManager::SyncTransforms()で一括して行われる
+    void SetSyncWithTransform(bool sync);
 
     //! @brief Transformとの自動同期状態を取得
     [[nodiscard]] bool IsSyncWithTransform() const noexcept { return syncWithTransform_; }
 
+    //! @brief 所有者にTransformがアタッチされた（Transform::OnAttach()から呼ばれる）
+    //! @note 自動同期が有効で未登録なら、その場で一括同期に登録する
+    void OnTransformAttached();
+
+    //! @brief 同期元のTransformがデタッチされた（Transform::OnDetach()から呼ばれる）
+    //! @param transform デタッチされるTransform
+    //! @note 同期元がそのTransformなら解除し、別のTransformが残っていればそちらに登録し直す
+    void OnTransformDetached(const Transform* transform);
+
 private:
+    //! @brief 所有者のTransformをCollisionManagerの一括同期に登録
+    void BindTransform();
+
     ColliderHandle handle_;
 
     // 初期化用の一時保存（OnAttach前に設定された値を保持）
@@ -141,6 +160,7 @@ private:
     uint8_t initMask_ = CollisionConstants::kDefaultMask;
     bool initTrigger_ = false;
     bool syncWithTransform_ = true;  //!< Transformと自動同期するか
+    bool transformBound_ = false;    //!< 一括同期に登録済みか
 
     void* userData_ = nullptr;  //!< ユーザー定義データ
 };
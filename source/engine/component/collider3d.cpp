@@ -26,6 +26,17 @@ Collider3D Collider3D::CreateSphere(float radius, const Vector3& offset)
     return collider;
 }
 
+//----------------------------------------------------------------------------
+Collider3D Collider3D::CreateCapsule(float radius, float height, const Vector3& offset)
+{
+    Collider3D collider;
+    collider.shape_ = ColliderShape3D::Capsule;
+    collider.initRadius_ = radius;
+    collider.initHeight_ = height;
+    collider.initOffset_ = offset;
+    return collider;
+}
+
 //----------------------------------------------------------------------------
 void Collider3D::OnAttach()
 {
@@ -36,6 +47,9 @@ void Collider3D::OnAttach()
         manager.SetAABBSize(handle_, initSize_);
     } else if (shape_ == ColliderShape3D::Sphere) {
         manager.SetSphereRadius(handle_, initRadius_);
+    } else if (shape_ == ColliderShape3D::Capsule) {
+        manager.SetSphereRadius(handle_, initRadius_);
+        manager.SetCapsuleHalfHeight(handle_, initHeight_ * 0.5f - initRadius_);
     }
 
     manager.SetOffset(handle_, initOffset_);
@@ -122,7 +136,11 @@ void Collider3D::SetRadius(float radius)
 {
     initRadius_ = radius;
     if (handle_.IsValid()) {
-        CollisionManager3D::Get().SetSphereRadius(handle_, radius);
+        auto& manager = CollisionManager3D::Get();
+        manager.SetSphereRadius(handle_, radius);
+        if (shape_ == ColliderShape3D::Capsule) {
+            manager.SetCapsuleHalfHeight(handle_, initHeight_ * 0.5f - radius);
+        }
     }
 }
 
@@ -135,6 +153,21 @@ float Collider3D::GetRadius() const
     return initRadius_;
 }
 
+//----------------------------------------------------------------------------
+void Collider3D::SetHeight(float height)
+{
+    initHeight_ = height;
+    if (handle_.IsValid() && shape_ == ColliderShape3D::Capsule) {
+        CollisionManager3D::Get().SetCapsuleHalfHeight(handle_, height * 0.5f - initRadius_);
+    }
+}
+
+//----------------------------------------------------------------------------
+float Collider3D::GetHeight() const
+{
+    return initHeight_;
+}
+
 //----------------------------------------------------------------------------
 void Collider3D::SetOffset(const Vector3& offset)
 {
@@ -34,6 +34,14 @@ public:
     //------------------------------------------------------------------------
     static Collider3D CreateSphere(float radius, const Vector3& offset = Vector3::Zero);
 
+    //------------------------------------------------------------------------
+    //! @brief カプセルコライダー作成（Y軸方向）
+    //! @param radius 半径
+    //! @param height 半球部分を含む全高（2 * radius未満なら球と同じ）
+    //! @param offset 中心からのオフセット
+    //------------------------------------------------------------------------
+    static Collider3D CreateCapsule(float radius, float height, const Vector3& offset = Vector3::Zero);
+
     //------------------------------------------------------------------------
     // Component オーバーライド
     //------------------------------------------------------------------------
@@ -59,12 +67,19 @@ public:
     [[nodiscard]] Vector3 GetSize() const;
 
     //------------------------------------------------------------------------
-    // 半径（球用）
+    // 半径（球・カプセル用）
     //------------------------------------------------------------------------
 
     void SetRadius(float radius);
     [[nodiscard]] float GetRadius() const;
 
+    //------------------------------------------------------------------------
+    // 高さ（カプセル用、半球部分を含む全高）
+    //------------------------------------------------------------------------
+
+    void SetHeight(float height);
+    [[nodiscard]] float GetHeight() const;
+
     //------------------------------------------------------------------------
     // オフセット
     //------------------------------------------------------------------------
@@ -153,6 +168,7 @@ private:
     // 初期化用の一時保存
     Vector3 initSize_ = Vector3::One;
     float initRadius_ = 0.5f;
+    float initHeight_ = 2.0f;
     Vector3 initOffset_ = Vector3::Zero;
     uint8_t initLayer_ = CollisionConstants3D::kDefaultLayer;
     uint8_t initMask_ = CollisionConstants3D::kDefaultMask;
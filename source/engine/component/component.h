@@ -4,8 +4,13 @@
 //----------------------------------------------------------------------------
 #pragma once
 
+#include <atomic>
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
-#include <typeinfo>
+#include <cstdio>
+#include <cstdlib>
+#include <type_traits>
 
 class GameObject;
 
@@ -58,18 +63,92 @@ protected:
 
 private:
     friend class GameObject;
+    friend class ComponentUpdateRegistry;
 
     GameObject* owner_ = nullptr;
+    uint32_t updateQueueIndex_ = UINT32_MAX;  //!< 一括更新キュー内の位置（ComponentUpdateRegistryが管理）
     bool enabled_ = true;
 };
 
+//============================================================================
+//! @brief コンポーネント型ID（密な連番）
+//!
+//! エンジン組み込みのコンポーネントはBuiltinTypesの並び順でコンパイル時に確定し、
+//! それ以外の型は初回使用時にkBuiltinCount以降を採番する。
+//! GameObjectはこのIDをビット位置としてスロット表を引く（ハッシュ計算・マップ検索なし）。
+//============================================================================
+using ComponentTypeId = uint32_t;
+
+class Transform;
+class SpriteRenderer;
+class Animator;
+class Collider2D;
+class Camera2D;
+class Collider3D;
+class Camera3D;
+class UIButtonComponent;
+class UIGaugeComponent;
+
+namespace ComponentTypeRegistry {
+    static constexpr uint32_t kMaxComponentTypes = 64;  //!< 登録可能なコンポーネント型の上限（スロットマスクのビット数）
+
+    template<typename... Ts>
+    struct TypeList {};
+
+    //! @brief コンパイル時にIDを確定する組み込みコンポーネント（先頭ほど小さいID）
+    using BuiltinTypes = TypeList<
+        Transform, SpriteRenderer, Animator, Collider2D, Camera2D,
+        Collider3D, Camera3D, UIButtonComponent, UIGaugeComponent>;
+
+    //! @brief TypeList内の位置（含まない場合は要素数）
+    template<typename T, typename... Ts>
+    consteval uint32_t IndexOf(TypeList<Ts...>) noexcept {
+        uint32_t index = 0;
+        ((std::is_same_v<T, Ts> ? false : (++index, true)) && ...);
+        return index;
+    }
+
+    template<typename... Ts>
+    consteval uint32_t CountOf(TypeList<Ts...>) noexcept { return sizeof...(Ts); }
+
+    static constexpr uint32_t kBuiltinCount = CountOf(BuiltinTypes{});
+
+    //! @brief 組み込み型のID（組み込みでなければkBuiltinCount）
+    template<typename T>
+    inline constexpr uint32_t kBuiltinId = IndexOf<std::remove_cv_t<T>>(BuiltinTypes{});
+
+    //! @brief 組み込み以外の型の次のIDを採番
+    //! @note 上限超過はリリースビルドでも異常終了する
+    //!       （IDはスロットマスクのビット位置・配列の添字になるため、超えると以降の参照が壊れる）
+    inline uint32_t NextDynamicId() noexcept {
+        static std::atomic<uint32_t> counter{ kBuiltinCount };
+        const uint32_t id = counter.fetch_add(1, std::memory_order_relaxed);
+        if (id >= kMaxComponentTypes) {
+            std::fprintf(stderr, "[ComponentTypeRegistry] Too many component types (max %u); raise kMaxComponentTypes\n",
+                         kMaxComponentTypes);
+            std::abort();
+        }
+        return id;
+    }
+
+    //! @brief コンポーネント型のIDを取得
+    template<typename T>
+    inline ComponentTypeId GetId() noexcept {
+        if constexpr (kBuiltinId<T> < kBuiltinCount) {
+            return kBuiltinId<T>;
+        } else {
+            static const ComponentTypeId id = NextDynamicId();
+            return id;
+        }
+    }
+}
+
 //============================================================================
 //! @brief コンポーネントの型IDを取得するテンプレート関数
 //! @tparam T コンポーネント型
-//! @return 型ID
+//! @return 型ID（0からの密な連番）
 //============================================================================
 template<typename T>
-[[nodiscard]] inline size_t GetComponentTypeId() noexcept {
-    static const size_t id = typeid(T).hash_code();
-    return id;
+[[nodiscard]] inline ComponentTypeId GetComponentTypeId() noexcept {
+    return ComponentTypeRegistry::GetId<T>();
 }
@@ -0,0 +1,129 @@
+//----------------------------------------------------------------------------
+//! @file   component_storage.cpp
+//! @brief  アーキタイプ別チャンク格納 実装
+//----------------------------------------------------------------------------
+#include "component_storage.h"
+#include <algorithm>
+#include <memory>
+
+namespace {
+
+//! @brief offsetをalignの倍数に切り上げ
+constexpr size_t AlignUp(size_t offset, size_t align) noexcept
+{
+    return (offset + align - 1) / align * align;
+}
+
+} // namespace
+
+//============================================================================
+// Archetype
+//============================================================================
+
+Archetype::Archetype(std::vector<ArchetypeColumnDesc> columns)
+{
+    assert(!columns.empty() && columns.size() <= kMaxColumns);
+    columns_.reserve(columns.size());
+    size_t rowBytes = sizeof(uint32_t);
+    for (const ArchetypeColumnDesc& desc : columns) {
+        assert(desc.align <= kChunkAlignment && "Component alignment exceeds chunk alignment");
+        columns_.push_back({ desc, 0 });
+        typeMask_ |= uint64_t(1) << desc.typeId;
+        rowBytes += desc.size;
+    }
+
+    // アラインメントの詰め物を考慮し、収まる最大行数まで減らす
+    uint32_t rows = static_cast<uint32_t>((std::max)(kChunkBytes / rowBytes, size_t(1)));
+    while (rows > 1 && !Layout(rows)) {
+        --rows;
+    }
+    const bool fits = Layout(rows);
+    assert(fits && "Component set does not fit in one chunk");
+    (void)fits;
+    rowsPerChunk_ = rows;
+}
+
+Archetype::~Archetype()
+{
+    assert(liveRows_ == 0 && "GameObjects must be destroyed before ComponentStorage");
+    for (Chunk& chunk : chunks_) {
+        ::operator delete(chunk.data, std::align_val_t{ kChunkAlignment });
+    }
+}
+
+bool Archetype::Layout(uint32_t rows)
+{
+    size_t offset = sizeof(uint32_t) * rows;  // 行マスク
+    for (Column& column : columns_) {
+        offset = AlignUp(offset, column.desc.align);
+        column.offset = offset;
+        offset += static_cast<size_t>(column.desc.size) * rows;
+    }
+    return offset <= kChunkBytes;
+}
+
+bool Archetype::HasSignature(std::span<const ArchetypeColumnDesc> columns) const noexcept
+{
+    if (columns.size() != columns_.size()) return false;
+    for (size_t i = 0; i < columns.size(); ++i) {
+        if (columns[i].typeId != columns_[i].desc.typeId) return false;
+    }
+    return true;
+}
+
+ArchetypeRow Archetype::AllocateRow()
+{
+    ArchetypeRow result;
+    result.archetype = this;
+
+    if (!freeRows_.empty()) {
+        result = freeRows_.back();
+        freeRows_.pop_back();
+    } else {
+        if (chunks_.empty() || chunks_.back().usedRows == rowsPerChunk_) {
+            Chunk chunk;
+            chunk.data = static_cast<std::byte*>(::operator new(kChunkBytes, std::align_val_t{ kChunkAlignment }));
+            // 行マスクのみ初期化（コンポーネント領域は構築時に書き込まれる）
+            std::uninitialized_fill_n(reinterpret_cast<uint32_t*>(chunk.data), rowsPerChunk_, 0u);
+            chunks_.push_back(chunk);
+        }
+        result.chunk = static_cast<uint32_t>(chunks_.size() - 1);
+        result.row = chunks_.back().usedRows++;
+    }
+
+    GetRowMasks(chunks_[result.chunk])[result.row] = kRowAliveBit;
+    ++liveRows_;
+    return result;
+}
+
+void Archetype::FreeRow(const ArchetypeRow& row)
+{
+    assert(row.archetype == this);
+    uint32_t& mask = GetRowMasks(chunks_[row.chunk])[row.row];
+    assert((mask & ~kRowAliveBit) == 0 && "Destroy components before freeing the row");
+    mask = 0;
+    freeRows_.push_back(row);
+    --liveRows_;
+}
+
+//============================================================================
+// ComponentStorage
+//============================================================================
+
+Archetype& ComponentStorage::GetOrCreateArchetype(std::vector<ArchetypeColumnDesc> columns)
+{
+    // 型の指定順によらず同じアーキタイプになるよう型IDで整列
+    std::sort(columns.begin(), columns.end(),
+        [](const ArchetypeColumnDesc& a, const ArchetypeColumnDesc& b) { return a.typeId < b.typeId; });
+    assert(std::adjacent_find(columns.begin(), columns.end(),
+        [](const ArchetypeColumnDesc& a, const ArchetypeColumnDesc& b) { return a.typeId == b.typeId; })
+        == columns.end() && "Duplicate component type in layout");
+
+    for (const auto& archetype : archetypes_) {
+        if (archetype->HasSignature(columns)) {
+            return *archetype;
+        }
+    }
+    archetypes_.push_back(std::make_unique<Archetype>(std::move(columns)));
+    return *archetypes_.back();
+}
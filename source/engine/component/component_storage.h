@@ -0,0 +1,260 @@
+//----------------------------------------------------------------------------
+//! @file   component_storage.h
+//! @brief  アーキタイプ別チャンク格納（同じコンポーネント構成のエンティティを型ごとに連続配置）
+//!
+//! @details
+//! 同じコンポーネント構成（アーキタイプ）を持つGameObjectの各コンポーネントを、
+//! 16KBチャンク内に型ごとの連続配列として格納する。
+//! ForEach<Transform, Animator>(fn) は該当アーキタイプのチャンクを先頭から線形に走査する。
+//!
+//! チャンク内のレイアウト:
+//! @code
+//!   [行マスク uint32_t × N][列0: T0 × N][列1: T1 × N]...   (N = 1チャンクの行数)
+//! @endcode
+//! 行マスクのビットiは列iのコンポーネントが構築済みであることを示し、
+//! 最上位ビットは行が使用中であることを示す。
+//!
+//! @note 行は移動しない（削除は空き行として再利用）。
+//!       コンポーネントへのポインタは所有GameObjectの破棄まで有効で、
+//!       CollisionManager等に登録したポインタやエンティティ側のキャッシュを壊さない。
+//!       構成は生成時に確定するため、後から別の型を追加した場合は
+//!       その型のみGameObject側のヒープ格納になる。
+//!
+//! @note 毎フレームの更新は従来どおりGameObject::Update()（一括更新の登録型は
+//!       ComponentUpdateRegistry）で行われ、ForEachは使っていない。
+//!       ここで得られるのはチャンクへの配置による局所性のみで、
+//!       ForEachはエンティティ単位の状態を必要としないシステム側のループ用。
+//!
+//! @note スレッドセーフ性: メインスレッドからのみ呼び出し可能
+//----------------------------------------------------------------------------
+#pragma once
+
+#include "component.h"
+#include "common/utility/non_copyable.h"
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class Archetype;
+
+//============================================================================
+//! @brief GameObject生成時のコンポーネント構成指定
+//! @code
+//!   auto obj = std::make_unique<GameObject>("Arrow", ComponentLayout<Transform, SpriteRenderer, Collider2D>{});
+//! @endcode
+//============================================================================
+template<typename... Ts>
+struct ComponentLayout {};
+
+//============================================================================
+//! @brief アーキタイプの列（コンポーネント型）の記述
+//============================================================================
+struct ArchetypeColumnDesc {
+    ComponentTypeId typeId = 0;  //!< GetComponentTypeId<T>()
+    uint32_t size = 0;           //!< sizeof(T)
+    uint32_t align = 0;          //!< alignof(T)
+
+    template<typename T>
+    [[nodiscard]] static ArchetypeColumnDesc Of() noexcept {
+        return { GetComponentTypeId<T>(), static_cast<uint32_t>(sizeof(T)), static_cast<uint32_t>(alignof(T)) };
+    }
+};
+
+//============================================================================
+//! @brief アーキタイプ内の行の位置（GameObjectが保持するハンドル）
+//============================================================================
+struct ArchetypeRow {
+    Archetype* archetype = nullptr;  //!< 所属アーキタイプ（ヒープ格納のGameObjectはnullptr）
+    uint32_t chunk = 0;              //!< チャンク番号
+    uint32_t row = 0;                //!< チャンク内の行番号
+
+    [[nodiscard]] bool IsValid() const noexcept { return archetype != nullptr; }
+};
+
+//============================================================================
+//! @brief 同一コンポーネント構成のエンティティを格納するチャンク列
+//============================================================================
+class Archetype final : private NonCopyableNonMovable
+{
+public:
+    static constexpr size_t kChunkBytes = 16 * 1024;      //!< チャンクサイズ
+    static constexpr size_t kChunkAlignment = 64;         //!< チャンク先頭のアラインメント
+    static constexpr uint32_t kMaxColumns = 31;           //!< 列数の上限（行マスクのビット数）
+    static constexpr uint32_t kRowAliveBit = 1u << 31;    //!< 行マスク: 使用中
+
+    //! @param columns 列の記述（型IDの昇順・重複なし）
+    explicit Archetype(std::vector<ArchetypeColumnDesc> columns);
+    ~Archetype();
+
+    //------------------------------------------------------------------------
+    // 構成
+    //------------------------------------------------------------------------
+
+    //! @brief 型の列番号を取得（含まない場合は-1）
+    //! @note 列は型IDの昇順なので、列番号は型マスクの下位ビット数になる
+    [[nodiscard]] int FindColumn(ComponentTypeId typeId) const noexcept {
+        if (!((typeMask_ >> typeId) & 1u)) return -1;
+        return std::popcount(typeMask_ & ((uint64_t(1) << typeId) - 1));
+    }
+
+    template<typename T>
+    [[nodiscard]] int FindColumn() const noexcept { return FindColumn(GetComponentTypeId<T>()); }
+
+    //! @brief 列構成が一致するか
+    [[nodiscard]] bool HasSignature(std::span<const ArchetypeColumnDesc> columns) const noexcept;
+
+    [[nodiscard]] uint32_t GetColumnCount() const noexcept { return static_cast<uint32_t>(columns_.size()); }
+    [[nodiscard]] uint32_t GetRowsPerChunk() const noexcept { return rowsPerChunk_; }
+    [[nodiscard]] uint32_t GetChunkCount() const noexcept { return static_cast<uint32_t>(chunks_.size()); }
+    [[nodiscard]] uint32_t GetLiveRowCount() const noexcept { return liveRows_; }
+
+    //------------------------------------------------------------------------
+    // 行
+    //------------------------------------------------------------------------
+
+    //! @brief 行を確保（空き行があれば再利用、なければチャンク末尾）
+    [[nodiscard]] ArchetypeRow AllocateRow();
+
+    //! @brief 行を解放（構築済みコンポーネントは呼び出し側で破棄済みであること）
+    void FreeRow(const ArchetypeRow& row);
+
+    //! @brief 列のコンポーネント格納位置（未構築でもアドレスは有効）
+    [[nodiscard]] void* GetSlot(uint32_t column, const ArchetypeRow& row) const noexcept {
+        const Chunk& chunk = chunks_[row.chunk];
+        return chunk.data + columns_[column].offset + static_cast<size_t>(row.row) * columns_[column].desc.size;
+    }
+
+    //! @brief 列のコンポーネントの構築状態を設定
+    void SetConstructed(uint32_t column, const ArchetypeRow& row, bool constructed) noexcept {
+        uint32_t& mask = GetRowMasks(chunks_[row.chunk])[row.row];
+        mask = constructed ? (mask | (1u << column)) : (mask & ~(1u << column));
+    }
+
+    [[nodiscard]] bool IsConstructed(uint32_t column, const ArchetypeRow& row) const noexcept {
+        return (GetRowMasks(chunks_[row.chunk])[row.row] & (1u << column)) != 0;
+    }
+
+    //------------------------------------------------------------------------
+    // クエリ
+    //------------------------------------------------------------------------
+
+    //! @brief 指定型がすべて構築済みの行を線形に走査
+    //! @param fn void(Ts&...)
+    //! @note Tsは格納時の型と完全一致で指定する（基底クラス指定は不可）
+    //! @note 走査中にこのアーキタイプのGameObjectを生成・破棄しないこと
+    template<typename... Ts, typename Fn>
+    void ForEach(Fn&& fn) {
+        ForEachImpl<Ts...>(fn, std::index_sequence_for<Ts...>{});
+    }
+
+private:
+    struct Column {
+        ArchetypeColumnDesc desc;
+        size_t offset = 0;  //!< チャンク先頭から列配列までのバイト数
+    };
+
+    struct Chunk {
+        std::byte* data = nullptr;  //!< kChunkBytes（kChunkAlignment境界）
+        uint32_t usedRows = 0;      //!< 一度でも使用した行数（走査範囲）
+    };
+
+    [[nodiscard]] static uint32_t* GetRowMasks(const Chunk& chunk) noexcept {
+        return std::launder(reinterpret_cast<uint32_t*>(chunk.data));
+    }
+
+    //! @brief 行数から列オフセットを計算し、チャンクに収まるか判定
+    bool Layout(uint32_t rows);
+
+    template<typename... Ts, typename Fn, size_t... I>
+    void ForEachImpl(Fn& fn, std::index_sequence<I...>) {
+        const std::array<int, sizeof...(Ts)> columns{ FindColumn<Ts>()... };
+        uint32_t required = kRowAliveBit;
+        for (int column : columns) {
+            if (column < 0) return;
+            required |= 1u << column;
+        }
+        for (const Chunk& chunk : chunks_) {
+            const uint32_t* masks = GetRowMasks(chunk);
+            const std::array<std::byte*, sizeof...(Ts)> bases{ chunk.data + columns_[columns[I]].offset... };
+            for (uint32_t row = 0; row < chunk.usedRows; ++row) {
+                if ((masks[row] & required) != required) continue;
+                fn(*std::launder(reinterpret_cast<Ts*>(bases[I] + static_cast<size_t>(row) * sizeof(Ts)))...);
+            }
+        }
+    }
+
+    std::vector<Column> columns_;          //!< 型IDの昇順
+    uint64_t typeMask_ = 0;                //!< 列に含まれる型IDのビット集合
+    uint32_t rowsPerChunk_ = 0;
+    std::vector<Chunk> chunks_;
+    std::vector<ArchetypeRow> freeRows_;   //!< 解放済みの行（LIFOで再利用）
+    uint32_t liveRows_ = 0;
+};
+
+//============================================================================
+//! @brief アーキタイプ別コンポーネント格納（シングルトン）
+//============================================================================
+class ComponentStorage final : private NonCopyableNonMovable
+{
+public:
+    //! @brief シングルトンインスタンス取得
+    static ComponentStorage& Get()
+    {
+        assert(instance_ && "ComponentStorage::Create() must be called first");
+        return *instance_;
+    }
+
+    //! @brief インスタンス生成
+    static void Create()
+    {
+        if (!instance_) {
+            instance_ = std::unique_ptr<ComponentStorage>(new ComponentStorage());
+        }
+    }
+
+    //! @brief インスタンス破棄
+    //! @note 格納中のGameObjectをすべて破棄した後に呼ぶこと
+    static void Destroy()
+    {
+        instance_.reset();
+    }
+
+    ~ComponentStorage() = default;
+
+    //! @brief 構成に対応するアーキタイプを取得（なければ生成）
+    template<typename... Ts>
+    [[nodiscard]] Archetype& GetOrCreateArchetype() {
+        static_assert((std::is_base_of_v<Component, Ts> && ...), "Ts must derive from Component");
+        static_assert(sizeof...(Ts) > 0 && sizeof...(Ts) <= Archetype::kMaxColumns, "Invalid component count");
+        return GetOrCreateArchetype({ ArchetypeColumnDesc::Of<Ts>()... });
+    }
+
+    //! @brief 指定型をすべて持つエンティティのコンポーネントを走査
+    //! @param fn void(Ts&...)
+    //! @note アーキタイプ単位で、チャンク内は連続アクセスになる
+    template<typename... Ts, typename Fn>
+    void ForEach(Fn&& fn) {
+        for (const auto& archetype : archetypes_) {
+            archetype->ForEach<Ts...>(fn);
+        }
+    }
+
+    [[nodiscard]] size_t GetArchetypeCount() const noexcept { return archetypes_.size(); }
+
+private:
+    ComponentStorage() = default;
+
+    Archetype& GetOrCreateArchetype(std::vector<ArchetypeColumnDesc> columns);
+
+    static inline std::unique_ptr<ComponentStorage> instance_ = nullptr;
+
+    std::vector<std::unique_ptr<Archetype>> archetypes_;  //!< 生成順（アドレスは固定）
+};
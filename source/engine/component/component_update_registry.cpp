@@ -0,0 +1,15 @@
+//----------------------------------------------------------------------------
+//! @file   component_update_registry.cpp
+//! @brief  コンポーネント一括更新レジストリ 実装
+//----------------------------------------------------------------------------
+#include "component_update_registry.h"
+#include "engine/core/job_system.h"
+
+bool ComponentUpdateRegistry::RunParallel(uint32_t count, const std::function<void(uint32_t, uint32_t)>& func)
+{
+    if (!JobSystem::IsCreated() || JobSystem::Get().GetWorkerCount() == 0) {
+        return false;
+    }
+    JobSystem::Get().ParallelForRange(0, count, func).Wait();
+    return true;
+}
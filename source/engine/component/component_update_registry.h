@@ -0,0 +1,244 @@
+//----------------------------------------------------------------------------
+//! @file   component_update_registry.h
+//! @brief  コンポーネント型ごとの一括更新（バッチ更新）の登録と実行
+//!
+//! @details
+//! 一括更新を登録した型のコンポーネントは、GameObject::Update()で仮想Updateを
+//! 呼ばずにこのレジストリの型別キューへ積まれ、Run()で型ごとにまとめて処理される。
+//! オブジェクト単位（Transform, Collider2D, Animator, Transform, ...）ではなく
+//! 型単位（Collider2D全部 → Animator全部）で処理するため、同じコードとデータが続く。
+//! 一括更新を登録していない型は従来どおりGameObject::Update()内で仮想Updateを呼ぶ。
+//!
+//! @code
+//!   auto& registry = ComponentUpdateRegistry::Get();
+//!   registry.Register<Collider2D, &Collider2D::SyncAll>(0);
+//!   registry.Register<Animator, &Animator::UpdateAll>(10);
+//!   ...
+//!   registry.Run();  // フレーム内の全GameObject::Update()の後
+//! @endcode
+//!
+//! @note キューに積まれるのはGameObject::Update()で更新対象になった有効な
+//!       コンポーネントのみ（時間停止・非アクティブによる更新スキップは従来どおり）。
+//!       deltaTimeも各GameObject::Update()に渡された値を要素ごとに保持する。
+//!
+//! @note スレッドセーフ性: メインスレッドからのみ呼び出し可能
+//!       （Parallel指定のバッチ関数のみJobSystemのワーカーで実行される）
+//----------------------------------------------------------------------------
+#pragma once
+
+#include "component.h"
+#include "common/utility/non_copyable.h"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+//============================================================================
+//! @brief 一括更新に渡す1要素
+//============================================================================
+template<typename T>
+struct ComponentUpdateItem {
+    T* component;       //!< 更新対象（有効なコンポーネント）
+    float deltaTime;    //!< GameObject::Update()に渡された経過時間（秒）
+};
+
+//============================================================================
+//! @brief 一括更新の実行方法
+//============================================================================
+enum class ComponentBatchMode : uint8_t {
+    Sequential,  //!< メインスレッドで一括実行
+    Parallel     //!< JobSystemで要素範囲を分割して並列実行（要素間で共有状態を書かないこと）
+};
+
+//============================================================================
+//! @brief コンポーネント一括更新レジストリ（シングルトン）
+//============================================================================
+class ComponentUpdateRegistry final : private NonCopyableNonMovable
+{
+public:
+    //! @brief 並列実行する最小要素数（これ未満はメインスレッドで実行）
+    static constexpr uint32_t kMinParallelItems = 256;
+
+    //! @brief シングルトンインスタンス取得
+    static ComponentUpdateRegistry& Get()
+    {
+        assert(instance_ && "ComponentUpdateRegistry::Create() must be called first");
+        return *instance_;
+    }
+
+    //! @brief インスタンスが生成済みか
+    [[nodiscard]] static bool IsCreated() noexcept { return instance_ != nullptr; }
+
+    //! @brief インスタンス生成
+    static void Create()
+    {
+        if (!instance_) {
+            instance_ = std::unique_ptr<ComponentUpdateRegistry>(new ComponentUpdateRegistry());
+        }
+    }
+
+    //! @brief インスタンス破棄
+    static void Destroy()
+    {
+        instance_.reset();
+    }
+
+    ~ComponentUpdateRegistry() = default;
+
+    //------------------------------------------------------------------------
+    //! @brief 型の一括更新を登録
+    //! @tparam T コンポーネント型
+    //! @tparam BatchFn void(std::span<const ComponentUpdateItem<T>>)
+    //! @param order 実行順（小さいほど先、同値は登録順）
+    //! @param mode 実行方法
+    //! @note 対象型のGameObjectを生成する前に登録すること
+    //!       （登録前にアタッチされたコンポーネントは仮想Updateのまま）
+    //------------------------------------------------------------------------
+    template<typename T, auto BatchFn>
+    void Register(int order, ComponentBatchMode mode = ComponentBatchMode::Sequential)
+    {
+        static_assert(std::is_base_of_v<Component, T>, "T must derive from Component");
+        static_assert(std::is_invocable_v<decltype(BatchFn), std::span<const ComponentUpdateItem<T>>>,
+                      "BatchFn must be callable as void(std::span<const ComponentUpdateItem<T>>)");
+
+        const ComponentTypeId typeId = GetComponentTypeId<T>();
+        assert(!batches_[typeId] && "Batch update already registered for this component type");
+        auto batch = std::make_unique<TypedBatch<T, BatchFn>>(order, mode);
+        auto it = std::upper_bound(runOrder_.begin(), runOrder_.end(), order,
+            [](int value, const IBatch* registered) { return value < registered->order; });
+        runOrder_.insert(it, batch.get());
+        batches_[typeId] = std::move(batch);
+        batchMask_ |= uint64_t(1) << typeId;
+    }
+
+    //! @brief 型に一括更新が登録されているか
+    [[nodiscard]] bool HasBatch(ComponentTypeId typeId) const noexcept
+    {
+        return (batchMask_ >> typeId) & 1u;
+    }
+
+    //! @brief 一括更新キューに積む（GameObject::Updateから呼ばれる）
+    void Enqueue(ComponentTypeId typeId, Component* component, float deltaTime)
+    {
+        batches_[typeId]->Enqueue(component, deltaTime);
+    }
+
+    //! @brief キューから除外（実行前にコンポーネントが破棄される場合）
+    //! @note 要素は空きにするだけなのでO(1)（Run()で実行前にまとめて詰める）
+    void Cancel(ComponentTypeId typeId, Component* component) noexcept
+    {
+        if (HasBatch(typeId)) {
+            batches_[typeId]->Cancel(component);
+        }
+    }
+
+    //------------------------------------------------------------------------
+    //! @brief 登録順に全型の一括更新を実行し、キューを空にする
+    //------------------------------------------------------------------------
+    void Run()
+    {
+        for (IBatch* batch : runOrder_) {
+            batch->Run();
+        }
+    }
+
+    //! @brief 実行せずにキューを空にする
+    void Clear() noexcept
+    {
+        for (IBatch* batch : runOrder_) {
+            batch->Clear();
+        }
+    }
+
+private:
+    ComponentUpdateRegistry() = default;
+
+    //! @brief キューに積まれていない
+    static constexpr uint32_t kNotQueued = UINT32_MAX;
+
+    //! @brief JobSystemで範囲を分割して実行し、完了まで待つ
+    //! @return JobSystemが使えず実行しなかった場合はfalse
+    static bool RunParallel(uint32_t count, const std::function<void(uint32_t, uint32_t)>& func);
+
+    struct IBatch {
+        IBatch(int o, ComponentBatchMode m) noexcept : order(o), mode(m) {}
+        virtual ~IBatch() = default;
+        virtual void Enqueue(Component* component, float deltaTime) = 0;
+        virtual void Cancel(Component* component) noexcept = 0;
+        virtual void Run() = 0;
+        virtual void Clear() noexcept = 0;
+
+        int order;
+        ComponentBatchMode mode;
+    };
+
+    template<typename T, auto BatchFn>
+    struct TypedBatch final : IBatch {
+        using IBatch::IBatch;
+
+        void Enqueue(Component* component, float deltaTime) override {
+            // 同じフレームに複数回積まれた場合に備え、前の位置を連結しておく
+            previous.push_back(QueuedIndex(component));
+            component->updateQueueIndex_ = static_cast<uint32_t>(items.size());
+            items.push_back({ static_cast<T*>(component), deltaTime });
+        }
+
+        void Cancel(Component* component) noexcept override {
+            // 要素は消さずに空き（nullptr）にし、Run()でまとめて詰める
+            for (uint32_t index = QueuedIndex(component); index != kNotQueued; index = previous[index]) {
+                items[index].component = nullptr;
+                ++cancelledCount;
+            }
+            component->updateQueueIndex_ = kNotQueued;
+        }
+
+        void Run() override {
+            if (cancelledCount > 0) {
+                std::erase_if(items, [](const ComponentUpdateItem<T>& item) {
+                    return item.component == nullptr;
+                });
+            }
+
+            if (!items.empty()) {
+                const std::span<const ComponentUpdateItem<T>> all(items);
+                const uint32_t count = static_cast<uint32_t>(all.size());
+                const bool parallel = mode == ComponentBatchMode::Parallel && count >= kMinParallelItems &&
+                    RunParallel(count, [all](uint32_t begin, uint32_t end) {
+                        BatchFn(all.subspan(begin, end - begin));
+                    });
+                if (!parallel) {
+                    BatchFn(all);
+                }
+            }
+            Clear();
+        }
+
+        void Clear() noexcept override {
+            items.clear();
+            previous.clear();
+            cancelledCount = 0;
+        }
+
+        //! @brief 今回のキュー内の位置（積まれていなければkNotQueued）
+        //! @note Run()/Clear()後に残った古い位置は要素の指す先が一致しないため無視される
+        uint32_t QueuedIndex(const Component* component) const noexcept {
+            const uint32_t index = component->updateQueueIndex_;
+            return index < items.size() && items[index].component == component ? index : kNotQueued;
+        }
+
+        std::vector<ComponentUpdateItem<T>> items;  //!< 今回の更新対象（GameObject::Update順、取り消し済みはnullptr）
+        std::vector<uint32_t> previous;             //!< 同じコンポーネントの1つ前の位置（なければkNotQueued）
+        uint32_t cancelledCount = 0;                //!< 取り消し済み要素数
+    };
+
+    static inline std::unique_ptr<ComponentUpdateRegistry> instance_ = nullptr;
+
+    std::array<std::unique_ptr<IBatch>, ComponentTypeRegistry::kMaxComponentTypes> batches_;  //!< 型ID→バッチ
+    std::vector<IBatch*> runOrder_;  //!< 実行順
+    uint64_t batchMask_ = 0;         //!< 登録済み型IDのビット集合
+};
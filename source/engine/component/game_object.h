@@ -5,17 +5,29 @@
 #pragma once
 
 #include "component.h"
+#include "component_storage.h"
+#include "component_update_registry.h"
 #include <vector>
 #include <memory>
 #include <string>
 #include <algorithm>
-#include <unordered_map>
+#include <bit>
+#include <new>
+#include <utility>
 
 //============================================================================
 //! @brief ゲームオブジェクトクラス
 //!
 //! コンポーネントをアタッチして機能を構築するエンティティ。
 //! Transform、SpriteRendererなどのコンポーネントを持つ。
+//!
+//! ComponentLayoutを指定して生成した場合、構成に含まれる型のコンポーネントは
+//! ComponentStorageのアーキタイプのチャンク内に直接構築され、
+//! GameObjectはその行へのハンドルとして振る舞う。
+//! 構成外の型や指定なしで生成した場合はヒープに個別確保する。
+//!
+//! GetComponentは型IDのビットで引くスロット表で解決する（同じ型が複数ある場合は最初の1つ）。
+//! ComponentUpdateRegistryに一括更新が登録された型は、Update()で型別キューに積まれる。
 //============================================================================
 class GameObject {
 public:
@@ -26,19 +38,35 @@ public:
     explicit GameObject(const std::string& name = "GameObject")
         : name_(name) {}
 
+    //------------------------------------------------------------------------
+    //! @brief コンストラクタ（アーキタイプ格納）
+    //! @param name オブジェクト名
+    //! @param layout コンポーネント構成（AddComponentでこの型を追加するとチャンク内に構築）
+    //------------------------------------------------------------------------
+    template<typename... Ts>
+    GameObject(const std::string& name, [[maybe_unused]] ComponentLayout<Ts...> layout)
+        : name_(name)
+        , row_(ComponentStorage::Get().GetOrCreateArchetype<Ts...>().AllocateRow()) {}
+
     ~GameObject() {
-        // 全コンポーネントをデタッチ
-        for (auto& comp : components_) {
-            comp->OnDetach();
-            comp->owner_ = nullptr;
-        }
+        DestroyComponents();
     }
 
     // コピー禁止、ムーブ許可
     GameObject(const GameObject&) = delete;
     GameObject& operator=(const GameObject&) = delete;
-    GameObject(GameObject&&) = default;
-    GameObject& operator=(GameObject&&) = default;
+
+    GameObject(GameObject&& other) noexcept {
+        MoveFrom(other);
+    }
+
+    GameObject& operator=(GameObject&& other) noexcept {
+        if (this != &other) {
+            DestroyComponents();
+            MoveFrom(other);
+        }
+        return *this;
+    }
 
     //------------------------------------------------------------------------
     //! @brief コンポーネントを追加
@@ -51,14 +79,34 @@ public:
     T* AddComponent(Args&&... args) {
         static_assert(std::is_base_of_v<Component, T>, "T must derive from Component");
 
-        auto component = std::make_unique<T>(std::forward<Args>(args)...);
-        T* ptr = component.get();
+        // 構成に含まれる型ならチャンク内の行に構築（同じ型の2つ目以降はヒープ）
+        T* ptr = nullptr;
+        int column = -1;
+        if (row_.IsValid()) {
+            column = row_.archetype->FindColumn<T>();
+            if (column >= 0 && !row_.archetype->IsConstructed(static_cast<uint32_t>(column), row_)) {
+                ptr = ::new (row_.archetype->GetSlot(static_cast<uint32_t>(column), row_))
+                    T(std::forward<Args>(args)...);
+                row_.archetype->SetConstructed(static_cast<uint32_t>(column), row_, true);
+            } else {
+                column = -1;
+            }
+        }
+        if (!ptr) {
+            auto component = std::make_unique<T>(std::forward<Args>(args)...);
+            ptr = component.get();
+            ownedComponents_.push_back(std::move(component));
+        }
         ptr->owner_ = this;
-        components_.push_back(std::move(component));
+        const ComponentTypeId typeId = GetComponentTypeId<T>();
+        const bool batched = ComponentUpdateRegistry::IsCreated() &&
+                             ComponentUpdateRegistry::Get().HasBatch(typeId);
+        components_.push_back({ ptr, typeId, column, batched });
 
-        // 型IDでマップに登録（O(1)ルックアップ用）
-        size_t typeId = GetComponentTypeId<T>();
-        componentMap_[typeId].push_back(ptr);
+        // 同じ型の最初の1つをスロット表に登録
+        if (!HasSlot(typeId)) {
+            InsertSlot(typeId, ptr);
+        }
 
         ptr->OnAttach();
         return ptr;
@@ -73,12 +121,11 @@ public:
     [[nodiscard]] T* GetComponent() const {
         static_assert(std::is_base_of_v<Component, T>, "T must derive from Component");
 
-        size_t typeId = GetComponentTypeId<T>();
-        auto it = componentMap_.find(typeId);
-        if (it != componentMap_.end() && !it->second.empty()) {
-            return static_cast<T*>(it->second.front());
+        const ComponentTypeId typeId = GetComponentTypeId<T>();
+        if (!HasSlot(typeId)) {
+            return nullptr;
         }
-        return nullptr;
+        return static_cast<T*>(slots_[SlotIndex(typeId)]);
     }
 
     //------------------------------------------------------------------------
@@ -90,18 +137,17 @@ public:
     [[nodiscard]] std::vector<T*> GetComponents() const {
         static_assert(std::is_base_of_v<Component, T>, "T must derive from Component");
 
-        size_t typeId = GetComponentTypeId<T>();
-        auto it = componentMap_.find(typeId);
-        if (it != componentMap_.end()) {
-            std::vector<T*> result;
-            result.reserve(it->second.size());
-            for (Component* comp : it->second) {
-                result.push_back(static_cast<T*>(comp));
-            }
+        const ComponentTypeId typeId = GetComponentTypeId<T>();
+        std::vector<T*> result;
+        if (!HasSlot(typeId)) {
             return result;
         }
-        
-        return {};
+        for (const AttachedComponent& attached : components_) {
+            if (attached.typeId == typeId) {
+                result.push_back(static_cast<T*>(attached.component));
+            }
+        }
+        return result;
     }
 
     //------------------------------------------------------------------------
@@ -113,41 +159,52 @@ public:
     bool RemoveComponent() {
         static_assert(std::is_base_of_v<Component, T>, "T must derive from Component");
 
-        size_t typeId = GetComponentTypeId<T>();
-        auto mapIt = componentMap_.find(typeId);
-        if (mapIt == componentMap_.end() || mapIt->second.empty()) {
+        const ComponentTypeId typeId = GetComponentTypeId<T>();
+        if (!HasSlot(typeId)) {
             return false;
         }
 
-        // マップから最初のコンポーネントを取得
-        Component* toRemove = mapIt->second.front();
-        mapIt->second.erase(mapIt->second.begin());
-
-        // 所有権リストから削除
+        // スロットの（同じ型で最初の）コンポーネントをアタッチ順リストから削除
+        Component* toRemove = slots_[SlotIndex(typeId)];
         auto it = std::find_if(components_.begin(), components_.end(),
-            [toRemove](const auto& comp) {
-                return comp.get() == toRemove;
+            [toRemove](const AttachedComponent& attached) {
+                return attached.component == toRemove;
             });
+        const AttachedComponent attached = *it;
+        components_.erase(it);
 
-        if (it != components_.end()) {
-            (*it)->OnDetach();
-            (*it)->owner_ = nullptr;
-            components_.erase(it);
-            return true;
+        // 同じ型が残っていれば次の1つをスロットへ、なければスロットを削除
+        auto next = std::find_if(components_.begin(), components_.end(),
+            [typeId](const AttachedComponent& remaining) {
+                return remaining.typeId == typeId;
+            });
+        if (next != components_.end()) {
+            slots_[SlotIndex(typeId)] = next->component;
+        } else {
+            EraseSlot(typeId);
         }
-        return false;
+
+        attached.component->OnDetach();
+        attached.component->owner_ = nullptr;
+        DestroyComponent(attached);
+        return true;
     }
 
     //------------------------------------------------------------------------
     //! @brief 全コンポーネントを更新
     //! @param deltaTime 前フレームからの経過時間（秒）
+    //! @note 一括更新が登録された型はここでは更新せず、
+    //!       ComponentUpdateRegistry::Run()でまとめて更新される
     //------------------------------------------------------------------------
     void Update(float deltaTime) {
         if (!active_) return;
 
-        for (auto& comp : components_) {
-            if (comp->IsEnabled()) {
-                comp->Update(deltaTime);
+        for (const AttachedComponent& attached : components_) {
+            if (!attached.component->IsEnabled()) continue;
+            if (attached.batched) {
+                ComponentUpdateRegistry::Get().Enqueue(attached.typeId, attached.component, deltaTime);
+            } else {
+                attached.component->Update(deltaTime);
             }
         }
     }
@@ -165,10 +222,115 @@ public:
     [[nodiscard]] int GetLayer() const noexcept { return layer_; }
     void SetLayer(int layer) noexcept { layer_ = layer; }
 
+    //! @brief アーキタイプ内の行（ヒープ格納ならIsValid()==false）
+    [[nodiscard]] const ArchetypeRow& GetArchetypeRow() const noexcept { return row_; }
+
 private:
+    //! @brief アタッチ済みコンポーネント
+    struct AttachedComponent {
+        Component* component;
+        ComponentTypeId typeId;
+        int column;    //!< アーキタイプの列番号（ヒープ格納は-1）
+        bool batched;  //!< 一括更新の対象（Update()でキューに積む）
+    };
+
+    //------------------------------------------------------------------------
+    // スロット表（slotMask_のビットiが立っていれば型ID iのコンポーネントがある）
+    // slots_は型IDの昇順に詰めて並べ、位置は下位ビットのpopcountで求める。
+    //------------------------------------------------------------------------
+    static_assert(ComponentTypeRegistry::kMaxComponentTypes <= 64, "slotMask_ is 64 bits");
+
+    [[nodiscard]] bool HasSlot(ComponentTypeId typeId) const noexcept {
+        return (slotMask_ >> typeId) & 1u;
+    }
+
+    [[nodiscard]] size_t SlotIndex(ComponentTypeId typeId) const noexcept {
+        return static_cast<size_t>(std::popcount(slotMask_ & ((uint64_t(1) << typeId) - 1)));
+    }
+
+    void InsertSlot(ComponentTypeId typeId, Component* component) {
+        slots_.insert(slots_.begin() + static_cast<ptrdiff_t>(SlotIndex(typeId)), component);
+        slotMask_ |= uint64_t(1) << typeId;
+    }
+
+    void EraseSlot(ComponentTypeId typeId) {
+        slots_.erase(slots_.begin() + static_cast<ptrdiff_t>(SlotIndex(typeId)));
+        slotMask_ &= ~(uint64_t(1) << typeId);
+    }
+
+    //! @brief コンポーネントを破棄（デタッチ済みであること）
+    void DestroyComponent(const AttachedComponent& attached) {
+        if (attached.batched) {
+            CancelQueuedUpdate(attached);
+        }
+        if (attached.column >= 0) {
+            // 仮想デストラクタで実際の型を破棄し、行の領域は残す
+            attached.component->~Component();
+            row_.archetype->SetConstructed(static_cast<uint32_t>(attached.column), row_, false);
+            return;
+        }
+        auto it = std::find_if(ownedComponents_.begin(), ownedComponents_.end(),
+            [&attached](const std::unique_ptr<Component>& owned) {
+                return owned.get() == attached.component;
+            });
+        if (it != ownedComponents_.end()) {
+            ownedComponents_.erase(it);
+        }
+    }
+
+    //! @brief 今フレームの一括更新キューに残っていれば除外
+    static void CancelQueuedUpdate(const AttachedComponent& attached) noexcept {
+        if (ComponentUpdateRegistry::IsCreated()) {
+            ComponentUpdateRegistry::Get().Cancel(attached.typeId, attached.component);
+        }
+    }
+
+    //! @brief 全コンポーネントをデタッチ・破棄し、行を返却
+    void DestroyComponents() {
+        for (const AttachedComponent& attached : components_) {
+            attached.component->OnDetach();
+            attached.component->owner_ = nullptr;
+        }
+        for (const AttachedComponent& attached : components_) {
+            if (attached.column >= 0) {
+                DestroyComponent(attached);
+            } else if (attached.batched) {
+                CancelQueuedUpdate(attached);
+            }
+        }
+        components_.clear();
+        slots_.clear();
+        slotMask_ = 0;
+        ownedComponents_.clear();
+        if (row_.IsValid()) {
+            row_.archetype->FreeRow(row_);
+            row_ = {};
+        }
+    }
+
+    void MoveFrom(GameObject& other) noexcept {
+        name_ = std::move(other.name_);
+        components_ = std::move(other.components_);
+        ownedComponents_ = std::move(other.ownedComponents_);
+        slots_ = std::move(other.slots_);
+        slotMask_ = std::exchange(other.slotMask_, 0);
+        row_ = std::exchange(other.row_, {});
+        active_ = other.active_;
+        layer_ = other.layer_;
+        other.components_.clear();
+        other.ownedComponents_.clear();
+        other.slots_.clear();
+        for (const AttachedComponent& attached : components_) {
+            attached.component->owner_ = this;
+        }
+    }
+
     std::string name_;
-    std::vector<std::unique_ptr<Component>> components_;          //!< コンポーネント所有権
-    std::unordered_map<size_t, std::vector<Component*>> componentMap_;  //!< 型ID→コンポーネント（O(1)ルックアップ用）
+    std::vector<AttachedComponent> components_;                   //!< アタッチ順（Update順）
+    std::vector<std::unique_ptr<Component>> ownedComponents_;     //!< ヒープ格納のコンポーネント所有権
+    std::vector<Component*> slots_;                               //!< 型ごとの最初のコンポーネント（型IDの昇順）
+    uint64_t slotMask_ = 0;                                       //!< slots_に存在する型IDのビット集合
+    ArchetypeRow row_;                                            //!< アーキタイプ格納の行（ハンドル）
     bool active_ = true;
     int layer_ = 0;  //!< 描画/更新の優先度
 };
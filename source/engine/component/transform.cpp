@@ -0,0 +1,27 @@
+//----------------------------------------------------------------------------
+//! @file   transform.cpp
+//! @brief  Transformコンポーネント 実装
+//----------------------------------------------------------------------------
+#include "transform.h"
+#include "collider2d.h"
+#include "game_object.h"
+
+void Transform::OnAttach()
+{
+    GameObject* owner = GetOwner();
+    if (!owner) return;
+    for (Collider2D* collider : owner->GetComponents<Collider2D>()) {
+        collider->OnTransformAttached();
+    }
+}
+
+void Transform::OnDetach()
+{
+    // CollisionManagerが同期元として保持しているポインタを無効化する
+    // （Collider2Dだけが残った場合に解放済みのTransformを読まないように）
+    GameObject* owner = GetOwner();
+    if (!owner) return;
+    for (Collider2D* collider : owner->GetComponents<Collider2D>()) {
+        collider->OnTransformDetached(this);
+    }
+}
@@ -5,15 +5,22 @@
 #pragma once
 
 #include "component.h"
+#include "transform_hierarchy.h"
 #include "engine/math/math_types.h"
+#include "engine/math/affine2d.h"
 #include <vector>
 #include <algorithm>
+#include <cstdint>
 
 //============================================================================
 //! @brief トランスフォームコンポーネント
 //!
 //! 位置・回転・スケールを管理する。
 //! 親子階層をサポートし、ローカル/ワールド座標系の変換機能を提供。
+//!
+//! ワールド行列・位置・回転・スケールはキャッシュし、変更時のみ再計算する。
+//! 親子関係を持つTransformはTransformHierarchyが毎フレーム深さ順に一括更新する。
+//! 自身と祖先がすべて2D回転の場合、4x4行列の代わりにAffine2Dで合成する。
 //============================================================================
 class Transform : public Component {
 public:
@@ -22,15 +29,19 @@ public:
     //! @brief デストラクタ
     //! @note 親子関係を安全にクリーンアップ
     ~Transform() {
+        if (hierarchyIndex_ != TransformHierarchy::kInvalidIndex) {
+            TransformHierarchy::Get().OnDestroyed(this);
+        }
         // 親から自分を削除
         if (parent_) {
             auto& siblings = parent_->children_;
             siblings.erase(std::remove(siblings.begin(), siblings.end(), this), siblings.end());
             parent_ = nullptr;
         }
-        // 子の親参照をクリア
+        // 子の親参照をクリア（ワールド変換が変わるためダーティにする）
         for (Transform* child : children_) {
             child->parent_ = nullptr;
+            child->SetDirty();
         }
         children_.clear();
     }
@@ -51,6 +62,18 @@ public:
     Transform(const Vector2& position, float rotation, const Vector2& scale)
         : position_(position), rotation_(rotation), scale_(scale) {}
 
+    //------------------------------------------------------------------------
+    // Component オーバーライド
+    //------------------------------------------------------------------------
+
+    //! @brief アタッチ時に同じGameObjectの未登録のCollider2Dを位置同期に登録
+    //! @note Collider2DがTransformより先に追加された場合も、次の衝突判定から正しい位置を使う
+    void OnAttach() override;
+
+    //! @brief デタッチ時に同じGameObjectのCollider2Dの位置同期を解除
+    //! @note CollisionManagerが同期元としてポインタを保持しているため
+    void OnDetach() override;
+
     //------------------------------------------------------------------------
     // 位置
     //------------------------------------------------------------------------
@@ -265,6 +288,11 @@ public:
             parent_->children_.push_back(this);
         }
 
+        // 階層配列の並べ替えを予約
+        if (TransformHierarchy::IsCreated()) {
+            TransformHierarchy::Get().OnParentChanged(this, parent_);
+        }
+
         SetDirty();
     }
 
@@ -304,63 +332,43 @@ public:
 
     //! @brief ワールド位置を取得（XY）
     [[nodiscard]] Vector2 GetWorldPosition() {
-        if (parent_) {
-            Vector3 localPos(position_.x, position_.y, z_);
-            Vector3 worldPos = Vector3::Transform(localPos, parent_->GetWorldMatrix());
-            return Vector2(worldPos.x, worldPos.y);
-        }
-        return position_;
+        if (!parent_) return position_;
+        EnsureWorld();
+        return Vector2(worldPosition_.x, worldPosition_.y);
     }
 
     //! @brief ワールドZ座標を取得
     [[nodiscard]] float GetWorldZ() {
-        if (parent_) {
-            Vector3 localPos(position_.x, position_.y, z_);
-            Vector3 worldPos = Vector3::Transform(localPos, parent_->GetWorldMatrix());
-            return worldPos.z;
-        }
-        return z_;
+        if (!parent_) return z_;
+        EnsureWorld();
+        return worldPosition_.z;
     }
 
     //! @brief ワールド位置を取得（XYZ）
     [[nodiscard]] Vector3 GetWorldPosition3D() {
-        if (parent_) {
-            Vector3 localPos(position_.x, position_.y, z_);
-            return Vector3::Transform(localPos, parent_->GetWorldMatrix());
-        }
-        return Vector3(position_.x, position_.y, z_);
+        if (!parent_) return Vector3(position_.x, position_.y, z_);
+        EnsureWorld();
+        return worldPosition_;
     }
 
-    //! @brief ワールド回転を取得（ラジアン）
+    //! @brief ワールド回転を取得（ラジアン、祖先のZ軸回転の和）
     [[nodiscard]] float GetWorldRotation() {
-        float worldRot = rotation_;
-        Transform* p = parent_;
-        while (p) {
-            worldRot += p->rotation_;
-            p = p->parent_;
-        }
-        return worldRot;
+        if (!parent_) return rotation_;
+        EnsureWorld();
+        return worldRotation_;
     }
 
-    //! @brief ワールドスケールを取得
+    //! @brief ワールドスケールを取得（祖先のスケールの積）
     [[nodiscard]] Vector2 GetWorldScale() {
-        Vector2 worldScale = scale_;
-        Transform* p = parent_;
-        while (p) {
-            worldScale.x *= p->scale_.x;
-            worldScale.y *= p->scale_.y;
-            p = p->parent_;
-        }
-        return worldScale;
+        if (!parent_) return scale_;
+        EnsureWorld();
+        return worldScale_;
     }
 
     //! @brief ワールド位置を設定（ローカル位置を逆算）
     void SetWorldPosition(const Vector2& worldPos) {
         if (parent_) {
-            // 親の逆行列を使ってローカル位置を計算
-            Matrix invParent = parent_->GetWorldMatrix().Invert();
-            Vector3 worldPos3(worldPos.x, worldPos.y, z_);
-            Vector3 localPos3 = Vector3::Transform(worldPos3, invParent);
+            Vector3 localPos3 = ParentInverseTransform(Vector3(worldPos.x, worldPos.y, z_));
             SetPosition(Vector2(localPos3.x, localPos3.y));
         } else {
             SetPosition(worldPos);
@@ -370,8 +378,7 @@ public:
     //! @brief ワールド位置を設定（XYZ、ローカル位置を逆算）
     void SetWorldPosition3D(const Vector3& worldPos) {
         if (parent_) {
-            Matrix invParent = parent_->GetWorldMatrix().Invert();
-            Vector3 localPos3 = Vector3::Transform(worldPos, invParent);
+            Vector3 localPos3 = ParentInverseTransform(worldPos);
             SetPosition(localPos3.x, localPos3.y, localPos3.z);
         } else {
             SetPosition3D(worldPos);
@@ -395,9 +402,7 @@ public:
     //! @brief ワールド行列を取得
     //! @return 3x3相当の変換行列（Matrix4x4形式）
     [[nodiscard]] const Matrix& GetWorldMatrix() {
-        if (dirty_) {
-            UpdateWorldMatrix();
-        }
+        EnsureWorld();
         return worldMatrix_;
     }
 
@@ -406,9 +411,27 @@ public:
         dirty_ = true;
     }
 
+    //------------------------------------------------------------------------
+    // 変更検出
+    //------------------------------------------------------------------------
+
+    //! @brief 変更スタンプを取得（自身と祖先の最新値）
+    //! @return 自身または祖先が変更されるたびに増加する値
+    //! @note 前回取得した値と比較することで、ワールド変換が変わった可能性を
+    //!       行列計算なしで判定できる（CollisionManager::SyncTransforms等で使用）
+    [[nodiscard]] uint64_t GetChangeStamp() const noexcept {
+        uint64_t stamp = changeStamp_;
+        for (const Transform* p = parent_; p; p = p->parent_) {
+            if (p->changeStamp_ > stamp) stamp = p->changeStamp_;
+        }
+        return stamp;
+    }
+
 private:
     //! @brief ダーティフラグを設定（子にも伝播）
     void SetDirty() noexcept {
+        // 変更スタンプは子に伝播せず、GetChangeStamp()で祖先をたどって集約する
+        changeStamp_ = ++s_changeCounter_;
         if (dirty_) return;  // 既にダーティなら子も既にダーティ
         dirty_ = true;
         for (Transform* child : children_) {
@@ -416,36 +439,74 @@ private:
         }
     }
 
-    void UpdateWorldMatrix() {
-        // 変換順序: スケール → 回転 → 移動
-        // ピボットを考慮: -pivot → scale → rotate → +pivot → translate
+    //! @brief ワールド値が古ければ再計算（親も必要に応じて再計算）
+    void EnsureWorld() {
+        if (dirty_) {
+            UpdateWorld();
+        }
+    }
 
-        Matrix pivotMat = Matrix::CreateTranslation(-pivot_.x, -pivot_.y, 0.0f);
-        Matrix scaleMat = Matrix::CreateScale(scale_.x, scale_.y, 1.0f);
+    //! @brief ワールド行列・位置・回転・スケールを再計算
+    //! @note TransformHierarchy::Update()からは親が確定済みの状態で呼ばれる
+    void UpdateWorld() {
+        Transform* parent = parent_;
+        if (parent) {
+            parent->EnsureWorld();
+        }
 
-        // 回転行列：2Dモードと3Dモードで分岐
-        Matrix rotMat;
-        if (use3DRotation_) {
-            rotMat = Matrix::CreateFromQuaternion(rotation3D_);
+        worldRotation_ = parent ? parent->worldRotation_ + rotation_ : rotation_;
+        worldScale_ = parent ? Vector2(parent->worldScale_.x * scale_.x, parent->worldScale_.y * scale_.y) : scale_;
+        worldIs2D_ = !use3DRotation_ && (!parent || parent->worldIs2D_);
+
+        if (worldIs2D_) {
+            // 2x2線形部＋平行移動のみで合成
+            Affine2D local = Affine2D::FromLocal(position_, z_, rotation_, scale_, pivot_);
+            worldAffine_ = parent ? Affine2D::Multiply(local, parent->worldAffine_) : local;
+            worldMatrix_ = worldAffine_.ToMatrix();
+            worldPosition_ = parent ? parent->worldAffine_.TransformPoint(position_.x, position_.y, z_)
+                                    : Vector3(position_.x, position_.y, z_);
         } else {
-            rotMat = Matrix::CreateRotationZ(rotation_);
-        }
+            // 変換順序: スケール → 回転 → 移動
+            // ピボットを考慮: -pivot → scale → rotate → +pivot → translate
+            Matrix pivotMat = Matrix::CreateTranslation(-pivot_.x, -pivot_.y, 0.0f);
+            Matrix scaleMat = Matrix::CreateScale(scale_.x, scale_.y, 1.0f);
+
+            // 回転行列：2Dモードと3Dモードで分岐
+            Matrix rotMat;
+            if (use3DRotation_) {
+                rotMat = Matrix::CreateFromQuaternion(rotation3D_);
+            } else {
+                rotMat = Matrix::CreateRotationZ(rotation_);
+            }
 
-        Matrix pivotBackMat = Matrix::CreateTranslation(pivot_.x, pivot_.y, 0.0f);
-        Matrix transMat = Matrix::CreateTranslation(position_.x, position_.y, z_);
+            Matrix pivotBackMat = Matrix::CreateTranslation(pivot_.x, pivot_.y, 0.0f);
+            Matrix transMat = Matrix::CreateTranslation(position_.x, position_.y, z_);
 
-        Matrix localMatrix = pivotMat * scaleMat * rotMat * pivotBackMat * transMat;
+            Matrix localMatrix = pivotMat * scaleMat * rotMat * pivotBackMat * transMat;
 
-        // 親がいる場合は親のワールド行列を乗算
-        if (parent_) {
-            worldMatrix_ = localMatrix * parent_->GetWorldMatrix();
-        } else {
-            worldMatrix_ = localMatrix;
+            // 親がいる場合は親のワールド行列を乗算
+            Vector3 localPos(position_.x, position_.y, z_);
+            if (parent) {
+                worldMatrix_ = localMatrix * parent->worldMatrix_;
+                worldPosition_ = Vector3::Transform(localPos, parent->worldMatrix_);
+            } else {
+                worldMatrix_ = localMatrix;
+                worldPosition_ = localPos;
+            }
         }
 
         dirty_ = false;
     }
 
+    //! @brief ワールド座標を親のローカル座標に変換
+    Vector3 ParentInverseTransform(const Vector3& worldPos) {
+        parent_->EnsureWorld();
+        if (parent_->worldIs2D_) {
+            return parent_->worldAffine_.InverseTransformPoint(worldPos.x, worldPos.y, worldPos.z);
+        }
+        return Vector3::Transform(worldPos, parent_->worldMatrix_.Invert());
+    }
+
     // ローカル変換
     Vector2 position_ = Vector2::Zero;
     float z_ = 0.0f;                           //!< Z座標（深度）
@@ -459,7 +520,20 @@ private:
     Transform* parent_ = nullptr;
     std::vector<Transform*> children_;
 
-    // キャッシュ
+    // キャッシュ（ワールド値）
+    Affine2D worldAffine_;                     //!< ワールド変換（worldIs2D_のとき有効）
     Matrix worldMatrix_ = Matrix::Identity;
+    Vector3 worldPosition_ = Vector3::Zero;    //!< ローカル原点のワールド位置
+    float worldRotation_ = 0.0f;
+    Vector2 worldScale_ = Vector2::One;
+    bool worldIs2D_ = true;                    //!< 自身と祖先がすべて2D回転
     bool dirty_ = true;
+
+    // TransformHierarchyの配列位置
+    friend class TransformHierarchy;
+    uint32_t hierarchyIndex_ = TransformHierarchy::kInvalidIndex;
+
+    // 変更検出（全Transform共通の単調増加カウンタから採番）
+    uint64_t changeStamp_ = ++s_changeCounter_;
+    static inline uint64_t s_changeCounter_ = 0;
 };
@@ -0,0 +1,87 @@
+//----------------------------------------------------------------------------
+//! @file   transform_hierarchy.cpp
+//! @brief  Transform階層 実装
+//----------------------------------------------------------------------------
+#include "transform_hierarchy.h"
+#include "transform.h"
+#include <algorithm>
+#include <utility>
+
+TransformHierarchy::~TransformHierarchy()
+{
+    // 残っているTransformから登録を外す（以降は遅延計算のみ）
+    for (Transform* transform : nodes_) {
+        if (transform) {
+            transform->hierarchyIndex_ = kInvalidIndex;
+        }
+    }
+}
+
+void TransformHierarchy::Update()
+{
+    if (structureDirty_) {
+        Rebuild();
+    }
+
+    // 親は子より前にあるので、親のワールド値は常に確定済み
+    for (Transform* transform : nodes_) {
+        if (transform->dirty_) {
+            transform->UpdateWorld();
+        }
+    }
+}
+
+void TransformHierarchy::OnParentChanged(Transform* child, Transform* parent)
+{
+    Add(child);
+    if (parent) {
+        Add(parent);
+    }
+    structureDirty_ = true;
+}
+
+void TransformHierarchy::OnDestroyed(Transform* transform) noexcept
+{
+    nodes_[transform->hierarchyIndex_] = nullptr;
+    transform->hierarchyIndex_ = kInvalidIndex;
+    structureDirty_ = true;
+}
+
+void TransformHierarchy::Add(Transform* transform)
+{
+    if (transform->hierarchyIndex_ != kInvalidIndex) return;
+    transform->hierarchyIndex_ = static_cast<uint32_t>(nodes_.size());
+    nodes_.push_back(transform);
+}
+
+void TransformHierarchy::Rebuild()
+{
+    // 破棄済み・親子関係のなくなったノードを除外
+    std::erase_if(nodes_, [](Transform* transform) {
+        if (!transform) return true;
+        if (!transform->parent_ && transform->children_.empty()) {
+            transform->hierarchyIndex_ = kInvalidIndex;
+            return true;
+        }
+        return false;
+    });
+
+    // 深さ（ルートからの段数）で安定ソート
+    std::vector<std::pair<uint32_t, Transform*>> keyed;
+    keyed.reserve(nodes_.size());
+    for (Transform* transform : nodes_) {
+        uint32_t depth = 0;
+        for (const Transform* p = transform->parent_; p; p = p->parent_) {
+            ++depth;
+        }
+        keyed.emplace_back(depth, transform);
+    }
+    std::stable_sort(keyed.begin(), keyed.end(),
+        [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    for (size_t i = 0; i < keyed.size(); ++i) {
+        nodes_[i] = keyed[i].second;
+        nodes_[i]->hierarchyIndex_ = static_cast<uint32_t>(i);
+    }
+    structureDirty_ = false;
+}
@@ -0,0 +1,92 @@
+//----------------------------------------------------------------------------
+//! @file   transform_hierarchy.h
+//! @brief  Transform親子階層のフラット配列と一括ワールド変換更新
+//!
+//! @details
+//! 親子関係を持つTransform（親または子がいるもの）を深さ順に並べた配列で保持し、
+//! Update()で先頭から1回走査して、ダーティなノードのワールド値を再計算する。
+//! 親は必ず子より前にあるため、各ノードの再計算時には親のキャッシュが確定済みで、
+//! 親チェーンの再帰や重複計算が起きない。
+//! 変更のないサブツリーはダーティフラグが立たないので計算されない。
+//!
+//! 親子関係を持たないTransformは登録されない（ワールド値＝ローカル値）。
+//! Update()前にワールド値を読んだ場合は従来どおりその場で遅延計算される。
+//!
+//! @note 親子関係の変更（SetParent・破棄）は配列を再構築するフラグを立てるだけで、
+//!       並べ替えは次のUpdate()でまとめて行う。
+//! @note スレッドセーフ性: メインスレッドからのみ呼び出し可能
+//----------------------------------------------------------------------------
+#pragma once
+
+#include "common/utility/non_copyable.h"
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class Transform;
+
+//============================================================================
+//! @brief Transform階層（シングルトン）
+//============================================================================
+class TransformHierarchy final : private NonCopyableNonMovable
+{
+public:
+    static constexpr uint32_t kInvalidIndex = UINT32_MAX;  //!< 未登録
+
+    //! @brief シングルトンインスタンス取得
+    static TransformHierarchy& Get()
+    {
+        assert(instance_ && "TransformHierarchy::Create() must be called first");
+        return *instance_;
+    }
+
+    //! @brief インスタンスが生成済みか
+    [[nodiscard]] static bool IsCreated() noexcept { return instance_ != nullptr; }
+
+    //! @brief インスタンス生成
+    static void Create()
+    {
+        if (!instance_) {
+            instance_ = std::unique_ptr<TransformHierarchy>(new TransformHierarchy());
+        }
+    }
+
+    //! @brief インスタンス破棄
+    static void Destroy()
+    {
+        instance_.reset();
+    }
+
+    ~TransformHierarchy();
+
+    //------------------------------------------------------------------------
+    //! @brief ダーティなノードのワールド値を深さ順に再計算
+    //! @note フレーム内の移動処理の後、描画の前に1回呼ぶ
+    //------------------------------------------------------------------------
+    void Update();
+
+    //! @brief 登録ノード数
+    [[nodiscard]] size_t GetNodeCount() const noexcept { return nodes_.size(); }
+
+private:
+    friend class Transform;
+
+    TransformHierarchy() = default;
+
+    //! @brief 親子関係の変更を通知（親子とも未登録なら登録）
+    void OnParentChanged(Transform* child, Transform* parent);
+
+    //! @brief 破棄を通知（配列から外す）
+    void OnDestroyed(Transform* transform) noexcept;
+
+    //! @brief 深さ順に並べ直し、親子関係のなくなったノードを外す
+    void Rebuild();
+
+    void Add(Transform* transform);
+
+    static inline std::unique_ptr<TransformHierarchy> instance_ = nullptr;
+
+    std::vector<Transform*> nodes_;  //!< 深さの昇順（Rebuild後）。破棄済みはnullptr
+    bool structureDirty_ = false;    //!< 並べ替えが必要
+};
@@ -1,19 +1,66 @@
 //----------------------------------------------------------------------------
 //! @file   event_bus.h
 //! @brief  EventBus - 型安全なイベント通信システム
+//!
+//! @note 配信方式:
+//!       - Publish(): 発行箇所で全購読者を同期的に呼び出す
+//!       - Enqueue(): 型ごとの連続キューに積み、Dispatch(phase)でまとめて配信する。
+//!         購読者ごとに1ループでバッチを処理するため、発行側のループを汚さない。
+//!       SubscribeBatch()の購読者はstd::span<const T>でバッチ全体を受け取る。
+//!
+//! @note キー付き購読:
+//!       GetRoutingKey()を持つイベント型は、SubscribeKeyed(key, cb)で
+//!       特定キー（所属グループ等）のイベントだけを受け取れる。
+//!       配信はキー→購読者リストのハッシュ参照となり、購読者数に依存しない。
+//!
+//! @note 購読者の格納:
+//!       コールバックはキャプチャを固定長バッファに直接持つInlineFunctionとして
+//!       移動しないスロット配列に置き、優先度バケットの末尾へ挿入する。
+//!       Subscribe/Unsubscribeはソートもリストの複製も行わず、通常のキャプチャ
+//!       （thisのみ等）ではヒープ確保も発生しない。
+//!
+//! @note スレッドセーフ性:
+//!       - Publish(): ロックなし。イベント型ごとの密なIDでフラット配列を引き、
+//!         優先度順の購読者リストのリンクをatomicに辿るだけ。
+//!         ジョブワーカーから並行に呼び出せる。
+//!       - Subscribe()/Unsubscribe(): 型ごとのmutexで直列化する。
+//!         追加はバケット末尾への連結、解除は墓標を立ててリストから外すのみで、
+//!         スロットの再利用（キャプチャの破棄）はEndOfFrameのDispatch()
+//!         （フレームの同期点）でまとめて行う。
+//!         配信中に追加された購読者は同じ配信で呼ばれることがあり、
+//!         解除された購読者はその時点以降呼ばれない。
+//!       - Dispatch(EventPhase::EndOfFrame)はワーカーのPublishが完了した後、
+//!         メインスレッドから呼ぶこと。
+//!
+//! @note 計測（EVENT_BUS_STATS、event_bus_stats.h参照）:
+//!       型ごとのフレーム別Publish/Enqueue数、購読者数、購読者ごとの
+//!       累計・最大処理時間をGetStats()/DumpStats()で取得できる。
+//!       無効時は計測コードごとコンパイルから除外される。
 //----------------------------------------------------------------------------
 #pragma once
 
 #include <functional>
-#include <unordered_map>
 #include <vector>
-#include <typeindex>
 #include <memory>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <mutex>
-#include <shared_mutex>
+#include <atomic>
 #include <cassert>
 #include <algorithm>
+#include <concepts>
+#include <array>
+#include <span>
+#include "common/utility/inline_function.h"
+#include "event_bus_stats.h"
+
+#if EVENT_BUS_STATS
+#include <cinttypes>
+#include <cstdio>
+#include <string>
+#include <typeinfo>
+#endif
 
 //----------------------------------------------------------------------------
 //! @brief イベント優先度
@@ -24,6 +71,58 @@ enum class EventPriority : uint8_t {
     Low = 2      //!< 低優先度（UI更新など）
 };
 
+//----------------------------------------------------------------------------
+//! @brief 遅延イベントの配信フェーズ
+//----------------------------------------------------------------------------
+enum class EventPhase : uint8_t {
+    PostUpdate = 0,  //!< ゲームロジック更新の直後
+    EndOfFrame = 1,  //!< フレーム末尾（全システム更新の後）
+    Count
+};
+
+static constexpr size_t kEventPhaseCount = static_cast<size_t>(EventPhase::Count);
+
+//----------------------------------------------------------------------------
+//! @brief イベント型ID（密な連番）
+//! @details 型ごとに初回使用時に一度だけ採番し、以降は定数として参照する。
+//!          typeid/type_indexのハッシュ計算とマップ検索を置き換える。
+//----------------------------------------------------------------------------
+namespace EventTypeRegistry {
+    static constexpr uint32_t kMaxEventTypes = 256;  //!< 登録可能なイベント型の上限
+
+    //! @brief 次のIDを採番
+    //! @note 上限超過はリリースビルドでも異常終了する（IDはハンドラ配列の添字になるため）
+    inline uint32_t NextId() noexcept {
+        static std::atomic<uint32_t> counter{ 0 };
+        const uint32_t id = counter.fetch_add(1, std::memory_order_relaxed);
+        if (id >= kMaxEventTypes) {
+            std::fprintf(stderr, "[EventTypeRegistry] Too many event types (max %u); raise kMaxEventTypes\n",
+                         kMaxEventTypes);
+            std::abort();
+        }
+        return id;
+    }
+
+    //! @brief イベント型のIDを取得
+    template<typename TEvent>
+    inline uint32_t GetId() noexcept {
+        static const uint32_t id = NextId();
+        return id;
+    }
+}
+
+//----------------------------------------------------------------------------
+//! @brief キー付き配信のルーティングキー
+//----------------------------------------------------------------------------
+using EventRoutingKey = const void*;
+
+//! @brief ルーティングキーを持つイベント型
+//! @details `EventRoutingKey GetRoutingKey() const` を実装した型はSubscribeKeyed()で購読できる
+template<typename TEvent>
+concept KeyedEvent = requires(const TEvent& event) {
+    { event.GetRoutingKey() } -> std::convertible_to<EventRoutingKey>;
+};
+
 //----------------------------------------------------------------------------
 //! @brief イベントハンドラの基底クラス
 //----------------------------------------------------------------------------
@@ -31,77 +130,573 @@ class IEventHandler
 {
 public:
     virtual ~IEventHandler() = default;
+
+    //! @brief 指定フェーズのキューを購読者へ配信
+    virtual void DispatchQueued(EventPhase phase) = 0;
+
+    //! @brief 全購読と未配信イベントを破棄
+    virtual void ClearSubscribers() = 0;
+
+    //! @brief 解除済みスロットと拡張前のテーブルを回収（同期点でのみ呼ぶ）
+    virtual void ReclaimRetired() = 0;
+
+#if EVENT_BUS_STATS
+    //! @brief フレーム境界で発行数を確定
+    virtual void EndFrameStats() = 0;
+
+    //! @brief 計測結果を集計
+    [[nodiscard]] virtual EventBusStats::TypeStats CollectStats(double msPerTick) const = 0;
+
+    //! @brief 計測結果をリセット
+    virtual void ResetStats() = 0;
+#endif
 };
 
 //----------------------------------------------------------------------------
 //! @brief 型付きイベントハンドラ
-//! @details shared_mutexを使用して読み取り並行性を向上
-//!          優先度付きコールバックをサポート
-//!          shared_ptr<vector>でInvoke時のコピーを最小化
+//! @details 購読者は固定長チャンクのスロット配列に格納し、スロットは移動しない。
+//!          リストは優先度順に並んだ単方向リストで、優先度ごとの末尾（バケット境界）を
+//!          書き込み側で保持するため、追加はバケット末尾への挿入のみで
+//!          ソートもリストの複製も行わない。
+//!          読み取り側（Invoke/DispatchQueued）はatomicなリンクを辿るだけでロックなし。
+//!          解除は墓標（aliveフラグを下ろす）を立ててリストから外すが、
+//!          スロット自身のリンクは残すため、そのスロット上にいる読み取り側は
+//!          後続へ進める。スロットの再利用は同期点（ReclaimRetired）でまとめて行う。
+//!          遅延イベントはフェーズごとの連続配列に蓄積する
 //----------------------------------------------------------------------------
 template<typename TEvent>
 class EventHandler : public IEventHandler
 {
 public:
-    using CallbackType = std::function<void(const TEvent&)>;
+    //! 購読者スロットにインライン格納するキャプチャの上限（超過分はヒープ）
+    static constexpr size_t kInlineCallbackSize = 48;
 
-    //! @brief コールバックエントリ（優先度付き）
-    struct CallbackEntry {
-        uint32_t id;
-        CallbackType callback;
-        EventPriority priority;
+    //! @brief 購読者コールバック（イベント列を受け取る共通形式）
+    //! @details 1件ずつの購読者もここに包んで格納し、バッチ配信時は購読者内でループする
+    using RangeCallback = InlineFunction<void(const TEvent*, size_t), kInlineCallbackSize>;
 
-        bool operator<(const CallbackEntry& other) const noexcept {
-            return priority < other.priority;  // 優先度昇順（High=0が先）
-        }
-    };
+    EventHandler() = default;
 
-    using CallbackList = std::vector<CallbackEntry>;
-    using CallbackListPtr = std::shared_ptr<const CallbackList>;
+    //! @brief コールバックを追加
+    //! @return 購読ID（スロット番号と世代を含む。0は無効）
+    template<typename Fn>
+    uint32_t Add(Fn&& callback, EventPriority priority = EventPriority::Normal) {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        return AddLocked(globalList_, WrapPerEvent(std::forward<Fn>(callback)), priority, false, nullptr);
+    }
 
-    EventHandler() : snapshot_(std::make_shared<CallbackList>()) {}
+    //! @brief バッチコールバックを追加
+    template<typename Fn>
+    uint32_t AddBatch(Fn&& callback, EventPriority priority = EventPriority::Normal) {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        auto wrapper = [fn = std::forward<Fn>(callback)](const TEvent* events, size_t count) mutable {
+            fn(std::span<const TEvent>(events, count));
+        };
+        return AddLocked(globalList_, RangeCallback(std::move(wrapper)), priority, true, nullptr);
+    }
 
-    void Add(uint32_t id, CallbackType callback, EventPriority priority = EventPriority::Normal) {
-        std::unique_lock<std::shared_mutex> lock(mutex_);
-        callbacks_.push_back({id, std::move(callback), priority});
-        // 即座にソート（Invoke時の遅延ソートを廃止）
-        std::stable_sort(callbacks_.begin(), callbacks_.end());
-        // 新しいスナップショットを作成（既存のInvokeには影響しない）
-        snapshot_ = std::make_shared<CallbackList>(callbacks_);
+    //! @brief キー付きコールバックを追加
+    template<typename Fn>
+    uint32_t AddKeyed(EventRoutingKey key, Fn&& callback, EventPriority priority = EventPriority::Normal) {
+        assert(key != nullptr && "Routing key must not be null");
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        SubscriberList& list = FindOrInsertKeyLocked(key);
+        return AddLocked(list, WrapPerEvent(std::forward<Fn>(callback)), priority, false, key);
     }
 
+    //! @brief 購読を解除（墓標を立ててリストから外す。スロットは同期点で回収）
+    //! @note 解除後は配信中であっても以降の呼び出し対象から外れる
     void Remove(uint32_t id) {
-        std::unique_lock<std::shared_mutex> lock(mutex_);
-        callbacks_.erase(
-            std::remove_if(callbacks_.begin(), callbacks_.end(),
-                [id](const CallbackEntry& e) { return e.id == id; }),
-            callbacks_.end());
-        // 新しいスナップショットを作成
-        snapshot_ = std::make_shared<CallbackList>(callbacks_);
-    }
-
-    void Invoke(const TEvent& event) {
-        // shared_ptrのコピーのみ（ベクタのコピーなし）
-        CallbackListPtr localSnapshot;
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        const uint32_t index = (id & kSlotIndexMask) - 1;
+        if (id == 0 || index >= slotCount_) return;
+        Slot& slot = GetSlot(index);
+        if (slot.id != id || !slot.alive.load(std::memory_order_relaxed)) return;  // 該当なし・解除済み
+        slot.alive.store(false, std::memory_order_release);
+
+        SubscriberList* list = &globalList_;
+        if (slot.key != nullptr) {
+            list = FindKeyLocked(slot.key);
+            assert(list && "Keyed slot without key entry");
+        }
+        UnlinkLocked(*list, slot);
+        if (slot.key != nullptr && list->IsEmpty()) {
+            hasEmptyKeys_ = true;
+        }
+        retiredSlots_.push_back(&slot);
+        liveCount_.fetch_sub(1, std::memory_order_release);
+    }
+
+    void Invoke(const TEvent& event) const {
+#if EVENT_BUS_STATS
+        typeCounters_.CountPublish();
+#endif
+        // リンクを辿るのみ（ロックなし）
+        InvokeList(globalList_, &event, 1);
+
+        if constexpr (KeyedEvent<TEvent>) {
+            InvokeKeyed(event);
+        }
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return liveCount_.load(std::memory_order_acquire) == 0;
+    }
+
+    //! @brief 遅延キューにイベントを追加
+    //! @return キューが空だった場合true（呼び出し側で配信待ちに登録する）
+    bool Enqueue(EventPhase phase, const TEvent& event) {
+#if EVENT_BUS_STATS
+        typeCounters_.CountEnqueue(1);
+#endif
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        std::vector<TEvent>& queue = queues_[static_cast<size_t>(phase)];
+        queue.push_back(event);
+        return queue.size() == 1;
+    }
+
+    //! @brief 遅延キューに複数イベントをまとめて追加
+    //! @return キューが空だった場合true（呼び出し側で配信待ちに登録する）
+    bool Enqueue(EventPhase phase, std::span<const TEvent> events) {
+#if EVENT_BUS_STATS
+        typeCounters_.CountEnqueue(static_cast<uint32_t>(events.size()));
+#endif
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        std::vector<TEvent>& queue = queues_[static_cast<size_t>(phase)];
+        const bool wasEmpty = queue.empty();
+        queue.insert(queue.end(), events.begin(), events.end());
+        return wasEmpty && !queue.empty();
+    }
+
+    //! @brief 遅延キューのバッチを購読者ごとに1ループで配信
+    //! @note 配信中にEnqueueされたイベントは次回のDispatchで配信される
+    void DispatchQueued(EventPhase phase) override {
+        const size_t phaseIndex = static_cast<size_t>(phase);
+        std::vector<TEvent> batch;
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            batch.swap(queues_[phaseIndex]);
+        }
+        if (batch.empty()) return;
+
+        // 1購読者につきバッチ全体を1回で渡す（計測も1回として記録）
+        InvokeList(globalList_, batch.data(), batch.size());
+
+        // キー付き購読者はイベントごとにキーのリストのみ呼ぶ
+        if constexpr (KeyedEvent<TEvent>) {
+            for (const TEvent& event : batch) {
+                InvokeKeyed(event);
+            }
+        }
+
+        // 配信中に新たな積み込みがなければ容量を再利用
+        batch.clear();
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        if (queues_[phaseIndex].empty()) {
+            queues_[phaseIndex].swap(batch);
+        }
+    }
+
+    void ClearSubscribers() override {
         {
-            std::shared_lock<std::shared_mutex> lock(mutex_);
-            localSnapshot = snapshot_;
+            std::lock_guard<std::mutex> lock(writeMutex_);
+            // 全スロットを墓標にしてリストとキーテーブルを空にする
+            // （配信中の読み取りがあり得るため、スロットとテーブルは同期点まで残す）
+            for (uint32_t index = 0; index < slotCount_; ++index) {
+                Slot& slot = GetSlot(index);
+                if (slot.alive.load(std::memory_order_relaxed)) {
+                    slot.alive.store(false, std::memory_order_release);
+                    retiredSlots_.push_back(&slot);
+                }
+            }
+            globalList_.Reset();
+            keyTable_.store(nullptr, std::memory_order_release);
+            if (ownedKeyTable_) {
+                retiredKeyTables_.push_back(std::move(ownedKeyTable_));
+            }
+            hasEmptyKeys_ = false;
+            liveCount_.store(0, std::memory_order_release);
+        }
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        for (auto& queue : queues_) {
+            queue.clear();
         }
-        // ロック解放後にコールバック実行（再入可能）
-        for (const auto& entry : *localSnapshot) {
-            entry.callback(event);
+    }
+
+    //! @brief 墓標のスロットを再利用可能にし、空になったキーを削除する（同期点でのみ呼ぶ）
+    void ReclaimRetired() override {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        retiredKeyTables_.clear();
+        for (Slot* slot : retiredSlots_) {
+            ReleaseSlotLocked(*slot);
+        }
+        retiredSlots_.clear();  // 容量は再利用
+
+        if (!hasEmptyKeys_) return;
+        hasEmptyKeys_ = false;
+        KeyTable* table = keyTable_.load(std::memory_order_relaxed);
+        if (!table) return;
+        for (uint32_t i = 0; i <= table->mask; ) {
+            KeyEntry& entry = table->entries[i];
+            if (entry.key.load(std::memory_order_relaxed) != nullptr && entry.list.IsEmpty()) {
+                // 後方シフトで詰めるため、同じ位置を再検査する
+                EraseKeyLocked(*table, i);
+                continue;
+            }
+            ++i;
+        }
+    }
+
+#if EVENT_BUS_STATS
+    void EndFrameStats() override {
+        typeCounters_.EndFrame();
+    }
+
+    [[nodiscard]] EventBusStats::TypeStats CollectStats(double msPerTick) const override {
+        EventBusStats::TypeStats stats;
+        stats.name = typeid(TEvent).name();
+        stats.typeId = EventTypeRegistry::GetId<TEvent>();
+        stats.publishLastFrame = typeCounters_.publishLastFrame.load(std::memory_order_relaxed);
+        stats.enqueueLastFrame = typeCounters_.enqueueLastFrame.load(std::memory_order_relaxed);
+        stats.publishMaxFrame = typeCounters_.publishMaxFrame.load(std::memory_order_relaxed);
+        stats.publishTotal = typeCounters_.publishTotal.load(std::memory_order_relaxed);
+        stats.enqueueTotal = typeCounters_.enqueueTotal.load(std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        for (uint32_t index = 0; index < slotCount_; ++index) {
+            const Slot& slot = GetSlot(index);
+            if (!slot.alive.load(std::memory_order_relaxed)) continue;
+            stats.subscribers.push_back(EventBusStats::MakeSubscriberStats(
+                slot.id, slot.priority, slot.batch, slot.key != nullptr, slot.counters, msPerTick));
+            stats.handlerTotalMs += stats.subscribers.back().totalMs;
         }
+        stats.subscriberCount = static_cast<uint32_t>(stats.subscribers.size());
+        std::sort(stats.subscribers.begin(), stats.subscribers.end(),
+            [](const EventBusStats::SubscriberStats& a, const EventBusStats::SubscriberStats& b) {
+                return a.totalMs > b.totalMs;
+            });
+        return stats;
     }
 
-    [[nodiscard]] bool IsEmpty() const {
-        std::shared_lock<std::shared_mutex> lock(mutex_);
-        return callbacks_.empty();
+    void ResetStats() override {
+        typeCounters_.Reset();
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        for (uint32_t index = 0; index < slotCount_; ++index) {
+            GetSlot(index).counters.Reset();
+        }
     }
+#endif
 
 private:
-    CallbackList callbacks_;         //!< マスターリスト（Add/Remove用）
-    CallbackListPtr snapshot_;       //!< Invoke用スナップショット（shared_ptrで共有）
-    mutable std::shared_mutex mutex_;
+    static constexpr size_t kPriorityCount = 3;                     //!< EventPriorityの段階数
+    static constexpr uint32_t kSlotIndexBits = 16;                  //!< 購読IDのスロット番号部
+    static constexpr uint32_t kSlotIndexMask = (1u << kSlotIndexBits) - 1;
+    static constexpr uint32_t kSlotsPerChunk = 64;                  //!< チャンクあたりのスロット数
+    static constexpr uint32_t kMaxSlots = kSlotIndexMask;           //!< 型あたりの購読者数上限
+    static constexpr uint32_t kMaxChunks = (kMaxSlots + kSlotsPerChunk - 1) / kSlotsPerChunk;
+
+    //! @brief 購読者スロット（チャンク内に固定配置され、移動しない）
+    //! @note 配信時に触れるnext/alive/callbackを先頭にまとめる
+    struct Slot {
+        std::atomic<Slot*> next{ nullptr };     //!< リスト内の次スロット
+        std::atomic<bool> alive{ false };       //!< falseなら墓標（呼び出さない）
+        RangeCallback callback;
+        Slot* prev = nullptr;                   //!< リスト内の前スロット（書き込み側のみ）
+        EventRoutingKey key = nullptr;          //!< キー付き購読のキー（全体購読はnullptr）
+        uint32_t id = 0;                        //!< 購読ID（世代 << 16 | スロット番号+1）
+        uint32_t index = 0;                     //!< スロット番号
+        uint16_t generation = 0;                //!< 再利用のたびに進める（古いIDの誤解除防止）
+        EventPriority priority = EventPriority::Normal;
+        bool batch = false;                     //!< AddBatchによる購読か
+#if EVENT_BUS_STATS
+        mutable EventBusStats::SubscriberCounters counters;  //!< 配信側（const）から更新する
+#endif
+    };
+
+    struct SlotChunk {
+        std::array<Slot, kSlotsPerChunk> slots;
+    };
+
+    //! @brief 優先度順の購読者リスト
+    //! @details 読み取り側はheadから辿るだけ。tailsは優先度バケットごとの最後のスロットで、
+    //!          挿入位置の決定にのみ使う（書き込み側のみ）
+    struct SubscriberList {
+        std::atomic<Slot*> head{ nullptr };
+        std::array<Slot*, kPriorityCount> tails{};
+
+        void Reset() noexcept {
+            head.store(nullptr, std::memory_order_release);
+            tails.fill(nullptr);
+        }
+
+        void CopyFrom(const SubscriberList& other) noexcept {
+            head.store(other.head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            tails = other.tails;
+        }
+
+        [[nodiscard]] bool IsEmpty() const noexcept {
+            return head.load(std::memory_order_relaxed) == nullptr;
+        }
+    };
+
+    //! @brief キー→リストの開番地法テーブル（線形探索、キーnullptrは空き）
+    struct KeyEntry {
+        std::atomic<EventRoutingKey> key{ nullptr };
+        SubscriberList list;
+    };
+
+    struct KeyTable {
+        explicit KeyTable(uint32_t capacity)
+            : mask(capacity - 1)
+            , entries(std::make_unique<KeyEntry[]>(capacity)) {}
+
+        uint32_t mask;                         //!< 容量-1（容量は2のべき乗）
+        uint32_t count = 0;                    //!< 使用中のキー数（書き込み側のみ）
+        std::unique_ptr<KeyEntry[]> entries;
+    };
+
+    static constexpr uint32_t kInitialKeyCapacity = 64;
+
+    static uint32_t HashKey(EventRoutingKey key) noexcept {
+        const uint64_t bits = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key));
+        return static_cast<uint32_t>((bits * 0x9E3779B97F4A7C15ULL) >> 32);
+    }
+
+    //! @brief 1件ずつ受け取るコールバックを共通形式に包む
+    template<typename Fn>
+    static RangeCallback WrapPerEvent(Fn&& callback) {
+        return RangeCallback([fn = std::forward<Fn>(callback)](const TEvent* events, size_t count) mutable {
+            for (size_t i = 0; i < count; ++i) {
+                fn(events[i]);
+            }
+        });
+    }
+
+    [[nodiscard]] Slot& GetSlot(uint32_t index) const noexcept {
+        return chunks_[index / kSlotsPerChunk]->slots[index % kSlotsPerChunk];
+    }
+
+    //! @brief 空きスロットを確保し、優先度バケットの末尾に挿入
+    //! @note writeMutex_を保持した状態で呼び出すこと
+    uint32_t AddLocked(SubscriberList& list, RangeCallback callback, EventPriority priority,
+                       bool batch, EventRoutingKey key) {
+        Slot* slot;
+        if (!freeSlots_.empty()) {
+            slot = freeSlots_.back();
+            freeSlots_.pop_back();
+        } else {
+            assert(slotCount_ < kMaxSlots && "Too many subscribers for one event type");
+            const uint32_t index = slotCount_++;
+            if (!chunks_[index / kSlotsPerChunk]) {
+                chunks_[index / kSlotsPerChunk] = std::make_unique<SlotChunk>();
+            }
+            slot = &GetSlot(index);
+            slot->index = index;
+        }
+
+        slot->callback = std::move(callback);
+        slot->id = (static_cast<uint32_t>(slot->generation) << kSlotIndexBits) | (slot->index + 1);
+        slot->priority = priority;
+        slot->batch = batch;
+        slot->key = key;
+        slot->alive.store(true, std::memory_order_relaxed);
+
+        // 挿入位置: 同じ優先度の末尾、なければより高い優先度の末尾、なければ先頭
+        const size_t bucket = static_cast<size_t>(priority);
+        Slot* prev = nullptr;
+        for (size_t b = bucket + 1; b-- > 0; ) {
+            if (list.tails[b]) {
+                prev = list.tails[b];
+                break;
+            }
+        }
+        Slot* next = prev ? prev->next.load(std::memory_order_relaxed)
+                          : list.head.load(std::memory_order_relaxed);
+        slot->prev = prev;
+        slot->next.store(next, std::memory_order_relaxed);
+        if (next) {
+            next->prev = slot;
+        }
+        // 連結をreleaseで公開（読み取り側はスロットの初期化済み内容を見る）
+        if (prev) {
+            prev->next.store(slot, std::memory_order_release);
+        } else {
+            list.head.store(slot, std::memory_order_release);
+        }
+        list.tails[bucket] = slot;
+        liveCount_.fetch_add(1, std::memory_order_release);
+        return slot->id;
+    }
+
+    //! @brief スロットをリストから外す
+    //! @details 外したスロットのnextは書き換えないため、そのスロット上にいる読み取り側は
+    //!          後続へ進める。スロットは同期点まで再利用されない。
+    //! @note writeMutex_を保持した状態で呼び出すこと
+    static void UnlinkLocked(SubscriberList& list, Slot& slot) {
+        Slot* prev = slot.prev;
+        Slot* next = slot.next.load(std::memory_order_relaxed);
+        if (prev) {
+            prev->next.store(next, std::memory_order_release);
+        } else {
+            list.head.store(next, std::memory_order_release);
+        }
+        if (next) {
+            next->prev = prev;
+        }
+        Slot*& tail = list.tails[static_cast<size_t>(slot.priority)];
+        if (tail == &slot) {
+            tail = (prev && prev->priority == slot.priority) ? prev : nullptr;
+        }
+    }
+
+    //! @brief 優先度順に購読者を呼び出し（ロックなし）
+    static void InvokeList(const SubscriberList& list, const TEvent* events, size_t count) {
+        for (const Slot* slot = list.head.load(std::memory_order_acquire); slot;
+             slot = slot->next.load(std::memory_order_acquire)) {
+            if (slot->alive.load(std::memory_order_relaxed)) {
+                CallSlot(*slot, events, count);
+            }
+        }
+    }
+
+    //! @brief 購読者の呼び出し（計測有効時は処理時間を記録）
+    static void CallSlot(const Slot& slot, const TEvent* events, size_t count) {
+#if EVENT_BUS_STATS
+        const uint64_t begin = EventBusStats::ReadTimestamp();
+        slot.callback(events, count);
+        slot.counters.Record(EventBusStats::ReadTimestamp() - begin);
+#else
+        slot.callback(events, count);
+#endif
+    }
+
+    //! @brief イベントのキーに一致する購読者のみ呼び出し（ロックなし）
+    void InvokeKeyed(const TEvent& event) const {
+        const KeyTable* table = keyTable_.load(std::memory_order_acquire);
+        if (!table) return;
+        const EventRoutingKey key = static_cast<EventRoutingKey>(event.GetRoutingKey());
+        if (!key) return;
+        for (uint32_t i = HashKey(key) & table->mask; ; i = (i + 1) & table->mask) {
+            const KeyEntry& entry = table->entries[i];
+            const EventRoutingKey entryKey = entry.key.load(std::memory_order_acquire);
+            if (entryKey == key) {
+                InvokeList(entry.list, &event, 1);
+                return;
+            }
+            if (entryKey == nullptr) return;
+        }
+    }
+
+    //! @brief 登録済みキーのリストを検索
+    //! @note writeMutex_を保持した状態で呼び出すこと
+    SubscriberList* FindKeyLocked(EventRoutingKey key) {
+        KeyTable* table = keyTable_.load(std::memory_order_relaxed);
+        if (!table) return nullptr;
+        for (uint32_t i = HashKey(key) & table->mask; ; i = (i + 1) & table->mask) {
+            KeyEntry& entry = table->entries[i];
+            const EventRoutingKey entryKey = entry.key.load(std::memory_order_relaxed);
+            if (entryKey == key) return &entry.list;
+            if (entryKey == nullptr) return nullptr;
+        }
+    }
+
+    //! @brief キーのリストを取得（なければ登録。負荷率1/2を超えたら倍に拡張）
+    //! @note writeMutex_を保持した状態で呼び出すこと
+    SubscriberList& FindOrInsertKeyLocked(EventRoutingKey key) {
+        if (SubscriberList* list = FindKeyLocked(key)) {
+            return *list;
+        }
+        KeyTable* table = keyTable_.load(std::memory_order_relaxed);
+        const uint32_t capacity = table ? table->mask + 1 : 0;
+        if (!table || (table->count + 1) * 2 > capacity) {
+            // 読み取り中のスレッドがいる可能性があるため、旧テーブルは同期点まで退避
+            auto grown = std::make_unique<KeyTable>(table ? capacity * 2 : kInitialKeyCapacity);
+            if (table) {
+                for (uint32_t i = 0; i <= table->mask; ++i) {
+                    const KeyEntry& entry = table->entries[i];
+                    const EventRoutingKey entryKey = entry.key.load(std::memory_order_relaxed);
+                    if (entryKey != nullptr) {
+                        InsertKeyLocked(*grown, entryKey).CopyFrom(entry.list);
+                    }
+                }
+            }
+            keyTable_.store(grown.get(), std::memory_order_release);
+            if (ownedKeyTable_) {
+                retiredKeyTables_.push_back(std::move(ownedKeyTable_));
+            }
+            ownedKeyTable_ = std::move(grown);
+            table = ownedKeyTable_.get();
+        }
+        return InsertKeyLocked(*table, key);
+    }
+
+    //! @brief 空き位置にキーを登録（リストは空のまま公開）
+    static SubscriberList& InsertKeyLocked(KeyTable& table, EventRoutingKey key) {
+        for (uint32_t i = HashKey(key) & table.mask; ; i = (i + 1) & table.mask) {
+            KeyEntry& entry = table.entries[i];
+            if (entry.key.load(std::memory_order_relaxed) == nullptr) {
+                entry.list.Reset();
+                entry.key.store(key, std::memory_order_release);
+                ++table.count;
+                return entry.list;
+            }
+        }
+    }
+
+    //! @brief キーを削除し、後続の探索列を後方シフトで詰める（同期点でのみ呼ぶ）
+    static void EraseKeyLocked(KeyTable& table, uint32_t index) {
+        uint32_t hole = index;
+        for (uint32_t i = (hole + 1) & table.mask; ; i = (i + 1) & table.mask) {
+            KeyEntry& entry = table.entries[i];
+            const EventRoutingKey entryKey = entry.key.load(std::memory_order_relaxed);
+            if (entryKey == nullptr) break;
+            // 本来の位置がholeより後ろ（i側）にある要素は動かせない
+            const uint32_t home = HashKey(entryKey) & table.mask;
+            if (((i - home) & table.mask) >= ((i - hole) & table.mask)) {
+                KeyEntry& target = table.entries[hole];
+                target.key.store(entryKey, std::memory_order_relaxed);
+                target.list.CopyFrom(entry.list);
+                hole = i;
+            }
+        }
+        table.entries[hole].key.store(nullptr, std::memory_order_relaxed);
+        table.entries[hole].list.Reset();
+        --table.count;
+    }
+
+    //! @brief スロットのキャプチャを破棄して再利用可能にする
+    void ReleaseSlotLocked(Slot& slot) {
+        slot.callback.Reset();
+        slot.next.store(nullptr, std::memory_order_relaxed);
+        slot.prev = nullptr;
+        slot.id = 0;
+        slot.key = nullptr;
+        ++slot.generation;
+#if EVENT_BUS_STATS
+        slot.counters.Reset();
+#endif
+        freeSlots_.push_back(&slot);
+    }
+
+    std::array<std::unique_ptr<SlotChunk>, kMaxChunks> chunks_;  //!< スロット本体（確保後は移動しない）
+    uint32_t slotCount_ = 0;                  //!< 使用したことのあるスロット数
+    std::vector<Slot*> freeSlots_;            //!< 回収済みスロット（容量は再利用）
+    std::vector<Slot*> retiredSlots_;         //!< 解除済み・未回収のスロット（同期点で回収）
+    bool hasEmptyKeys_ = false;               //!< 購読者が空になったキーがあるか
+    std::atomic<uint32_t> liveCount_{ 0 };    //!< 有効な購読者数
+    SubscriberList globalList_;               //!< 全体購読者のリスト
+    mutable std::mutex writeMutex_;           //!< Add/Remove/回収の直列化
+
+    std::atomic<KeyTable*> keyTable_{ nullptr };              //!< 読み取り用ポインタ（未使用ならnullptr）
+    std::unique_ptr<KeyTable> ownedKeyTable_;                 //!< 公開中のキーテーブル（所有）
+    std::vector<std::unique_ptr<KeyTable>> retiredKeyTables_; //!< 拡張前のテーブル（同期点で解放）
+
+    std::array<std::vector<TEvent>, kEventPhaseCount> queues_;  //!< フェーズ別の遅延キュー
+    std::mutex queueMutex_;                                     //!< queues_の保護
+
+#if EVENT_BUS_STATS
+    mutable EventBusStats::TypeCounters typeCounters_;  //!< 発行数（Publishはconstのためmutable）
+#endif
 };
 
 //----------------------------------------------------------------------------
@@ -138,16 +733,40 @@ public:
 
     //! @brief イベントを購読
     //! @tparam TEvent イベント型
-    //! @param callback コールバック関数
+    //! @param callback コールバック関数（void(const TEvent&)）
     //! @param priority 優先度（デフォルト: Normal）
-    //! @return 購読ID（解除時に使用）
-    template<typename TEvent>
-    uint32_t Subscribe(std::function<void(const TEvent&)> callback,
-                       EventPriority priority = EventPriority::Normal) {
-        std::unique_lock<std::shared_mutex> lock(mutex_);
-        uint32_t id = nextSubscriptionId_++;
-        GetOrCreateHandlerLocked<TEvent>()->Add(id, std::move(callback), priority);
-        return id;
+    //! @return 購読ID（解除時に使用。型ごとに一意、0は無効）
+    //! @note キャプチャがEventHandler::kInlineCallbackSize以内ならヒープ確保しない
+    template<typename TEvent, typename Fn>
+        requires std::invocable<Fn&, const TEvent&>
+    uint32_t Subscribe(Fn&& callback, EventPriority priority = EventPriority::Normal) {
+        return GetOrCreateHandler<TEvent>()->Add(std::forward<Fn>(callback), priority);
+    }
+
+    //! @brief イベントをバッチで購読
+    //! @tparam TEvent イベント型
+    //! @param callback Dispatch時にフェーズ内の全イベントを受け取るコールバック
+    //! @param priority 優先度（デフォルト: Normal）
+    //! @return 購読ID（Unsubscribeで解除）
+    //! @note Publish()による同期発行では要素数1のspanで呼ばれる
+    template<typename TEvent, typename Fn>
+        requires std::invocable<Fn&, std::span<const TEvent>>
+    uint32_t SubscribeBatch(Fn&& callback, EventPriority priority = EventPriority::Normal) {
+        return GetOrCreateHandler<TEvent>()->AddBatch(std::forward<Fn>(callback), priority);
+    }
+
+    //! @brief 特定キーのイベントのみを購読
+    //! @tparam TEvent GetRoutingKey()を持つイベント型
+    //! @param key ルーティングキー（例: 所属Group*、nullptr不可）
+    //! @param callback コールバック関数（void(const TEvent&)）
+    //! @param priority 優先度（同一キー内での順序）
+    //! @return 購読ID（Unsubscribeで解除）
+    //! @note キー付き購読者は全体購読者の後に呼ばれる
+    template<KeyedEvent TEvent, typename Fn>
+        requires std::invocable<Fn&, const TEvent&>
+    uint32_t SubscribeKeyed(EventRoutingKey key, Fn&& callback,
+                            EventPriority priority = EventPriority::Normal) {
+        return GetOrCreateHandler<TEvent>()->AddKeyed(key, std::forward<Fn>(callback), priority);
     }
 
     //! @brief イベント購読を解除
@@ -155,8 +774,7 @@ public:
     //! @param subscriptionId 購読ID
     template<typename TEvent>
     void Unsubscribe(uint32_t subscriptionId) {
-        std::shared_lock<std::shared_mutex> lock(mutex_);
-        auto* handler = GetHandlerLocked<TEvent>();
+        auto* handler = GetHandler<TEvent>();
         if (handler) {
             handler->Remove(subscriptionId);
         }
@@ -169,13 +787,10 @@ public:
     //! @brief イベントを発行
     //! @tparam TEvent イベント型
     //! @param event イベントデータ
+    //! @note ロックなし（ワーカースレッドから呼び出し可）
     template<typename TEvent>
     void Publish(const TEvent& event) {
-        EventHandler<TEvent>* handler = nullptr;
-        {
-            std::shared_lock<std::shared_mutex> lock(mutex_);
-            handler = GetHandlerLocked<TEvent>();
-        }
+        const EventHandler<TEvent>* handler = GetHandler<TEvent>();
         if (handler) {
             handler->Invoke(event);
         }
@@ -190,50 +805,244 @@ public:
         Publish(event);
     }
 
+    //------------------------------------------------------------------------
+    // 遅延発行
+    //------------------------------------------------------------------------
+
+    //! @brief イベントを遅延キューに追加
+    //! @tparam TEvent イベント型
+    //! @param event イベントデータ
+    //! @param phase 配信フェーズ（Dispatch(phase)で配信）
+    //! @note 購読者がいない型のイベントは破棄する
+    template<typename TEvent>
+    void Enqueue(const TEvent& event, EventPhase phase = EventPhase::EndOfFrame) {
+        EventHandler<TEvent>* handler = GetHandler<TEvent>();
+        if (!handler || handler->IsEmpty()) return;
+
+        if (handler->Enqueue(phase, event)) {
+            std::lock_guard<std::mutex> lock(pendingMutex_);
+            pending_[static_cast<size_t>(phase)].push_back(handler);
+        }
+    }
+
+    //! @brief 複数イベントをまとめて遅延キューに追加
+    //! @param events イベント列（この順で配信される）
+    //! @param phase 配信フェーズ
+    template<typename TEvent>
+    void Enqueue(std::span<const TEvent> events, EventPhase phase = EventPhase::EndOfFrame) {
+        EventHandler<TEvent>* handler = GetHandler<TEvent>();
+        if (!handler || handler->IsEmpty() || events.empty()) return;
+
+        if (handler->Enqueue(phase, events)) {
+            std::lock_guard<std::mutex> lock(pendingMutex_);
+            pending_[static_cast<size_t>(phase)].push_back(handler);
+        }
+    }
+
+    //! @brief 指定フェーズの遅延イベントを配信
+    //! @details 型ごとに最初のEnqueue順で、各購読者へバッチを1ループで渡す。
+    //!          配信中にEnqueueされたイベントは次回のDispatchに回る。
+    //!          EndOfFrameはフレームの同期点とみなし、解除済みの購読者スロットを回収する。
+    void Dispatch(EventPhase phase) {
+        const size_t phaseIndex = static_cast<size_t>(phase);
+        std::vector<IEventHandler*> handlers;
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex_);
+            handlers.swap(pending_[phaseIndex]);
+        }
+        for (IEventHandler* handler : handlers) {
+            handler->DispatchQueued(phase);
+        }
+
+        // 配信待ちリストの容量を再利用
+        handlers.clear();
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex_);
+            if (pending_[phaseIndex].empty()) {
+                pending_[phaseIndex].swap(handlers);
+            }
+        }
+
+        if (phase == EventPhase::EndOfFrame) {
+            ReclaimRetired();
+#if EVENT_BUS_STATS
+            EndFrameStats();
+#endif
+        }
+    }
+
     //------------------------------------------------------------------------
     // 管理
     //------------------------------------------------------------------------
 
-    //! @brief 全購読をクリア
+    //! @brief 全購読をクリア（未配信の遅延イベントも破棄）
+    //! @note ハンドラ本体は型IDのスロットに残り、Destroy()まで解放しない
     void Clear() {
-        std::unique_lock<std::shared_mutex> lock(mutex_);
-        handlers_.clear();
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex_);
+            for (auto& pending : pending_) {
+                pending.clear();
+            }
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& handler : ownedHandlers_) {
+            handler->ClearSubscribers();
+        }
     }
 
+    //! @brief 解除済みの購読者スロットを回収
+    //! @note 他スレッドがPublish/Dispatch中でない同期点でのみ呼ぶこと
+    void ReclaimRetired() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& handler : ownedHandlers_) {
+            handler->ReclaimRetired();
+        }
+    }
+
+#if EVENT_BUS_STATS
+    //------------------------------------------------------------------------
+    // 計測
+    //------------------------------------------------------------------------
+
+    //! @brief 統計ダンプの出力先
+    using StatsSink = std::function<void(const std::string&)>;
+
+    //! @brief 型ごとの計測結果を取得（購読者の累計処理時間の降順）
+    [[nodiscard]] std::vector<EventBusStats::TypeStats> GetStats() const {
+        const double msPerTick = EventBusStats::GetMillisecondsPerTick();
+        std::vector<EventBusStats::TypeStats> result;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            result.reserve(ownedHandlers_.size());
+            for (const auto& handler : ownedHandlers_) {
+                result.push_back(handler->CollectStats(msPerTick));
+            }
+        }
+        std::sort(result.begin(), result.end(),
+            [](const EventBusStats::TypeStats& a, const EventBusStats::TypeStats& b) {
+                return a.handlerTotalMs > b.handlerTotalMs;
+            });
+        return result;
+    }
+
+    //! @brief 計測結果を表形式の文字列に整形
+    [[nodiscard]] std::string FormatStats() const {
+        std::string text = "[EventBus] stats (frame " + std::to_string(statsFrame_) + ")\n";
+        char line[256];
+        for (const EventBusStats::TypeStats& type : GetStats()) {
+            std::snprintf(line, sizeof(line),
+                "  %-40s subs:%3u  pub/frame:%5u (max %5u)  enq/frame:%5u  total pub:%" PRIu64
+                "  enq:%" PRIu64 "  handler:%.3f ms\n",
+                type.name.c_str(), type.subscriberCount, type.publishLastFrame, type.publishMaxFrame,
+                type.enqueueLastFrame, type.publishTotal, type.enqueueTotal, type.handlerTotalMs);
+            text += line;
+            for (const EventBusStats::SubscriberStats& sub : type.subscribers) {
+                std::snprintf(line, sizeof(line),
+                    "    #%-6u %-6s calls:%8" PRIu64 "  total:%9.3f ms  max:%7.3f ms  avg:%7.4f ms\n",
+                    sub.id, sub.keyed ? "keyed" : (sub.batch ? "batch" : ""), sub.calls,
+                    sub.totalMs, sub.maxMs,
+                    sub.calls > 0 ? sub.totalMs / static_cast<double>(sub.calls) : 0.0);
+                text += line;
+            }
+        }
+        return text;
+    }
+
+    //! @brief 計測結果を出力先へ書き出す（出力先未設定ならstdout）
+    void DumpStats() const {
+        std::string text = FormatStats();
+        if (statsSink_) {
+            statsSink_(text);
+        } else {
+            std::fputs(text.c_str(), stdout);
+        }
+    }
+
+    //! @brief 定期ダンプを設定
+    //! @param intervalFrames EndOfFrameのDispatch何回ごとに出力するか（0で無効）
+    //! @param sink 出力先（nullptrならstdout）
+    void SetStatsDump(uint32_t intervalFrames, StatsSink sink = nullptr) {
+        statsDumpInterval_ = intervalFrames;
+        statsSink_ = std::move(sink);
+    }
+
+    //! @brief 計測結果をリセット
+    void ResetStats() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& handler : ownedHandlers_) {
+            handler->ResetStats();
+        }
+        statsFrame_ = 0;
+    }
+#endif
+
 private:
+#if EVENT_BUS_STATS
+    EventBus() { EventBusStats::GetClockOrigin(); }
+#else
     EventBus() = default;
+#endif
     EventBus(const EventBus&) = delete;
     EventBus& operator=(const EventBus&) = delete;
 
-    //! @note mutex_を保持した状態で呼び出すこと
+    //! @brief ハンドラ取得（ロックなし）
     template<typename TEvent>
-    EventHandler<TEvent>* GetHandlerLocked() {
-        std::type_index typeIndex(typeid(TEvent));
-        auto it = handlers_.find(typeIndex);
-        if (it == handlers_.end()) {
-            return nullptr;
-        }
-        return static_cast<EventHandler<TEvent>*>(it->second.get());
+    EventHandler<TEvent>* GetHandler() const noexcept {
+        const uint32_t typeId = EventTypeRegistry::GetId<TEvent>();
+        return static_cast<EventHandler<TEvent>*>(handlers_[typeId].load(std::memory_order_acquire));
     }
 
-    //! @note mutex_を保持した状態で呼び出すこと
+    //! @brief ハンドラ取得（未登録なら生成）
     template<typename TEvent>
-    EventHandler<TEvent>* GetOrCreateHandlerLocked() {
-        std::type_index typeIndex(typeid(TEvent));
-        auto it = handlers_.find(typeIndex);
-        if (it == handlers_.end()) {
-            auto handler = std::make_unique<EventHandler<TEvent>>();
-            auto* ptr = handler.get();
-            handlers_[typeIndex] = std::move(handler);
-            return ptr;
+    EventHandler<TEvent>* GetOrCreateHandler() {
+        if (auto* handler = GetHandler<TEvent>()) {
+            return handler;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        const uint32_t typeId = EventTypeRegistry::GetId<TEvent>();
+        IEventHandler* existing = handlers_[typeId].load(std::memory_order_relaxed);
+        if (existing) {
+            return static_cast<EventHandler<TEvent>*>(existing);
+        }
+        auto handler = std::make_unique<EventHandler<TEvent>>();
+        auto* ptr = handler.get();
+        ownedHandlers_.push_back(std::move(handler));
+        handlers_[typeId].store(ptr, std::memory_order_release);
+        return ptr;
+    }
+
+#if EVENT_BUS_STATS
+    //! @brief フレーム境界の処理（発行数の確定と定期ダンプ）
+    void EndFrameStats() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (const auto& handler : ownedHandlers_) {
+                handler->EndFrameStats();
+            }
+        }
+        ++statsFrame_;
+        if (statsDumpInterval_ != 0 && statsFrame_ % statsDumpInterval_ == 0) {
+            DumpStats();
         }
-        return static_cast<EventHandler<TEvent>*>(it->second.get());
     }
+#endif
 
     static inline std::unique_ptr<EventBus> instance_ = nullptr;
     static inline std::once_flag initFlag_;
 
-    std::unordered_map<std::type_index, std::unique_ptr<IEventHandler>> handlers_;
-    mutable std::shared_mutex mutex_;
-    uint32_t nextSubscriptionId_ = 1;
+    //! 型IDで直接引くハンドラテーブル（読み取りはロックなし）
+    std::array<std::atomic<IEventHandler*>, EventTypeRegistry::kMaxEventTypes> handlers_{};
+    std::vector<std::unique_ptr<IEventHandler>> ownedHandlers_;  //!< ハンドラ本体（生成順）
+    mutable std::mutex mutex_;                                   //!< ハンドラ生成・一括操作の保護
+
+    //! フェーズ別の配信待ちハンドラ（キューが空→非空になった順）
+    std::array<std::vector<IEventHandler*>, kEventPhaseCount> pending_;
+    std::mutex pendingMutex_;
+
+#if EVENT_BUS_STATS
+    uint64_t statsFrame_ = 0;           //!< EndOfFrameのDispatch回数
+    uint32_t statsDumpInterval_ = 0;    //!< 定期ダンプ間隔（フレーム、0で無効）
+    StatsSink statsSink_;               //!< ダンプ出力先
+#endif
 };
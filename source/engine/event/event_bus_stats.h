@@ -0,0 +1,249 @@
+//----------------------------------------------------------------------------
+//! @file   event_bus_stats.h
+//! @brief  EventBus計測（型別の発行数・購読者別のハンドラ処理時間）
+//!
+//! @details
+//! EVENT_BUS_STATS が1のときのみ有効。0ではEventBus側の計測コードごと
+//! コンパイルから除外され、メンバ・分岐・タイマー読み出しは一切残らない。
+//! 既定はDebugビルドで有効、Releaseビルドで無効。
+//! premakeのdefinesで EVENT_BUS_STATS=1 を指定すればReleaseでも計測できる。
+//!
+//! 時間計測はTSC（__rdtsc）で行い、ミリ秒への換算はsteady_clockとの
+//! 比から求める。非x86環境ではsteady_clockのナノ秒をそのまま使う。
+//!
+//! @note 有効時はPublishごとに共有カウンターへの原子加算が入るため、
+//!       多数のワーカーから同じ型を発行する場面では計測自体の負荷が目立つ。
+//----------------------------------------------------------------------------
+#pragma once
+
+#ifndef EVENT_BUS_STATS
+    #ifdef _DEBUG
+        #define EVENT_BUS_STATS 1
+    #else
+        #define EVENT_BUS_STATS 0
+    #endif
+#endif
+
+#if EVENT_BUS_STATS
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define EVENT_BUS_STATS_HAS_TSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <x86intrin.h>
+    #define EVENT_BUS_STATS_HAS_TSC 1
+#else
+    #define EVENT_BUS_STATS_HAS_TSC 0
+#endif
+
+enum class EventPriority : uint8_t;  // event_bus.hで定義
+
+namespace EventBusStats {
+
+//----------------------------------------------------------------------------
+// タイマー
+//----------------------------------------------------------------------------
+
+//! @brief 現在のタイムスタンプ（TSCティック）
+inline uint64_t ReadTimestamp() noexcept
+{
+#if EVENT_BUS_STATS_HAS_TSC
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+//! @brief ティック→ミリ秒換算の基準点
+//! @note EventBus生成時に取得し、集計時の経過時間との比で換算係数を求める
+struct ClockOrigin
+{
+    uint64_t ticks;
+    std::chrono::steady_clock::time_point time;
+};
+
+inline ClockOrigin& GetClockOrigin() noexcept
+{
+    static ClockOrigin origin{ ReadTimestamp(), std::chrono::steady_clock::now() };
+    return origin;
+}
+
+//! @brief 1ティックあたりのミリ秒
+//! @note 基準点からの経過が短すぎる場合は10ms待ってから換算する（初回のみ）
+inline double GetMillisecondsPerTick() noexcept
+{
+#if EVENT_BUS_STATS_HAS_TSC
+    const ClockOrigin& origin = GetClockOrigin();
+    constexpr auto kMinElapsed = std::chrono::milliseconds(10);
+    auto elapsed = std::chrono::steady_clock::now() - origin.time;
+    if (elapsed < kMinElapsed) {
+        std::this_thread::sleep_for(kMinElapsed - elapsed);
+    }
+    const uint64_t ticks = ReadTimestamp() - origin.ticks;
+    const double ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - origin.time).count();
+    return ticks > 0 ? ms / static_cast<double>(ticks) : 0.0;
+#else
+    return 1.0e-6;
+#endif
+}
+
+//----------------------------------------------------------------------------
+// カウンター（配信スレッドから並行に更新される）
+//----------------------------------------------------------------------------
+
+//! 処理時間ヒストグラムのビン数（2のべき乗ティック刻み）
+static constexpr size_t kHistogramBins = 16;
+//! 最小ビンの上限 = 2^kHistogramShift ティック
+static constexpr uint32_t kHistogramShift = 10;
+
+//! @brief 購読者ごとの累計
+struct SubscriberCounters
+{
+    std::atomic<uint64_t> calls{ 0 };        //!< 呼び出し回数
+    std::atomic<uint64_t> totalTicks{ 0 };   //!< 累計処理時間
+    std::atomic<uint64_t> maxTicks{ 0 };     //!< 1回あたりの最大処理時間
+    std::array<std::atomic<uint64_t>, kHistogramBins> histogram{};  //!< 処理時間の分布
+
+    //! @brief 1回分の処理時間を記録
+    void Record(uint64_t ticks) noexcept
+    {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        totalTicks.fetch_add(ticks, std::memory_order_relaxed);
+        uint64_t prevMax = maxTicks.load(std::memory_order_relaxed);
+        while (ticks > prevMax &&
+               !maxTicks.compare_exchange_weak(prevMax, ticks, std::memory_order_relaxed)) {
+        }
+        const int width = std::bit_width(ticks);
+        const size_t bin = width <= static_cast<int>(kHistogramShift)
+            ? 0 : (std::min)(static_cast<size_t>(width) - kHistogramShift, kHistogramBins - 1);
+        histogram[bin].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void Reset() noexcept
+    {
+        calls.store(0, std::memory_order_relaxed);
+        totalTicks.store(0, std::memory_order_relaxed);
+        maxTicks.store(0, std::memory_order_relaxed);
+        for (auto& bin : histogram) {
+            bin.store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+//! @brief イベント型ごとの発行数
+struct TypeCounters
+{
+    std::atomic<uint32_t> publishFrame{ 0 };     //!< 今フレームのPublish数
+    std::atomic<uint32_t> enqueueFrame{ 0 };     //!< 今フレームのEnqueue数
+    std::atomic<uint64_t> publishTotal{ 0 };     //!< 累計Publish数
+    std::atomic<uint64_t> enqueueTotal{ 0 };     //!< 累計Enqueue数
+    std::atomic<uint32_t> publishLastFrame{ 0 }; //!< 直前フレームのPublish数
+    std::atomic<uint32_t> enqueueLastFrame{ 0 }; //!< 直前フレームのEnqueue数
+    std::atomic<uint32_t> publishMaxFrame{ 0 };  //!< 1フレームの最大Publish数
+
+    void CountPublish() noexcept
+    {
+        publishFrame.fetch_add(1, std::memory_order_relaxed);
+        publishTotal.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void CountEnqueue(uint32_t count) noexcept
+    {
+        enqueueFrame.fetch_add(count, std::memory_order_relaxed);
+        enqueueTotal.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    //! @brief フレーム境界で今フレーム分を確定
+    void EndFrame() noexcept
+    {
+        const uint32_t published = publishFrame.exchange(0, std::memory_order_relaxed);
+        publishLastFrame.store(published, std::memory_order_relaxed);
+        enqueueLastFrame.store(enqueueFrame.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        if (published > publishMaxFrame.load(std::memory_order_relaxed)) {
+            publishMaxFrame.store(published, std::memory_order_relaxed);
+        }
+    }
+
+    void Reset() noexcept
+    {
+        publishFrame.store(0, std::memory_order_relaxed);
+        enqueueFrame.store(0, std::memory_order_relaxed);
+        publishTotal.store(0, std::memory_order_relaxed);
+        enqueueTotal.store(0, std::memory_order_relaxed);
+        publishLastFrame.store(0, std::memory_order_relaxed);
+        enqueueLastFrame.store(0, std::memory_order_relaxed);
+        publishMaxFrame.store(0, std::memory_order_relaxed);
+    }
+};
+
+//----------------------------------------------------------------------------
+// 集計結果（クエリAPIの戻り値）
+//----------------------------------------------------------------------------
+
+//! @brief 購読者ごとの集計
+struct SubscriberStats
+{
+    uint32_t id = 0;                     //!< 購読ID
+    EventPriority priority{};            //!< 優先度
+    bool batch = false;                  //!< SubscribeBatchによる購読か
+    bool keyed = false;                  //!< SubscribeKeyedによる購読か
+    uint64_t calls = 0;                  //!< 呼び出し回数
+    double totalMs = 0.0;                //!< 累計処理時間 [ms]
+    double maxMs = 0.0;                  //!< 最大処理時間 [ms]
+    std::array<uint64_t, kHistogramBins> histogram{};  //!< 処理時間の分布（GetHistogramBinUpperMs参照）
+};
+
+//! @brief イベント型ごとの集計
+struct TypeStats
+{
+    std::string name;                    //!< 型名（typeid由来）
+    uint32_t typeId = 0;                 //!< 密なイベント型ID
+    uint32_t subscriberCount = 0;        //!< 購読者数（キー付きを含む）
+    uint32_t publishLastFrame = 0;       //!< 直前フレームのPublish数
+    uint32_t enqueueLastFrame = 0;       //!< 直前フレームのEnqueue数
+    uint32_t publishMaxFrame = 0;        //!< 1フレームの最大Publish数
+    uint64_t publishTotal = 0;           //!< 累計Publish数
+    uint64_t enqueueTotal = 0;           //!< 累計Enqueue数
+    double handlerTotalMs = 0.0;         //!< 全購読者の累計処理時間 [ms]
+    std::vector<SubscriberStats> subscribers;  //!< 累計処理時間の降順
+};
+
+//! @brief ヒストグラムのビンの上限 [ms]（最終ビンは上限なし）
+inline double GetHistogramBinUpperMs(size_t bin, double msPerTick) noexcept
+{
+    return static_cast<double>(uint64_t(1) << (kHistogramShift + bin)) * msPerTick;
+}
+
+//! @brief カウンターから集計結果を作成
+inline SubscriberStats MakeSubscriberStats(uint32_t id, EventPriority priority, bool batch, bool keyed,
+                                           const SubscriberCounters& counters, double msPerTick)
+{
+    SubscriberStats stats;
+    stats.id = id;
+    stats.priority = priority;
+    stats.batch = batch;
+    stats.keyed = keyed;
+    stats.calls = counters.calls.load(std::memory_order_relaxed);
+    stats.totalMs = static_cast<double>(counters.totalTicks.load(std::memory_order_relaxed)) * msPerTick;
+    stats.maxMs = static_cast<double>(counters.maxTicks.load(std::memory_order_relaxed)) * msPerTick;
+    for (size_t i = 0; i < kHistogramBins; ++i) {
+        stats.histogram[i] = counters.histogram[i].load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+} // namespace EventBusStats
+
+#endif // EVENT_BUS_STATS
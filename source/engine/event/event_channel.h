@@ -0,0 +1,233 @@
+//----------------------------------------------------------------------------
+//! @file   event_channel.h
+//! @brief  EventChannel - ジョブワーカーからメインスレッドへのイベント転送（MPSC）
+//!
+//! @details
+//! ワーカーはPush()でスレッドごとのバッファに追記するだけで、
+//! 他スレッドとの同期（ロック・CAS）を一切行わない。
+//! （専用スロットを使い切った後に現れたスレッドのみ、ロック付きの共用バッファに追記する）
+//! メインスレッドはジョブ完了待ち（JobHandle::Wait等）の後にDrain()/Flush()し、
+//! 生産者が付けたシーケンス番号順にまとめて配信する。
+//!
+//! @note 決定性:
+//!       配信順はスレッドの割り当てやスケジューリングに依存しない。
+//!       シーケンス番号には作業単位の番号（ParallelForのインデックス等）を使い、
+//!       同一シーケンス番号のイベントは同じ作業単位（＝同じスレッド）から
+//!       Pushすること。同一番号内はPush順が保たれる。
+//!
+//! @note スレッドセーフ性:
+//!       - Push(): 任意のスレッドから並行に呼び出し可能
+//!       - Drain()/Flush()/Clear(): 全生産者のPushが完了した同期点で、
+//!         単一スレッド（通常はメインスレッド）から呼ぶこと
+//!
+//! @code
+//!   EventChannel<DamageDealtEvent> channel;
+//!   auto handle = JobSystem::Get().ParallelFor(0, count, [&](uint32_t i) {
+//!       channel.Push(i, DamageDealtEvent{ ... });
+//!   });
+//!   handle.Wait();
+//!   channel.Flush(EventBus::Get(), EventPhase::EndOfFrame);
+//! @endcode
+//----------------------------------------------------------------------------
+#pragma once
+
+#include "common/utility/non_copyable.h"
+#include "event_bus.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+//----------------------------------------------------------------------------
+//! @brief 生産者スレッドのスロット番号（全チャネル共通）
+//----------------------------------------------------------------------------
+namespace EventChannelThreadSlot {
+    static constexpr uint32_t kMaxProducerThreads = 64;        //!< 専用スロットを持てる生産者スレッド数の上限
+    static constexpr uint32_t kSharedSlot = kMaxProducerThreads;  //!< 専用スロットが尽きたスレッドの共用スロット
+    static constexpr uint32_t kSlotCount = kMaxProducerThreads + 1;
+
+    namespace Detail {
+        //! @brief 空きスロットの管理（スレッドの初回Push時と終了時のみロックする）
+        class SlotPool final : private NonCopyableNonMovable
+        {
+        public:
+            static SlotPool& Get() {
+                static SlotPool pool;
+                return pool;
+            }
+
+            //! @brief スロットを確保（空きがなければkSharedSlot）
+            uint32_t Acquire() {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!free_.empty()) {
+                    const uint32_t slot = free_.back();
+                    free_.pop_back();
+                    return slot;
+                }
+                return next_ < kMaxProducerThreads ? next_++ : kSharedSlot;
+            }
+
+            //! @brief スロットを返却（スレッド終了時）
+            void Release(uint32_t slot) noexcept {
+                if (slot == kSharedSlot) return;
+                std::lock_guard<std::mutex> lock(mutex_);
+                free_.push_back(slot);  // 容量は確保済みのため再確保しない
+            }
+
+        private:
+            SlotPool() { free_.reserve(kMaxProducerThreads); }
+
+            std::mutex mutex_;
+            std::vector<uint32_t> free_;  //!< 返却されたスロット
+            uint32_t next_ = 0;           //!< 未使用スロットの先頭
+        };
+
+        //! @brief スレッドが保持するスロット（スレッド終了時に返却）
+        struct SlotHolder {
+            SlotHolder() : slot(SlotPool::Get().Acquire()) {}
+            ~SlotHolder() { SlotPool::Get().Release(slot); }
+            SlotHolder(const SlotHolder&) = delete;
+            SlotHolder& operator=(const SlotHolder&) = delete;
+
+            const uint32_t slot;
+        };
+    }
+
+    //! @brief 呼び出しスレッドのスロット番号を取得（初回呼び出し時に確保）
+    //! @return 専用スロット番号、または専用スロットが尽きていればkSharedSlot
+    inline uint32_t Get() {
+        thread_local const Detail::SlotHolder holder;
+        return holder.slot;
+    }
+}
+
+//----------------------------------------------------------------------------
+//! @brief 多生産者・単一消費者のイベントチャネル
+//! @tparam TEvent イベント型
+//----------------------------------------------------------------------------
+template<typename TEvent>
+class EventChannel final : private NonCopyableNonMovable
+{
+public:
+    EventChannel() = default;
+    ~EventChannel() = default;
+
+    //------------------------------------------------------------------------
+    // 生産者（任意のスレッド）
+    //------------------------------------------------------------------------
+
+    //! @brief イベントを追加
+    //! @param sequence 配信順を決めるシーケンス番号（作業単位の番号）
+    //! @param event イベントデータ
+    void Push(uint64_t sequence, const TEvent& event) {
+        const uint32_t slot = EventChannelThreadSlot::Get();
+        ProducerBuffer& buffer = buffers_[slot];
+        if (slot == EventChannelThreadSlot::kSharedSlot) {
+            // 共用バッファは複数スレッドが書くためロックする
+            std::lock_guard<std::mutex> lock(sharedMutex_);
+            buffer.entries.push_back({ sequence, event });
+            buffer.used = true;
+            return;
+        }
+        buffer.entries.push_back({ sequence, event });
+        buffer.used = true;
+    }
+
+    //------------------------------------------------------------------------
+    // 消費者（同期点でのみ呼び出し）
+    //------------------------------------------------------------------------
+
+    //! @brief シーケンス番号順に全イベントを取り出す
+    //! @param fn void(const TEvent&)
+    template<typename Fn>
+    void Drain(Fn&& fn) {
+        Merge();
+        for (const Entry& entry : merged_) {
+            fn(entry.event);
+        }
+        merged_.clear();
+    }
+
+    //! @brief シーケンス番号順にEventBusの遅延キューへ積む
+    //! @details 次のDispatch(phase)でバッチ購読者へまとめて配信される
+    void Flush(EventBus& bus, EventPhase phase = EventPhase::EndOfFrame) {
+        Merge();
+        flushEvents_.clear();
+        flushEvents_.reserve(merged_.size());
+        for (const Entry& entry : merged_) {
+            flushEvents_.push_back(entry.event);
+        }
+        merged_.clear();
+        bus.Enqueue(std::span<const TEvent>(flushEvents_), phase);
+    }
+
+    //! @brief 未配信イベントを破棄
+    void Clear() {
+        for (ProducerBuffer& buffer : buffers_) {
+            buffer.entries.clear();
+            buffer.used = false;
+        }
+        merged_.clear();
+        flushEvents_.clear();
+    }
+
+    //! @brief 未配信イベント数
+    [[nodiscard]] size_t GetPendingCount() const {
+        size_t count = 0;
+        for (const ProducerBuffer& buffer : buffers_) {
+            count += buffer.entries.size();
+        }
+        return count;
+    }
+
+private:
+    //! @brief シーケンス番号付きエントリ
+    struct Entry {
+        uint64_t sequence;
+        TEvent event;
+    };
+
+    //! @brief 生産者スレッドごとのバッファ（偽共有回避のためキャッシュライン境界に配置）
+    struct alignas(64) ProducerBuffer {
+        std::vector<Entry> entries;
+        bool used = false;  //!< 一度でもPushされたか（Merge時の走査省略用）
+    };
+
+    //! @brief 全バッファを連結し、シーケンス番号で安定ソート
+    //! @details ワーカーは作業単位を昇順に取ることが多く、各バッファは通常ソート済み。
+    //!          その場合はバッファ単位の安定マージのみで済ませる。
+    void Merge() {
+        auto bySequence = [](const Entry& a, const Entry& b) { return a.sequence < b.sequence; };
+
+        size_t total = 0;
+        for (const ProducerBuffer& buffer : buffers_) {
+            total += buffer.entries.size();
+        }
+        merged_.clear();
+        merged_.reserve(total);
+
+        bool segmentsSorted = true;
+        for (ProducerBuffer& buffer : buffers_) {
+            if (!buffer.used || buffer.entries.empty()) continue;
+            segmentsSorted = segmentsSorted &&
+                std::is_sorted(buffer.entries.begin(), buffer.entries.end(), bySequence);
+            const auto middle = static_cast<std::ptrdiff_t>(merged_.size());
+            merged_.insert(merged_.end(), buffer.entries.begin(), buffer.entries.end());
+            buffer.entries.clear();  // 容量は次フレーム用に保持
+            if (segmentsSorted) {
+                // スロット番号順の連結なので、同一シーケンス内の順序も保たれる
+                std::inplace_merge(merged_.begin(), merged_.begin() + middle, merged_.end(), bySequence);
+            }
+        }
+        if (!segmentsSorted) {
+            std::stable_sort(merged_.begin(), merged_.end(), bySequence);
+        }
+    }
+
+    std::array<ProducerBuffer, EventChannelThreadSlot::kSlotCount> buffers_;  //!< スロット番号→バッファ（末尾は共用）
+    std::mutex sharedMutex_;           //!< 共用バッファへのPush用
+    std::vector<Entry> merged_;        //!< Drain用の連結バッファ（容量再利用）
+    std::vector<TEvent> flushEvents_;  //!< Flush用のイベント列（容量再利用）
+};
@@ -0,0 +1,125 @@
+//----------------------------------------------------------------------------
+//! @file   affine2d.h
+//! @brief  2Dアフィン変換（2x2線形部＋平行移動、Z平行移動付き）
+//!
+//! @details
+//! Z軸回転・XYスケール・平行移動のみで構成される変換は、4x4行列のうち
+//! 左上2x2と平行移動(tx, ty, tz)だけで表せる。Transformの2Dモードの
+//! ワールド変換をこの形で保持し、4x4行列の乗算・逆行列を置き換える。
+//!
+//! 行ベクトル規約（SimpleMathと同じ）: world = local * parent
+//! @code
+//!   | a  b  0  0 |
+//!   | c  d  0  0 |
+//!   | 0  0  1  0 |
+//!   | tx ty tz 1 |
+//! @endcode
+//!
+//! 合成はSSEで1要素4レーンずつ計算する。スカラー版と同じ演算順序を使うため、
+//! FMA縮約が入らない限り結果は一致する。
+//----------------------------------------------------------------------------
+#pragma once
+
+#include "math_types.h"
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define AFFINE2D_SIMD 1
+#include <xmmintrin.h>
+#else
+#define AFFINE2D_SIMD 0
+#endif
+
+//============================================================================
+//! @brief 2Dアフィン変換
+//============================================================================
+struct alignas(16) Affine2D {
+    float linear[4] = { 1.0f, 0.0f, 0.0f, 1.0f };       //!< a, b, c, d
+    float translation[4] = { 0.0f, 0.0f, 0.0f, 0.0f };  //!< tx, ty, tz, 0
+
+    //------------------------------------------------------------------------
+    //! @brief ピボット付きローカル変換を作成
+    //! @details -pivot → scale → rotateZ → +pivot → translate の順
+    //------------------------------------------------------------------------
+    [[nodiscard]] static Affine2D FromLocal(const Vector2& position, float z, float rotation,
+                                            const Vector2& scale, const Vector2& pivot) noexcept {
+        const float cs = std::cos(rotation);
+        const float sn = std::sin(rotation);
+        Affine2D result;
+        result.linear[0] = scale.x * cs;
+        result.linear[1] = scale.x * sn;
+        result.linear[2] = -scale.y * sn;
+        result.linear[3] = scale.y * cs;
+        result.translation[0] = position.x + pivot.x - (pivot.x * result.linear[0] + pivot.y * result.linear[2]);
+        result.translation[1] = position.y + pivot.y - (pivot.x * result.linear[1] + pivot.y * result.linear[3]);
+        result.translation[2] = z;
+        return result;
+    }
+
+    //------------------------------------------------------------------------
+    //! @brief 合成（childの後にparentを適用 = child * parent）
+    //------------------------------------------------------------------------
+    [[nodiscard]] static Affine2D Multiply(const Affine2D& child, const Affine2D& parent) noexcept {
+        Affine2D result;
+#if AFFINE2D_SIMD
+        const __m128 cl = _mm_load_ps(child.linear);
+        const __m128 pl = _mm_load_ps(parent.linear);
+        const __m128 zero = _mm_setzero_ps();
+
+        // (a,a,c,c)*(pa,pb,pa,pb) + (b,b,d,d)*(pc,pd,pc,pd)
+        const __m128 lx = _mm_shuffle_ps(cl, cl, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 ly = _mm_shuffle_ps(cl, cl, _MM_SHUFFLE(3, 3, 1, 1));
+        const __m128 p0 = _mm_movelh_ps(pl, pl);
+        const __m128 p1 = _mm_movehl_ps(pl, pl);
+        _mm_store_ps(result.linear, _mm_add_ps(_mm_mul_ps(lx, p0), _mm_mul_ps(ly, p1)));
+
+        // tx*(pa,pb,0,0) + ty*(pc,pd,0,0) + (0,0,tz,0) + (ptx,pty,ptz,0)
+        const __m128 ct = _mm_load_ps(child.translation);
+        const __m128 tx = _mm_shuffle_ps(ct, ct, _MM_SHUFFLE(0, 0, 0, 0));
+        const __m128 ty = _mm_shuffle_ps(ct, ct, _MM_SHUFFLE(1, 1, 1, 1));
+        const __m128 tz = _mm_mul_ps(ct, _mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f));
+        const __m128 rotated = _mm_add_ps(_mm_mul_ps(tx, _mm_movelh_ps(pl, zero)),
+                                          _mm_mul_ps(ty, _mm_movehl_ps(zero, pl)));
+        _mm_store_ps(result.translation,
+                     _mm_add_ps(_mm_add_ps(rotated, tz), _mm_load_ps(parent.translation)));
+#else
+        const float* c = child.linear;
+        const float* p = parent.linear;
+        result.linear[0] = c[0] * p[0] + c[1] * p[2];
+        result.linear[1] = c[0] * p[1] + c[1] * p[3];
+        result.linear[2] = c[2] * p[0] + c[3] * p[2];
+        result.linear[3] = c[2] * p[1] + c[3] * p[3];
+        const float* t = child.translation;
+        result.translation[0] = (t[0] * p[0] + t[1] * p[2]) + parent.translation[0];
+        result.translation[1] = (t[0] * p[1] + t[1] * p[3]) + parent.translation[1];
+        result.translation[2] = t[2] + parent.translation[2];
+#endif
+        return result;
+    }
+
+    //! @brief 点を変換
+    [[nodiscard]] Vector3 TransformPoint(float x, float y, float z) const noexcept {
+        return Vector3(x * linear[0] + y * linear[2] + translation[0],
+                       x * linear[1] + y * linear[3] + translation[1],
+                       z + translation[2]);
+    }
+
+    //! @brief 点を逆変換（2x2の逆行列で解く）
+    [[nodiscard]] Vector3 InverseTransformPoint(float x, float y, float z) const noexcept {
+        const float det = linear[0] * linear[3] - linear[1] * linear[2];
+        const float invDet = det != 0.0f ? 1.0f / det : 0.0f;
+        const float dx = x - translation[0];
+        const float dy = y - translation[1];
+        return Vector3((dx * linear[3] - dy * linear[2]) * invDet,
+                       (dy * linear[0] - dx * linear[1]) * invDet,
+                       z - translation[2]);
+    }
+
+    //! @brief 4x4行列に展開
+    [[nodiscard]] Matrix ToMatrix() const noexcept {
+        return Matrix(linear[0], linear[1], 0.0f, 0.0f,
+                      linear[2], linear[3], 0.0f, 0.0f,
+                      0.0f, 0.0f, 1.0f, 0.0f,
+                      translation[0], translation[1], translation[2], 1.0f);
+    }
+};
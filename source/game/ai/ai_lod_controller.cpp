@@ -0,0 +1,121 @@
+//----------------------------------------------------------------------------
+//! @file   ai_lod_controller.cpp
+//! @brief  AILodController実装
+//----------------------------------------------------------------------------
+#include "ai_lod_controller.h"
+#include "group_ai.h"
+#include "engine/component/camera2d.h"
+#include <algorithm>
+#include <cassert>
+
+namespace {
+    //! @brief カメラ範囲内とみなすマージン（GroupAI::IsInCameraView()の既定値と同じ）
+    constexpr float kViewMargin = 50.0f;
+    //! @brief 思考間隔の下限（秒）
+    constexpr float kMinThinkInterval = 1.0f / 240.0f;
+    //! @brief 初期位相の刻み（黄金比の小数部。連番のAIを0〜1に均等に散らす）
+    constexpr float kPhaseStep = 0.61803398875f;
+    //! @brief 予算に関係なく思考させる遅れ（思考間隔の倍数）
+    constexpr float kOverdueProgress = 2.0f;
+}
+
+//----------------------------------------------------------------------------
+AILodController::AILodController()
+{
+    thinkIntervals_[static_cast<size_t>(AILodTier::Full)] = 0.0f;
+    thinkIntervals_[static_cast<size_t>(AILodTier::Near)] = 1.0f / 10.0f;
+    thinkIntervals_[static_cast<size_t>(AILodTier::Far)] = 1.0f / 4.0f;
+}
+
+//----------------------------------------------------------------------------
+AILodController& AILodController::Get()
+{
+    assert(instance_ && "AILodController::Create() not called");
+    return *instance_;
+}
+
+//----------------------------------------------------------------------------
+void AILodController::Create()
+{
+    if (!instance_) {
+        instance_.reset(new AILodController());
+    }
+}
+
+//----------------------------------------------------------------------------
+void AILodController::Destroy()
+{
+    instance_.reset();
+}
+
+//----------------------------------------------------------------------------
+void AILodController::BeginFrame(const Camera2D* camera)
+{
+    lastFrameThinkCount_ = thinkCount_;
+    thinkCount_ = 0;
+    deferredCount_ = 0;
+    budgetUsed_ = 0;
+
+    hasView_ = camera != nullptr;
+    if (hasView_) {
+        camera->GetWorldBounds(viewMin_, viewMax_);
+    }
+}
+
+//----------------------------------------------------------------------------
+AILodTier AILodController::ClassifyTier(const Vector2& position, AIState state, bool inCombat) const
+{
+    // 戦闘・逃走中は応答性を優先
+    if (!enabled_ || !hasView_) return AILodTier::Full;
+    if (inCombat || state != AIState::Wander) return AILodTier::Full;
+
+    // カメラ範囲（矩形）からの距離
+    const float dx = (std::max)((std::max)(viewMin_.x - position.x, position.x - viewMax_.x), 0.0f);
+    const float dy = (std::max)((std::max)(viewMin_.y - position.y, position.y - viewMax_.y), 0.0f);
+    const float distance = (std::max)(dx, dy);
+
+    if (distance <= kViewMargin) return AILodTier::Full;
+    if (distance <= nearDistance_) return AILodTier::Near;
+    return AILodTier::Far;
+}
+
+//----------------------------------------------------------------------------
+bool AILodController::ConsumeThink(AILodTier tier, float& progress, float dt)
+{
+    if (tier == AILodTier::Full) {
+        ++thinkCount_;
+        return true;
+    }
+
+    // 思考間隔に対する進みを貯め、1に達したら思考
+    progress += dt / (std::max)(GetThinkInterval(tier), kMinThinkInterval);
+    if (progress < 1.0f) return false;
+
+    // 予算切れなら次フレームに回す（長く待ったAIは予算外で思考）
+    if (thinkBudget_ > 0 && budgetUsed_ >= thinkBudget_ && progress < kOverdueProgress) {
+        ++deferredCount_;
+        return false;
+    }
+
+    // 位相を保つため端数を残す（大きく遅れた分は捨てる）
+    progress = (std::min)(progress - 1.0f, 0.99f);
+    ++budgetUsed_;
+    ++thinkCount_;
+    return true;
+}
+
+//----------------------------------------------------------------------------
+float AILodController::NextPhase()
+{
+    const float phase = nextPhase_;
+    nextPhase_ += kPhaseStep;
+    if (nextPhase_ >= 1.0f) nextPhase_ -= 1.0f;
+    return phase;
+}
+
+//----------------------------------------------------------------------------
+void AILodController::SetThinkInterval(AILodTier tier, float seconds)
+{
+    if (tier == AILodTier::Full || tier == AILodTier::Count) return;
+    thinkIntervals_[static_cast<size_t>(tier)] = (std::max)(seconds, kMinThinkInterval);
+}
@@ -0,0 +1,161 @@
+//----------------------------------------------------------------------------
+//! @file   ai_lod_controller.h
+//! @brief  AILodController - GroupAIの思考頻度（LOD）管理
+//----------------------------------------------------------------------------
+#pragma once
+
+#include "engine/math/math_types.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+
+// 前方宣言
+class Camera2D;
+enum class AIState;
+
+//----------------------------------------------------------------------------
+//! @brief AIの詳細度（思考頻度）
+//----------------------------------------------------------------------------
+enum class AILodTier : uint8_t
+{
+    Full,       //!< 毎フレーム思考（画面内・戦闘中・逃走中）
+    Near,       //!< 画面外の近くで徘徊中
+    Far,        //!< 画面外の遠くで徘徊中
+
+    Count
+};
+
+//----------------------------------------------------------------------------
+//! @brief GroupAIのLOD管理（シングルトン）
+//! @details GroupAI::Update()の「思考」（Love縁の距離チェックと状態遷移判定）を、
+//!          カメラからの距離と状態で決めたティアの間隔でだけ実行させる。
+//!          移動（状態ごとの更新）は毎フレーム行う。
+//!
+//!          - Full: Seek/Flee、戦闘中、またはカメラ範囲内 → 毎フレーム
+//!          - Near: 画面外、カメラ範囲からの距離がNearの境界以内 → 既定10Hz
+//!          - Far : それより遠い → 既定4Hz
+//!
+//!          各AIは初期位相（黄金比で散らした0〜1）を持ち、同じティアのAIの思考が
+//!          同じフレームに集中しないようにする。
+//!          Full以外の思考は1フレームあたりの予算で打ち切り、溢れたAIは次フレームに回す
+//!          （間隔の2倍以上待ったAIは予算に関係なく思考する）。
+//!
+//! @note BeginFrame()をGroupAI::Update()の前に1フレーム1回呼ぶ
+//----------------------------------------------------------------------------
+class AILodController
+{
+public:
+    //! @brief シングルトンインスタンス取得
+    static AILodController& Get();
+
+    //! @brief インスタンス生成
+    static void Create();
+
+    //! @brief インスタンス破棄
+    static void Destroy();
+
+    //! @brief デストラクタ
+    ~AILodController() = default;
+
+    //------------------------------------------------------------------------
+    // フレーム処理
+    //------------------------------------------------------------------------
+
+    //! @brief フレーム開始（カメラ範囲の取得と思考回数のリセット）
+    //! @param camera 距離の基準にするカメラ（nullptrなら全AIをFullで扱う）
+    void BeginFrame(const Camera2D* camera);
+
+    //! @brief ティアを判定
+    //! @param position グループ中心
+    //! @param state AI状態
+    //! @param inCombat 戦闘中か
+    [[nodiscard]] AILodTier ClassifyTier(const Vector2& position, AIState state, bool inCombat) const;
+
+    //! @brief 思考するか判定し、するなら回数を数える
+    //! @param tier ClassifyTier()の結果
+    //! @param progress 思考間隔に対する進み（0〜1、AIごとに保持）
+    //! @param dt 経過時間（スケール済み）
+    //! @return このフレームで思考するならtrue
+    [[nodiscard]] bool ConsumeThink(AILodTier tier, float& progress, float dt);
+
+    //! @brief BeginFrame()で取得したカメラ範囲内か
+    //! @param position ワールド座標
+    //! @param margin 範囲を広げるマージン
+    //! @note constのみ参照するため、ワーカースレッドから呼び出し可能
+    [[nodiscard]] bool IsInView(const Vector2& position, float margin) const
+    {
+        return hasView_ &&
+            position.x >= viewMin_.x - margin && position.x <= viewMax_.x + margin &&
+            position.y >= viewMin_.y - margin && position.y <= viewMax_.y + margin;
+    }
+
+    //! @brief 新しいAIの初期位相（0〜1）を払い出す
+    [[nodiscard]] float NextPhase();
+
+    //------------------------------------------------------------------------
+    // 設定（次のBeginFrame()以降のフレームに反映）
+    //------------------------------------------------------------------------
+
+    //! @brief LODの有効/無効（無効なら全AIが毎フレーム思考）
+    void SetEnabled(bool enabled) { enabled_ = enabled; }
+
+    //! @brief LODが有効か
+    [[nodiscard]] bool IsEnabled() const { return enabled_; }
+
+    //! @brief ティアの思考間隔（秒）を設定
+    //! @note Fullは常に毎フレーム思考するため設定できない
+    void SetThinkInterval(AILodTier tier, float seconds);
+
+    //! @brief ティアの思考間隔（秒）を取得
+    [[nodiscard]] float GetThinkInterval(AILodTier tier) const { return thinkIntervals_[static_cast<size_t>(tier)]; }
+
+    //! @brief Nearティアとみなすカメラ範囲からの距離を設定
+    void SetNearDistance(float distance) { nearDistance_ = distance; }
+
+    //! @brief Nearティアとみなすカメラ範囲からの距離を取得
+    [[nodiscard]] float GetNearDistance() const { return nearDistance_; }
+
+    //! @brief 1フレームあたりのFull以外の思考回数の上限を設定（0なら無制限）
+    void SetThinkBudget(uint32_t budget) { thinkBudget_ = budget; }
+
+    //! @brief 1フレームあたりのFull以外の思考回数の上限を取得
+    [[nodiscard]] uint32_t GetThinkBudget() const { return thinkBudget_; }
+
+    //------------------------------------------------------------------------
+    // 統計
+    //------------------------------------------------------------------------
+
+    //! @brief 今フレームの思考回数
+    [[nodiscard]] uint32_t GetThinkCount() const { return thinkCount_; }
+
+    //! @brief 前フレームの思考回数
+    [[nodiscard]] uint32_t GetLastFrameThinkCount() const { return lastFrameThinkCount_; }
+
+    //! @brief 今フレームに予算超過で見送った思考回数
+    [[nodiscard]] uint32_t GetDeferredCount() const { return deferredCount_; }
+
+private:
+    AILodController();
+    AILodController(const AILodController&) = delete;
+    AILodController& operator=(const AILodController&) = delete;
+
+    static inline std::unique_ptr<AILodController> instance_ = nullptr;
+
+    // 設定
+    bool enabled_ = true;
+    std::array<float, static_cast<size_t>(AILodTier::Count)> thinkIntervals_{};  //!< ティアごとの思考間隔（秒）
+    float nearDistance_ = 600.0f;       //!< Nearティアの境界（カメラ範囲からの距離）
+    uint32_t thinkBudget_ = 0;          //!< Full以外の思考回数の上限（0なら無制限）
+
+    // フレーム状態
+    bool hasView_ = false;              //!< カメラ範囲を取得できたか
+    Vector2 viewMin_;                   //!< カメラ範囲（ワールド座標）
+    Vector2 viewMax_;
+    uint32_t budgetUsed_ = 0;           //!< 今フレームのFull以外の思考回数
+    float nextPhase_ = 0.0f;            //!< 次に払い出す位相
+
+    // 統計
+    uint32_t thinkCount_ = 0;
+    uint32_t lastFrameThinkCount_ = 0;
+    uint32_t deferredCount_ = 0;
+};
@@ -3,6 +3,8 @@
 //! @brief  グループAI実装
 //----------------------------------------------------------------------------
 #include "group_ai.h"
+#include "group_target_index.h"
+#include "ai_lod_controller.h"
 #include "game/entities/group.h"
 #include "game/entities/individual.h"
 #include "game/entities/player.h"
@@ -14,16 +16,18 @@
 #include "game/systems/event/game_events.h"
 #include "game/relationships/relationship_facade.h"
 #include "engine/component/camera2d.h"
+#include "engine/core/job_system.h"
 #include "common/logging/logging.h"
 #include <random>
 #include <cmath>
-#include <limits>
 
 namespace {
     //! @brief 画面端からの可視マージン
     constexpr float kVisibilityMargin = 50.0f;
     //! @brief 円周率（徘徊角度計算用）
     constexpr float kTwoPi = 2.0f * 3.14159f;
+    //! @brief 判断フェーズを並列化する最小AI数（これ未満はジョブ投入の方が高くつく）
+    constexpr uint32_t kMinParallelDecideCount = 8;
 }
 
 //----------------------------------------------------------------------------
@@ -32,11 +36,10 @@ GroupAI::GroupAI(Group* owner)
 {
     SetNewWanderTarget();
 
-    // GroupDefeatedEventを購読（ターゲットが倒された時にクリア）
-    defeatedSubscriptionId_ = EventBus::Get().Subscribe<GroupDefeatedEvent>(
-        [this](const GroupDefeatedEvent& e) {
-            OnGroupDefeated(e.group);
-        });
+    // 思考タイミングをAIごとにずらす
+    thinkProgress_ = AILodController::Get().NextPhase();
+
+    // GroupDefeatedEventはターゲットグループ設定時にキー付きで購読する（AssignTarget参照）
 }
 
 //----------------------------------------------------------------------------
@@ -49,11 +52,70 @@ GroupAI::~GroupAI()
     }
 }
 
+//----------------------------------------------------------------------------
+void GroupAI::DecideAll(std::span<const std::unique_ptr<GroupAI>> ais)
+{
+    const uint32_t count = static_cast<uint32_t>(ais.size());
+    auto decideRange = [ais](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            ais[i]->Decide();
+        }
+    };
+
+    // 各AIは自分のdecision_にしか書かないので、分割の仕方によらず結果は同じ
+    if (count >= kMinParallelDecideCount && JobSystem::IsCreated() && JobSystem::Get().GetWorkerCount() > 0) {
+        JobSystem::Get().ParallelForRange(0, count, decideRange).Wait();
+    } else {
+        decideRange(0, count);
+    }
+}
+
+//----------------------------------------------------------------------------
+void GroupAI::Decide()
+{
+    // 読み取り専用: 他グループ・縁グラフ・カメラ範囲を読み、decision_だけに書く
+    // （ログ出力・イベント発行・乱数の使用は適用フェーズで行う）
+    GroupAIDecision& decision = decision_;
+    decision.pending = true;
+    decision.loveCluster.clear();
+    if (!owner_) return;
+
+    decision.position = owner_->GetPosition();
+    decision.hpRatio = owner_->GetHpRatio();
+    decision.inCameraView = camera_ && AILodController::Get().IsInView(decision.position, kVisibilityMargin);
+    decision.loveWithPlayer = HasLoveBondWithPlayer();
+    decision.loveCluster = RelationshipFacade::Get().GetLoveCluster(owner_);
+
+    // Love縁相手との距離（離れすぎていたら攻撃中断）
+    decision.lovePartnerTooFar = decision.loveWithPlayer &&
+        (player_->GetPosition() - decision.position).Length() > GameConstants::kLoveInterruptDistance;
+
+    decision.loveClusterCenter = decision.position;
+    if (decision.loveCluster.size() > 1) {
+        Vector2 clusterCenter = Vector2::Zero;
+        for (Group* partner : decision.loveCluster) {
+            const Vector2 partnerPos = partner->GetPosition();
+            clusterCenter = clusterCenter + partnerPos;
+            if (partner != owner_ &&
+                (partnerPos - decision.position).Length() > GameConstants::kLoveInterruptDistance) {
+                decision.lovePartnerTooFar = true;
+            }
+        }
+        decision.loveClusterCenter = clusterCenter * (1.0f / static_cast<float>(decision.loveCluster.size()));
+    }
+}
+
 //----------------------------------------------------------------------------
 void GroupAI::Update(float dt)
 {
     if (!owner_) return;
 
+    // 判断フェーズを経ずに呼ばれた場合はここで判断する
+    if (!decision_.pending) {
+        Decide();
+    }
+    decision_.pending = false;
+
     // 硬直中は行動しない
     if (StaggerSystem::Get().IsStaggered(owner_)) {
         return;
@@ -67,10 +129,38 @@ void GroupAI::Update(float dt)
         return;
     }
 
+    // 思考はLODティアの間隔でのみ行う（画面外で徘徊中のグループは数Hz）
+    AILodController& lod = AILodController::Get();
+    lodTier_ = lod.ClassifyTier(decision_.position, state_, inCombat_);
+    if (lod.ConsumeThink(lodTier_, thinkProgress_, scaledDt)) {
+        Think();
+    }
+
+    // 状態に応じた更新（スケール済み時間で）
+    // LOG_DEBUG("[GroupAI::Update] " + owner_->GetId() + " state=" +
+    //           std::to_string(static_cast<int>(state_)) + " (0=Wander,1=Seek,2=Flee)");
+    switch (state_) {
+    case AIState::Wander:
+        UpdateWander(scaledDt);
+        break;
+    case AIState::Seek:
+        UpdateSeek(scaledDt);
+        break;
+    case AIState::Flee:
+        UpdateFlee(scaledDt);
+        break;
+    }
+
+    // 移動状態の変化を個体に通知
+    NotifyMovementChange();
+}
+
+//----------------------------------------------------------------------------
+void GroupAI::Think()
+{
     // Love縁相手との距離チェック（離れすぎたら追従に切り替え）
     if (state_ == AIState::Seek || state_ == AIState::Flee) {
-        bool tooFar = CheckLovePartnerDistance();
-        if (tooFar) {
+        if (decision_.lovePartnerTooFar) {
             // 全員が攻撃中断可能かチェック（攻撃開始から一定時間経過）
             bool canInterrupt = true;
             for (Individual* ind : owner_->GetAliveIndividuals()) {
@@ -101,24 +191,6 @@ void GroupAI::Update(float dt)
 
     // 状態遷移チェック
     CheckStateTransition();
-
-    // 状態に応じた更新（スケール済み時間で）
-    // LOG_DEBUG("[GroupAI::Update] " + owner_->GetId() + " state=" +
-    //           std::to_string(static_cast<int>(state_)) + " (0=Wander,1=Seek,2=Flee)");
-    switch (state_) {
-    case AIState::Wander:
-        UpdateWander(scaledDt);
-        break;
-    case AIState::Seek:
-        UpdateSeek(scaledDt);
-        break;
-    case AIState::Flee:
-        UpdateFlee(scaledDt);
-        break;
-    }
-
-    // 移動状態の変化を個体に通知
-    NotifyMovementChange();
 }
 
 //----------------------------------------------------------------------------
@@ -175,7 +247,7 @@ void GroupAI::SetTarget(Group* target)
             ClearTarget();
             return;
         }
-        target_ = target;
+        AssignTarget(target);
         if (inCombat_) {
             SetState(AIState::Seek);
         }
@@ -193,7 +265,7 @@ void GroupAI::SetTargetPlayer(Player* target)
             ClearTarget();
             return;
         }
-        target_ = target;
+        AssignTarget(target);
         if (inCombat_) {
             SetState(AIState::Seek);
         }
@@ -211,7 +283,30 @@ bool GroupAI::HasTarget() const
 //----------------------------------------------------------------------------
 void GroupAI::ClearTarget()
 {
-    target_ = std::monostate{};
+    AssignTarget(std::monostate{});
+}
+
+//----------------------------------------------------------------------------
+void GroupAI::AssignTarget(const AITarget& target)
+{
+    Group* previousGroup = std::holds_alternative<Group*>(target_) ? std::get<Group*>(target_) : nullptr;
+    target_ = target;
+    Group* nextGroup = std::holds_alternative<Group*>(target_) ? std::get<Group*>(target_) : nullptr;
+    if (nextGroup == previousGroup) return;
+
+    // ターゲットグループの全滅イベントのみ購読し直す（全AIへの一斉通知を避ける）
+    EventBus& bus = EventBus::Get();
+    if (defeatedSubscriptionId_ != 0) {
+        bus.Unsubscribe<GroupDefeatedEvent>(defeatedSubscriptionId_);
+        defeatedSubscriptionId_ = 0;
+    }
+    if (nextGroup) {
+        defeatedSubscriptionId_ = bus.SubscribeKeyed<GroupDefeatedEvent>(
+            nextGroup,
+            [this](const GroupDefeatedEvent& e) {
+                OnGroupDefeated(e.group);
+            });
+    }
 }
 
 //----------------------------------------------------------------------------
@@ -226,22 +321,20 @@ void GroupAI::FindTarget()
     }
 
     // ラブパートナーがいる場合は共有ターゲットを使用
-    RelationshipFacade& facade = RelationshipFacade::Get();
-    if (facade.HasLovePartners(owner_)) {
-        std::vector<Group*> cluster = facade.GetLoveCluster(owner_);
-        AITarget sharedTarget = facade.DetermineSharedTarget(cluster);
+    if (decision_.loveWithPlayer || decision_.loveCluster.size() > 1) {
+        AITarget sharedTarget = RelationshipFacade::Get().DetermineSharedTarget(decision_.loveCluster);
 
         // 共有ターゲットを設定
         if (std::holds_alternative<Group*>(sharedTarget)) {
             Group* targetGroup = std::get<Group*>(sharedTarget);
             if (targetGroup) {
-                target_ = targetGroup;
+                AssignTarget(targetGroup);
                 return;
             }
         } else if (std::holds_alternative<Player*>(sharedTarget)) {
             Player* targetPlayer = std::get<Player*>(sharedTarget);
             if (targetPlayer) {
-                target_ = targetPlayer;
+                AssignTarget(targetPlayer);
                 return;
             }
         }
@@ -250,8 +343,8 @@ void GroupAI::FindTarget()
     // CombatSystemを使ってターゲットを検索
     CombatSystem& combat = CombatSystem::Get();
 
-    // グループターゲットを検索
-    Group* groupTarget = combat.SelectTarget(owner_);
+    // グループターゲットを検索（フレーム頭に一括検索済みの結果を引く）
+    Group* groupTarget = GroupTargetIndex::Get().FindThreatTarget(owner_);
 
     // プレイヤーを攻撃可能か確認
     bool canAttackPlayer = combat.CanAttackPlayer(owner_);
@@ -261,9 +354,9 @@ void GroupAI::FindTarget()
     float playerThreat = (canAttackPlayer && player_) ? player_->GetThreat() : -1.0f;
 
     if (playerThreat > groupThreat && canAttackPlayer && player_) {
-        target_ = player_;
+        AssignTarget(player_);
     } else if (groupTarget) {
-        target_ = groupTarget;
+        AssignTarget(groupTarget);
     } else {
         ClearTarget();
     }
@@ -274,32 +367,11 @@ void GroupAI::FindTargetAsAlly()
 {
     if (!owner_) return;
 
-    // CombatSystemから敵グループを検索
-    CombatSystem& combat = CombatSystem::Get();
-    Vector2 myPos = owner_->GetPosition();
-
-    Group* bestTarget = nullptr;
-    float closestDistance = (std::numeric_limits<float>::max)();
-
-    // すべてのグループから敵（非味方）を検索
-    for (Group* candidate : combat.GetAllGroups()) {
-        if (!candidate || candidate == owner_) continue;
-        if (candidate->IsDefeated()) continue;
-        if (candidate->IsAlly()) continue;  // 味方は攻撃しない
-
-        // 索敵範囲チェック
-        float distance = (candidate->GetPosition() - myPos).Length();
-        if (distance > detectionRange_) continue;
-
-        // 最も近い敵を選択
-        if (distance < closestDistance) {
-            closestDistance = distance;
-            bestTarget = candidate;
-        }
-    }
+    // 索敵範囲内で最も近い敵（非味方）グループを空間インデックスから検索
+    Group* bestTarget = GroupTargetIndex::Get().FindNearestEnemy(owner_, detectionRange_);
 
     if (bestTarget) {
-        target_ = bestTarget;
+        AssignTarget(bestTarget);
     } else {
         ClearTarget();
     }
@@ -373,20 +445,8 @@ void GroupAI::UpdateWander(float dt)
 {
     wanderTimer_ += dt;
 
-    // プレイヤーとラブ縁で結ばれているかチェック
-    bool followPlayer = false;
-    if (player_) {
-        BondableEntity groupEntity = owner_;
-        BondableEntity playerEntity = player_;
-        const EdgeData* edge = RelationshipFacade::Get().GetEdge(groupEntity, playerEntity);
-        if (edge) {
-            // LOG_DEBUG("[UpdateWander] " + owner_->GetId() + " has bond with player, type=" +
-            //           std::to_string(static_cast<int>(edge->type)) + " (2=Love)");
-            if (edge->type == BondType::Love) {
-                followPlayer = true;
-            }
-        }
-    }
+    // プレイヤーとラブ縁で結ばれているか（判断フェーズの結果）
+    bool followPlayer = decision_.loveWithPlayer;
 
     // デバッグ: state確認
     // LOG_DEBUG("[UpdateWander] " + owner_->GetId() + " state=Wander, followPlayer=" +
@@ -438,21 +498,15 @@ void GroupAI::UpdateWander(float dt)
         }
     }
 
-    // ラブパートナー（グループ同士）がいる場合
-    std::vector<Group*> loveCluster = RelationshipFacade::Get().GetLoveCluster(owner_);
+    // ラブパートナー（グループ同士）がいる場合（クラスタと中心は判断フェーズの結果）
+    const std::vector<Group*>& loveCluster = decision_.loveCluster;
     bool hasLovePartners = loveCluster.size() > 1;
+    const Vector2& clusterCenter = decision_.loveClusterCenter;
 
     // グループ同士のLove縁：離れすぎたらお互いを追いかける
     if (hasLovePartners) {
         Vector2 currentPos = owner_->GetPosition();
 
-        // クラスタ中心を計算
-        Vector2 clusterCenter = Vector2::Zero;
-        for (Group* g : loveCluster) {
-            clusterCenter = clusterCenter + g->GetPosition();
-        }
-        clusterCenter = clusterCenter * (1.0f / static_cast<float>(loveCluster.size()));
-
         // 中心から離れすぎていたら中心に向かって移動（プレイヤー速度で）
         Vector2 toCenter = clusterCenter - currentPos;
         float distToCenter = toCenter.Length();
@@ -468,13 +522,6 @@ void GroupAI::UpdateWander(float dt)
     // 一定時間ごとに新しい目標を設定
     if (wanderTimer_ >= wanderInterval_) {
         if (hasLovePartners) {
-            // ラブクラスタの中心を計算
-            Vector2 clusterCenter = Vector2::Zero;
-            for (Group* g : loveCluster) {
-                clusterCenter = clusterCenter + g->GetPosition();
-            }
-            clusterCenter = clusterCenter * (1.0f / static_cast<float>(loveCluster.size()));
-
             // クラスタ中心から新しい目標を設定（最初のグループのみが計算）
             if (loveCluster[0] == owner_) {
                 std::uniform_real_distribution<float> angleDist(0.0f, kTwoPi);
@@ -619,13 +666,14 @@ void GroupAI::CheckStateTransition()
 {
     if (!owner_) return;
 
-    float hpRatio = owner_->GetHpRatio();
+    // HP・カメラ判定・Love縁の距離は判断フェーズの結果を使う
+    float hpRatio = decision_.hpRatio;
 
     // HP閾値チェック（Flee）- 戦闘中かつHP低下
     if (hpRatio < fleeThreshold_ && inCombat_) {
         // カメラ範囲内ならSeek状態を維持（攻撃継続）
         // ただしターゲットがいない場合はWanderを許可
-        if (IsInCameraView()) {
+        if (decision_.inCameraView) {
             if (HasTarget() && IsTargetValid()) {
                 if (state_ != AIState::Seek) {
                     LOG_INFO("[GroupAI] " + owner_->GetId() + " HP low but in camera view with target, staying in Seek");
@@ -664,7 +712,7 @@ void GroupAI::CheckStateTransition()
     }
 
     // Flee中にカメラ範囲内に入ったらSeekに戻る
-    if (state_ == AIState::Flee && IsInCameraView()) {
+    if (state_ == AIState::Flee && decision_.inCameraView) {
         LOG_INFO("[GroupAI] " + owner_->GetId() + " entered camera view while fleeing, returning to Seek");
         FindTarget();
         if (HasTarget()) {
@@ -687,7 +735,7 @@ void GroupAI::CheckStateTransition()
     // Wander中に敵を発見したらSeekに移行
     // ただしLove縁相手との距離が離れすぎていたら戦闘に入らない
     if (state_ == AIState::Wander) {
-        if (CheckLovePartnerDistance()) {
+        if (decision_.lovePartnerTooFar) {
             // Love相手が遠いので追従優先
             return;
         }
@@ -745,30 +793,17 @@ bool GroupAI::IsMoving() const
     float distance = diff.Length();
 
     if (state_ == AIState::Wander) {
-        // プレイヤーとのLove縁
-        if (player_) {
-            BondableEntity groupEntity = owner_;
-            BondableEntity playerEntity = player_;
-            const EdgeData* edge = RelationshipFacade::Get().GetEdge(groupEntity, playerEntity);
-            if (edge && edge->type == BondType::Love) {
-                Vector2 playerPos = player_->GetPosition();
-                float playerDist = (playerPos - owner_->GetPosition()).Length();
-                return playerDist > GameConstants::kLoveFollowStartDistance;
-            }
+        // プレイヤーとのLove縁（縁の有無とクラスタは判断フェーズの結果）
+        if (decision_.loveWithPlayer && player_) {
+            Vector2 playerPos = player_->GetPosition();
+            float playerDist = (playerPos - currentPos).Length();
+            return playerDist > GameConstants::kLoveFollowStartDistance;
         }
 
         // グループ同士のLove縁（クラスタ中心への移動）
-        std::vector<Group*> loveCluster = RelationshipFacade::Get().GetLoveCluster(owner_);
-        if (loveCluster.size() > 1) {
-            // クラスタ中心を計算
-            Vector2 clusterCenter = Vector2::Zero;
-            for (Group* g : loveCluster) {
-                clusterCenter = clusterCenter + g->GetPosition();
-            }
-            clusterCenter = clusterCenter * (1.0f / static_cast<float>(loveCluster.size()));
-
+        if (decision_.loveCluster.size() > 1) {
             // 中心からの距離で判定
-            float distToCenter = (clusterCenter - owner_->GetPosition()).Length();
+            float distToCenter = (decision_.loveClusterCenter - currentPos).Length();
             if (distToCenter > GameConstants::kLoveFollowStartDistance) {
                 return true;  // クラスタ中心に向かって移動中
             }
@@ -846,41 +881,6 @@ void GroupAI::NotifyMovementChange()
     }
 }
 
-//----------------------------------------------------------------------------
-bool GroupAI::CheckLovePartnerDistance() const
-{
-    if (!owner_) return false;
-
-    Vector2 myPos = owner_->GetPosition();
-
-    // プレイヤーとのLove縁チェック
-    if (player_) {
-        BondableEntity groupEntity = owner_;
-        BondableEntity playerEntity = player_;
-        const EdgeData* edge = RelationshipFacade::Get().GetEdge(groupEntity, playerEntity);
-        if (edge && edge->type == BondType::Love) {
-            float dist = (player_->GetPosition() - myPos).Length();
-            if (dist > GameConstants::kLoveInterruptDistance) {
-                return true;
-            }
-        }
-    }
-
-    // グループ同士のLove縁チェック
-    std::vector<Group*> loveCluster = RelationshipFacade::Get().GetLoveCluster(owner_);
-    if (loveCluster.size() > 1) {
-        for (Group* partner : loveCluster) {
-            if (partner == owner_) continue;
-            float dist = (partner->GetPosition() - myPos).Length();
-            if (dist > GameConstants::kLoveInterruptDistance) {
-                return true;
-            }
-        }
-    }
-
-    return false;
-}
-
 //----------------------------------------------------------------------------
 bool GroupAI::HasLoveBondWithPlayer() const
 {
@@ -905,16 +905,3 @@ void GroupAI::OnGroupDefeated(Group* defeatedGroup)
         }
     }
 }
-
-//----------------------------------------------------------------------------
-bool GroupAI::IsInCameraView(float margin) const
-{
-    if (!camera_ || !owner_) return false;
-
-    Vector2 minBounds, maxBounds;
-    camera_->GetWorldBounds(minBounds, maxBounds);
-    Vector2 pos = owner_->GetPosition();
-
-    return (pos.x >= minBounds.x - margin && pos.x <= maxBounds.x + margin &&
-            pos.y >= minBounds.y - margin && pos.y <= maxBounds.y + margin);
-}
@@ -5,9 +5,13 @@
 #pragma once
 
 #include "engine/math/math_types.h"
+#include "ai_lod_controller.h"
 #include <functional>
+#include <memory>
+#include <span>
 #include <variant>
 #include <random>
+#include <vector>
 
 // 前方宣言
 class Group;
@@ -29,9 +33,33 @@ enum class AIState
     Flee        //!< 逃走（HP低下時）
 };
 
+//----------------------------------------------------------------------------
+//! @brief 判断フェーズで作るフレームスナップショット
+//! @details GroupAI::Decide()が読み取り専用で集め、GroupAI::Update()の思考と移動で使う。
+//!          Love縁の問い合わせ（グラフ探索）とカメラ判定を1フレーム1回にまとめる
+//----------------------------------------------------------------------------
+struct GroupAIDecision
+{
+    Vector2 position;                   //!< グループ中心
+    float hpRatio = 1.0f;               //!< HP割合
+    bool inCameraView = false;          //!< カメラ範囲内か（マージン込み）
+    bool loveWithPlayer = false;        //!< プレイヤーとLove縁で結ばれているか
+    bool lovePartnerTooFar = false;     //!< Love縁相手が離れすぎているか（攻撃中断すべき）
+    std::vector<Group*> loveCluster;    //!< Loveクラスタ（自分を含む）
+    Vector2 loveClusterCenter;          //!< Loveクラスタの中心（相手がいる場合のみ有効）
+    bool pending = false;               //!< Update()で未使用か
+};
+
 //----------------------------------------------------------------------------
 //! @brief グループAI
-//! @details グループの行動（Wander/Seek/Flee）を制御する
+//! @details グループの行動（Wander/Seek/Flee）を制御する。
+//!          状態遷移の判定（思考）はAILodControllerのティアの間隔で行い、移動は毎フレーム行う
+//!
+//!          1フレームの更新は2段階:
+//!          1. 判断（DecideAll()）: 全AIのDecide()をJobSystemで並列に実行し、
+//!             他グループの位置やLoveクラスタを読むだけでGroupAIDecisionに書き込む
+//!          2. 適用（Update()）: 登録順に直列で実行し、状態変更・移動・イベント発行を行う
+//!          判断フェーズは各AIが自分のレコードにしか書かないため、ワーカー数によらず結果は同じ
 //----------------------------------------------------------------------------
 class GroupAI
 {
@@ -47,10 +75,21 @@ public:
     // 更新
     //------------------------------------------------------------------------
 
-    //! @brief AIを更新
+    //! @brief 全AIの判断フェーズを実行（ワーカーがあれば並列）
+    //! @note メインスレッドから呼び、完了まで待つ。実行中は他のシステムから状態を変更しないこと
+    static void DecideAll(std::span<const std::unique_ptr<GroupAI>> ais);
+
+    //! @brief 判断フェーズ（読み取り専用、ワーカースレッドから呼び出し可能）
+    void Decide();
+
+    //! @brief AIを更新（適用フェーズ）
     //! @param dt デルタタイム
+    //! @note 今フレームのDecide()が済んでいなければ先に実行する
     void Update(float dt);
 
+    //! @brief 直近の判断結果を取得
+    [[nodiscard]] const GroupAIDecision& GetDecision() const { return decision_; }
+
     //------------------------------------------------------------------------
     // 状態制御
     //------------------------------------------------------------------------
@@ -58,6 +97,9 @@ public:
     //! @brief 現在の状態を取得
     [[nodiscard]] AIState GetState() const { return state_; }
 
+    //! @brief 直近のUpdate()で判定したLODティアを取得
+    [[nodiscard]] AILodTier GetLodTier() const { return lodTier_; }
+
     //! @brief 状態を強制設定
     void SetState(AIState state);
 
@@ -150,6 +192,9 @@ public:
     [[nodiscard]] bool IsMoving() const;
 
 private:
+    //! @brief 思考（Love縁の距離チェックと状態遷移判定）
+    void Think();
+
     //! @brief Wander状態の更新
     void UpdateWander(float dt);
 
@@ -168,10 +213,6 @@ private:
     //! @brief ターゲットが有効か判定（生存しているか）
     [[nodiscard]] bool IsTargetValid() const;
 
-    //! @brief Love縁相手との距離が離れすぎているかチェック
-    //! @return 離れすぎていればtrue（攻撃中断すべき）
-    [[nodiscard]] bool CheckLovePartnerDistance() const;
-
     //! @brief プレイヤーとLove縁で結ばれているかチェック
     [[nodiscard]] bool HasLoveBondWithPlayer() const;
 
@@ -183,6 +224,12 @@ private:
     AIState state_ = AIState::Wander;   //!< 現在の状態
     bool inCombat_ = false;             //!< 戦闘中フラグ
 
+    GroupAIDecision decision_;          //!< 判断フェーズの結果
+
+    // LOD
+    AILodTier lodTier_ = AILodTier::Full;   //!< 直近のティア
+    float thinkProgress_ = 0.0f;            //!< 思考間隔に対する進み（初期値は位相）
+
     // Wanderパラメータ
     Vector2 wanderTarget_;              //!< 徘徊目標位置
     float wanderTimer_ = 0.0f;          //!< 徘徊タイマー
@@ -208,7 +255,7 @@ private:
 
     bool wasMoving_ = false;            //!< 前フレームの移動状態（変化検出用）
 
-    //! @brief GroupDefeatedEventの購読ID（解除用）
+    //! @brief GroupDefeatedEventの購読ID（現在のターゲットグループをキーに購読）
     uint32_t defeatedSubscriptionId_ = 0;
 
     //! @brief 移動状態の変化を検出して個体に通知
@@ -217,8 +264,7 @@ private:
     //! @brief グループ全滅イベントハンドラ（ターゲットクリア用）
     void OnGroupDefeated(Group* defeatedGroup);
 
-    //! @brief カメラ範囲内かチェック
-    //! @param margin マージン（ピクセル）
-    //! @return カメラ範囲内ならtrue
-    [[nodiscard]] bool IsInCameraView(float margin = 50.0f) const;
+    //! @brief ターゲットを設定し、ターゲットグループの全滅イベント購読を付け替える
+    //! @note target_への代入は必ずこの関数を経由すること
+    void AssignTarget(const AITarget& target);
 };
@@ -0,0 +1,351 @@
+//----------------------------------------------------------------------------
+//! @file   group_target_index.cpp
+//! @brief  GroupTargetIndex実装
+//----------------------------------------------------------------------------
+#include "group_target_index.h"
+#include "game/entities/group.h"
+#include "game/systems/group_manager.h"
+#include "game/systems/hostility_matrix.h"
+#include <cassert>
+#include <limits>
+
+namespace {
+    constexpr float kMinCellSize = 1.0f;        //!< セルサイズの下限
+    constexpr float kCellsPerRange = 2.0f;      //!< 索敵範囲あたりのセル数（リング探索の打ち切り精度）
+    constexpr size_t kMinCellBudget = 256;      //!< セル数上限の最小値
+    constexpr size_t kCellsPerEntry = 4;        //!< グループ1つあたりのセル数上限
+
+    //! @brief ビット列のbitが立っているか（範囲外はfalse）
+    bool TestMask(std::span<const uint64_t> mask, uint32_t bit)
+    {
+        const size_t word = bit >> 6;
+        return word < mask.size() && ((mask[word] >> (bit & 63)) & 1u);
+    }
+}
+
+//----------------------------------------------------------------------------
+GroupTargetIndex& GroupTargetIndex::Get()
+{
+    assert(instance_ && "GroupTargetIndex::Create() not called");
+    return *instance_;
+}
+
+//----------------------------------------------------------------------------
+void GroupTargetIndex::Create()
+{
+    if (!instance_) {
+        instance_.reset(new GroupTargetIndex());
+    }
+}
+
+//----------------------------------------------------------------------------
+void GroupTargetIndex::Destroy()
+{
+    instance_.reset();
+}
+
+//----------------------------------------------------------------------------
+void GroupTargetIndex::Build()
+{
+    GroupManager& groupManager = GroupManager::Get();
+    HostilityMatrix& hostility = HostilityMatrix::Get();
+    hostility.Refresh();
+
+    groups_.clear();
+    denseIds_.clear();
+    positions_.clear();
+    threats_.clear();
+    detectionRanges_.clear();
+
+    const size_t denseCount = groupManager.GetDenseGroups().size();
+    entryOfDense_.assign(denseCount, kNoEntry);
+    nonAllyMask_.assign((denseCount + 63) / 64, 0);
+
+    // 生存グループをスナップショット（GroupManagerの登録順）
+    float maxRange = 0.0f;
+    for (const auto& owned : groupManager.GetAllGroups()) {
+        Group* group = owned.get();
+        if (!group || group->IsDefeated()) continue;
+
+        const uint32_t entry = static_cast<uint32_t>(groups_.size());
+        const uint32_t denseId = group->GetDenseId();
+        groups_.push_back(group);
+        denseIds_.push_back(denseId);
+        positions_.push_back(group->GetPosition());
+        threats_.push_back(group->GetThreat());
+        detectionRanges_.push_back(group->GetDetectionRange());
+        maxRange = (std::max)(maxRange, group->GetDetectionRange());
+
+        entryOfDense_[denseId] = entry;
+        if (!group->IsAlly()) {
+            nonAllyMask_[denseId >> 6] |= uint64_t{ 1 } << (denseId & 63);
+        }
+    }
+
+    membershipRevision_ = groupManager.GetMembershipRevision();
+    built_ = true;
+
+    const size_t count = groups_.size();
+    if (count == 0) {
+        cellEntries_.clear();
+        cellStart_.clear();
+        threatTargets_.clear();
+        nearestEnemies_.clear();
+        columns_ = 0;
+        rows_ = 0;
+        return;
+    }
+
+    // 範囲
+    float minX = positions_[0].x;
+    float minY = positions_[0].y;
+    float maxX = minX;
+    float maxY = minY;
+    for (const Vector2& pos : positions_) {
+        minX = (std::min)(minX, pos.x);
+        minY = (std::min)(minY, pos.y);
+        maxX = (std::max)(maxX, pos.x);
+        maxY = (std::max)(maxY, pos.y);
+    }
+
+    // セルサイズ＝最大索敵範囲の半分（広く散らばってセル数が上限を超える場合は大きくする）
+    const size_t cellBudget = (std::max)(kMinCellBudget, count * kCellsPerEntry);
+    cellSize_ = (std::max)(maxRange / kCellsPerRange, kMinCellSize);
+    for (;;) {
+        columns_ = static_cast<int>((maxX - minX) / cellSize_) + 1;
+        rows_ = static_cast<int>((maxY - minY) / cellSize_) + 1;
+        const size_t cells = static_cast<size_t>(columns_) * static_cast<size_t>(rows_);
+        if (cells <= cellBudget) break;
+        cellSize_ *= std::sqrt(static_cast<float>(cells) / static_cast<float>(cellBudget)) * 1.01f;
+    }
+    inverseCellSize_ = 1.0f / cellSize_;
+    originX_ = minX;
+    originY_ = minY;
+
+    // セル順の計数ソート（セル内はエントリ番号順のまま）
+    const size_t cellCount = static_cast<size_t>(columns_) * static_cast<size_t>(rows_);
+    cellStart_.assign(cellCount + 1, 0);
+    gatheredCell_.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        const int cx = (std::min)(CellX(positions_[i].x), columns_ - 1);
+        const int cy = (std::min)(CellY(positions_[i].y), rows_ - 1);
+        const uint32_t cell = static_cast<uint32_t>(cy * columns_ + cx);
+        gatheredCell_[i] = cell;
+        ++cellStart_[cell + 1];
+    }
+    for (size_t cell = 0; cell < cellCount; ++cell) {
+        cellStart_[cell + 1] += cellStart_[cell];
+    }
+    cellEntries_.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        cellEntries_[cellStart_[gatheredCell_[i]]++] = static_cast<uint32_t>(i);
+    }
+    // cellStart_はセル末尾を指すようになったので1つずらして戻す
+    for (size_t cell = cellCount; cell > 0; --cell) {
+        cellStart_[cell] = cellStart_[cell - 1];
+    }
+    cellStart_[0] = 0;
+
+    // 全グループのターゲット検索を1パスで解決
+    // 敵は脅威度最大の敵対グループ、味方は最も近い非味方グループを使う
+    threatTargets_.assign(count, kNotResolved);
+    nearestEnemies_.assign(count, kNotResolved);
+    for (uint32_t entry = 0; entry < count; ++entry) {
+        if (TestMask(nonAllyMask_, denseIds_[entry])) {
+            threatTargets_[entry] = QueryHighestThreat(
+                positions_[entry], detectionRanges_[entry], entry, hostility.GetHostileRow(denseIds_[entry]));
+        } else {
+            nearestEnemies_[entry] = QueryNearest(
+                positions_[entry], detectionRanges_[entry], entry, nonAllyMask_);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+void GroupTargetIndex::Clear()
+{
+    groups_.clear();
+    denseIds_.clear();
+    positions_.clear();
+    threats_.clear();
+    detectionRanges_.clear();
+    entryOfDense_.clear();
+    nonAllyMask_.clear();
+    cellEntries_.clear();
+    cellStart_.clear();
+    gatheredCell_.clear();
+    threatTargets_.clear();
+    nearestEnemies_.clear();
+    columns_ = 0;
+    rows_ = 0;
+    built_ = false;
+}
+
+//----------------------------------------------------------------------------
+Group* GroupTargetIndex::FindThreatTarget(Group* attacker)
+{
+    if (!attacker || !attacker->IsRegistered()) return nullptr;
+
+    EnsureCurrent();
+    HostilityMatrix& hostility = HostilityMatrix::Get();
+
+    // 一括検索の結果がまだ有効ならそのまま使う
+    const uint32_t self = EntryOf(attacker);
+    if (self != kNoEntry && threatTargets_[self] != kNotResolved) {
+        Group* cached = GroupOf(threatTargets_[self]);
+        if (!cached) return nullptr;
+        if (!cached->IsDefeated() && hostility.IsHostile(attacker, cached)) return cached;
+    }
+
+    ++fallbackQueryCount_;
+    const Vector2 center = (self != kNoEntry) ? positions_[self] : attacker->GetPosition();
+    return GroupOf(QueryHighestThreat(center, attacker->GetDetectionRange(), self,
+                                      hostility.GetHostileRow(attacker->GetDenseId())));
+}
+
+//----------------------------------------------------------------------------
+Group* GroupTargetIndex::FindNearestEnemy(Group* group, float range)
+{
+    if (!group) return nullptr;
+
+    EnsureCurrent();
+
+    // 一括検索と同じ範囲で、結果がまだ有効ならそのまま使う
+    const uint32_t self = EntryOf(group);
+    if (self != kNoEntry && nearestEnemies_[self] != kNotResolved && range == detectionRanges_[self]) {
+        Group* cached = GroupOf(nearestEnemies_[self]);
+        if (!cached) return nullptr;
+        if (!cached->IsDefeated() && !cached->IsAlly()) return cached;
+    }
+
+    ++fallbackQueryCount_;
+    const Vector2 center = (self != kNoEntry) ? positions_[self] : group->GetPosition();
+    return GroupOf(QueryNearest(center, range, self, nonAllyMask_));
+}
+
+//----------------------------------------------------------------------------
+void GroupTargetIndex::EnsureCurrent()
+{
+    if (!built_ || membershipRevision_ != GroupManager::Get().GetMembershipRevision()) {
+        Build();
+    }
+}
+
+//----------------------------------------------------------------------------
+uint32_t GroupTargetIndex::QueryHighestThreat(const Vector2& center, float range, uint32_t self,
+                                              std::span<const uint64_t> mask) const
+{
+    if (groups_.empty()) return kNoEntry;
+
+    const int minX = (std::max)(CellX(center.x - range), 0);
+    const int maxX = (std::min)(CellX(center.x + range), columns_ - 1);
+    const int minY = (std::max)(CellY(center.y - range), 0);
+    const int maxY = (std::min)(CellY(center.y + range), rows_ - 1);
+
+    uint32_t best = kNoEntry;
+    float highestThreat = -1.0f;
+    for (int cy = minY; cy <= maxY; ++cy) {
+        const uint32_t rowBase = static_cast<uint32_t>(cy * columns_);
+        for (uint32_t i = cellStart_[rowBase + minX]; i < cellStart_[rowBase + maxX + 1]; ++i) {
+            const uint32_t entry = cellEntries_[i];
+            if (!IsCandidate(entry, self, mask)) continue;
+            if ((positions_[entry] - center).Length() > range) continue;
+
+            // 同点は登録順で先のグループ
+            const float threat = threats_[entry];
+            if (threat > highestThreat || (best != kNoEntry && threat == highestThreat && entry < best)) {
+                highestThreat = threat;
+                best = entry;
+            }
+        }
+    }
+    return best;
+}
+
+//----------------------------------------------------------------------------
+uint32_t GroupTargetIndex::QueryNearest(const Vector2& center, float range, uint32_t self,
+                                        std::span<const uint64_t> mask) const
+{
+    if (groups_.empty()) return kNoEntry;
+
+    uint32_t best = kNoEntry;
+    float closestDistance = (std::numeric_limits<float>::max)();
+    auto visitCells = [&](int cy, int beginX, int endX) {
+        const uint32_t rowBase = static_cast<uint32_t>(cy * columns_);
+        for (uint32_t i = cellStart_[rowBase + beginX]; i < cellStart_[rowBase + endX + 1]; ++i) {
+            const uint32_t entry = cellEntries_[i];
+            if (!IsCandidate(entry, self, mask)) continue;
+
+            const float distance = (positions_[entry] - center).Length();
+            if (distance > range) continue;
+
+            // 同距離は登録順で先のグループ
+            if (distance < closestDistance || (distance == closestDistance && entry < best)) {
+                closestDistance = distance;
+                best = entry;
+            }
+        }
+    };
+
+    const int ox = CellX(center.x);
+    const int oy = CellY(center.y);
+    if (ox < 0 || ox >= columns_ || oy < 0 || oy >= rows_) {
+        // グリッド外からの検索は範囲に掛かるセルを全て走査
+        const int minX = (std::max)(CellX(center.x - range), 0);
+        const int maxX = (std::min)(CellX(center.x + range), columns_ - 1);
+        const int minY = (std::max)(CellY(center.y - range), 0);
+        const int maxY = (std::min)(CellY(center.y + range), rows_ - 1);
+        if (minX > maxX) return kNoEntry;
+        for (int cy = minY; cy <= maxY; ++cy) {
+            visitCells(cy, minX, maxX);
+        }
+        return best;
+    }
+
+    // 自セルから外側へリング状に探索
+    // リングrのセルまでの距離は(r - 1) * cellSize_以上なので、それが見つけた最短距離か
+    // 索敵範囲を超えたら打ち切る
+    const int maxRing = (std::max)((std::max)(ox, columns_ - 1 - ox), (std::max)(oy, rows_ - 1 - oy));
+    for (int ring = 0; ring <= maxRing; ++ring) {
+        if (ring > 0) {
+            const float gap = static_cast<float>(ring - 1) * cellSize_;
+            if (gap > range || gap > closestDistance) break;
+        }
+
+        const int minX = (std::max)(ox - ring, 0);
+        const int maxX = (std::min)(ox + ring, columns_ - 1);
+        const int minY = (std::max)(oy - ring, 0);
+        const int maxY = (std::min)(oy + ring, rows_ - 1);
+        for (int cy = minY; cy <= maxY; ++cy) {
+            if (cy == oy - ring || cy == oy + ring) {
+                // 上下の辺は行全体
+                visitCells(cy, minX, maxX);
+            } else {
+                // 左右の辺は両端のセルのみ
+                if (ox - ring >= 0) visitCells(cy, ox - ring, ox - ring);
+                if (ox + ring < columns_) visitCells(cy, ox + ring, ox + ring);
+            }
+        }
+    }
+    return best;
+}
+
+//----------------------------------------------------------------------------
+bool GroupTargetIndex::IsCandidate(uint32_t entry, uint32_t self, std::span<const uint64_t> mask) const
+{
+    if (entry == self) return false;
+    if (!TestMask(mask, denseIds_[entry])) return false;
+    return !groups_[entry]->IsDefeated();
+}
+
+//----------------------------------------------------------------------------
+uint32_t GroupTargetIndex::EntryOf(const Group* group) const
+{
+    if (!group || !group->IsRegistered()) return kNoEntry;
+
+    const uint32_t denseId = group->GetDenseId();
+    if (denseId >= entryOfDense_.size()) return kNoEntry;
+
+    const uint32_t entry = entryOfDense_[denseId];
+    return (entry != kNoEntry && groups_[entry] == group) ? entry : kNoEntry;
+}
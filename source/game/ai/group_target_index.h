@@ -0,0 +1,169 @@
+//----------------------------------------------------------------------------
+//! @file   group_target_index.h
+//! @brief  GroupTargetIndex - グループ中心の空間インデックスによるターゲット検索
+//----------------------------------------------------------------------------
+#pragma once
+
+#include <SimpleMath.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+using DirectX::SimpleMath::Vector2;
+
+// 前方宣言
+class Group;
+
+//----------------------------------------------------------------------------
+//! @brief GroupAIのターゲット検索用インデックス（シングルトン）
+//! @details 毎フレーム、生存グループの中心位置・脅威度・陣営をスナップショットし、
+//!          一様グリッドに振り分ける。候補の絞り込みは密なID（Group::GetDenseId()）の
+//!          ビットマスクで行う。
+//!          - 敵グループ: HostilityMatrixの敵対ビット行
+//!          - 味方グループ: 非味方グループのマスク
+//!
+//!          Build()の最後に全グループ分の検索を1パスでまとめて解決し、結果を保持する。
+//!          GroupAI::FindTarget()はその結果を引くだけで済み、フレーム中に倒された・
+//!          敵対でなくなったターゲットの場合のみその場で再検索する。
+//!
+//!          - FindThreatTarget(): 索敵範囲内で脅威度最大の敵対グループ
+//!            （CombatSystem::SelectTarget()と同じ規則）
+//!          - FindNearestEnemy(): 範囲内で最も近い非味方グループ（セルのリング探索）
+//!          同点はGroupManagerの登録順で先のグループを選ぶ（全走査版と同じ結果）。
+//!
+//! @note 位置と脅威度はBuild()時点の値を使う。グループの追加・削除は
+//!       GroupManagerの変更カウンタで検出し、次の検索で作り直す
+//----------------------------------------------------------------------------
+class GroupTargetIndex
+{
+public:
+    //! @brief シングルトンインスタンス取得
+    static GroupTargetIndex& Get();
+
+    //! @brief インスタンス生成
+    static void Create();
+
+    //! @brief インスタンス破棄
+    static void Destroy();
+
+    //! @brief デストラクタ
+    ~GroupTargetIndex() = default;
+
+    //------------------------------------------------------------------------
+    // 構築
+    //------------------------------------------------------------------------
+
+    //! @brief 生存グループからインデックスを構築し、全グループのターゲットを一括検索
+    //! @note GroupAI::Update()の前に1フレーム1回呼ぶ
+    void Build();
+
+    //! @brief 空にする
+    void Clear();
+
+    //------------------------------------------------------------------------
+    // 検索
+    //------------------------------------------------------------------------
+
+    //! @brief 攻撃者の索敵範囲内で脅威度最大の敵対グループ
+    //! @param attacker 攻撃者（範囲はGroup::GetDetectionRange()）
+    //! @return 見つからなければnullptr
+    [[nodiscard]] Group* FindThreatTarget(Group* attacker);
+
+    //! @brief 範囲内で最も近い非味方グループ
+    //! @param group 検索元
+    //! @param range 索敵範囲
+    //! @return 見つからなければnullptr
+    [[nodiscard]] Group* FindNearestEnemy(Group* group, float range);
+
+    //------------------------------------------------------------------------
+    // 統計
+    //------------------------------------------------------------------------
+
+    //! @brief 登録グループ数
+    [[nodiscard]] size_t GetEntryCount() const { return groups_.size(); }
+
+    //! @brief セルサイズ
+    [[nodiscard]] float GetCellSize() const { return cellSize_; }
+
+    //! @brief 一括検索の結果を使えずに再検索した回数
+    [[nodiscard]] uint64_t GetFallbackQueryCount() const { return fallbackQueryCount_; }
+
+private:
+    GroupTargetIndex() = default;
+    GroupTargetIndex(const GroupTargetIndex&) = delete;
+    GroupTargetIndex& operator=(const GroupTargetIndex&) = delete;
+
+    //! @brief エントリなし
+    static constexpr uint32_t kNoEntry = UINT32_MAX;
+
+    //! @brief 一括検索の対象外（その場で検索する）
+    static constexpr uint32_t kNotResolved = UINT32_MAX - 1;
+
+    //! @brief グループ増減があれば作り直す
+    void EnsureCurrent();
+
+    //! @brief 脅威度最大の候補を検索
+    //! @param mask 候補の密なIDビット
+    [[nodiscard]] uint32_t QueryHighestThreat(const Vector2& center, float range, uint32_t self,
+                                              std::span<const uint64_t> mask) const;
+
+    //! @brief 最も近い候補をリング探索
+    //! @param mask 候補の密なIDビット
+    [[nodiscard]] uint32_t QueryNearest(const Vector2& center, float range, uint32_t self,
+                                        std::span<const uint64_t> mask) const;
+
+    //! @brief エントリが候補か（マスクのビットが立っていて、まだ倒されていない）
+    [[nodiscard]] bool IsCandidate(uint32_t entry, uint32_t self, std::span<const uint64_t> mask) const;
+
+    //! @brief グループのエントリ番号（スナップショットにいなければkNoEntry）
+    [[nodiscard]] uint32_t EntryOf(const Group* group) const;
+
+    //! @brief エントリのグループ（kNoEntryならnullptr）
+    [[nodiscard]] Group* GroupOf(uint32_t entry) const
+    {
+        return entry == kNoEntry ? nullptr : groups_[entry];
+    }
+
+    //! @brief 座標→セル番号（グリッド外は-1またはcountに丸める）
+    [[nodiscard]] int ClampedCell(float coord, float origin, int count) const
+    {
+        const float cell = std::floor((coord - origin) * inverseCellSize_);
+        return static_cast<int>((std::max)(-1.0f, (std::min)(cell, static_cast<float>(count))));
+    }
+    [[nodiscard]] int CellX(float x) const { return ClampedCell(x, originX_, columns_); }
+    [[nodiscard]] int CellY(float y) const { return ClampedCell(y, originY_, rows_); }
+
+    static inline std::unique_ptr<GroupTargetIndex> instance_ = nullptr;
+
+    // スナップショット（エントリ番号＝GroupManagerの登録順）
+    std::vector<Group*> groups_;            //!< グループ
+    std::vector<uint32_t> denseIds_;        //!< 密なID
+    std::vector<Vector2> positions_;        //!< 中心位置
+    std::vector<float> threats_;            //!< 脅威度
+    std::vector<float> detectionRanges_;    //!< 索敵範囲
+    std::vector<uint32_t> entryOfDense_;    //!< 密なID→エントリ番号
+    std::vector<uint64_t> nonAllyMask_;     //!< 非味方グループの密なIDビット
+
+    // セル順に並べたエントリ番号
+    std::vector<uint32_t> cellEntries_;     //!< エントリ番号
+    std::vector<uint32_t> cellStart_;       //!< セル→cellEntries_の開始位置（末尾に番兵）
+    std::vector<uint32_t> gatheredCell_;    //!< 構築用の一時データ
+
+    // 一括検索の結果（エントリ番号）
+    std::vector<uint32_t> threatTargets_;   //!< FindThreatTarget()の結果
+    std::vector<uint32_t> nearestEnemies_;  //!< 自分の索敵範囲でのFindNearestEnemy()の結果（味方のみ）
+
+    float originX_ = 0.0f;
+    float originY_ = 0.0f;
+    float cellSize_ = 1.0f;
+    float inverseCellSize_ = 1.0f;
+    int columns_ = 0;
+    int rows_ = 0;
+
+    uint64_t membershipRevision_ = 0;       //!< 構築時のグループ増減カウンタ
+    bool built_ = false;                    //!< 構築済みか
+    uint64_t fallbackQueryCount_ = 0;
+};
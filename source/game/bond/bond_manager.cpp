@@ -4,6 +4,7 @@
 //----------------------------------------------------------------------------
 #include "bond_manager.h"
 #include "game/entities/group.h"
+#include "game/entities/entity_pools.h"
 #include "common/logging/logging.h"
 #include <algorithm>
 #include <queue>
@@ -61,7 +62,7 @@ Bond* BondManager::CreateBond(BondableEntity a, BondableEntity b, BondType type)
     }
 
     // 縁を作成
-    std::unique_ptr<Bond> bond = std::make_unique<Bond>(a, b, type);
+    PoolPtr<Bond> bond = EntityPools::Get().Bonds().Create(a, b, type);
     Bond* bondPtr = bond.get();
     bonds_.push_back(std::move(bond));
 
@@ -113,7 +114,7 @@ bool BondManager::RemoveBond(Bond* bond)
     if (!bond) return false;
 
     auto it = std::find_if(bonds_.begin(), bonds_.end(),
-        [bond](const std::unique_ptr<Bond>& b) { return b.get() == bond; });
+        [bond](const PoolPtr<Bond>& b) { return b.get() == bond; });
 
     if (it != bonds_.end()) {
         BondableEntity a = bond->GetEntityA();
@@ -169,7 +170,7 @@ void BondManager::RebuildCache()
     entityBondsCache_.clear();
     typeBondsCache_.clear();
 
-    for (const std::unique_ptr<Bond>& bond : bonds_) {
+    for (const PoolPtr<Bond>& bond : bonds_) {
         Bond* bondPtr = bond.get();
 
         // エンティティ別キャッシュ
@@ -193,7 +194,7 @@ bool BondManager::AreDirectlyConnected(const BondableEntity& a, const BondableEn
 //----------------------------------------------------------------------------
 Bond* BondManager::GetBond(const BondableEntity& a, const BondableEntity& b) const
 {
-    for (const std::unique_ptr<Bond>& bond : bonds_) {
+    for (const PoolPtr<Bond>& bond : bonds_) {
         if (bond->Connects(a, b)) {
             return bond.get();
         }
@@ -277,7 +278,7 @@ std::vector<Bond*> BondManager::GetAllBondsCopy() const
     std::vector<Bond*> result;
     result.reserve(bonds_.size());
 
-    for (const std::unique_ptr<Bond>& bond : bonds_) {
+    for (const PoolPtr<Bond>& bond : bonds_) {
         result.push_back(bond.get());
     }
 
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "bond.h"
+#include "common/utility/object_pool.h"
 #include <vector>
 #include <memory>
 #include <functional>
@@ -75,7 +76,7 @@ public:
     //! @brief 全ての縁を取得（参照版 - イテレーション中の変更禁止）
     //! @warning イテレーション中にCreateBond()/RemoveBond()を呼ぶとクラッシュする可能性あり
     //!          イテレーション中に変更の可能性がある場合はGetAllBondsCopy()を使用すること
-    [[nodiscard]] const std::vector<std::unique_ptr<Bond>>& GetAllBonds() const { return bonds_; }
+    [[nodiscard]] const std::vector<PoolPtr<Bond>>& GetAllBonds() const { return bonds_; }
 
     //! @brief 全ての縁を取得（コピー版 - イテレーション中の変更に安全）
     //! @return 全ての縁へのポインタのコピー
@@ -124,7 +125,7 @@ private:
 
     static inline std::unique_ptr<BondManager> instance_ = nullptr;
 
-    std::vector<std::unique_ptr<Bond>> bonds_;  //!< 全ての縁
+    std::vector<PoolPtr<Bond>> bonds_;  //!< 全ての縁（EntityPoolsから確保）
 
     // キャッシュ（O(1)ルックアップ用）
     std::unordered_map<std::string, std::vector<Bond*>> entityBondsCache_;  //!< エンティティID→縁リスト
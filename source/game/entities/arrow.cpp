@@ -5,6 +5,7 @@
 #include "arrow.h"
 #include "individual.h"
 #include "player.h"
+#include "entity_pools.h"
 #include "engine/texture/texture_manager.h"
 #include "engine/c_systems/sprite_batch.h"
 #include "engine/c_systems/collision_manager.h"
@@ -15,15 +16,15 @@
 
 //----------------------------------------------------------------------------
 Arrow::Arrow(Individual* owner, Individual* target, float damage)
-    : owner_(owner)
-    , target_(target)
+    : owner_(EntityPools::Get().GetHandle(owner))
+    , target_(EntityPools::Get().GetHandle(target))
     , damage_(damage)
 {
 }
 
 //----------------------------------------------------------------------------
 Arrow::Arrow(Individual* owner, Player* targetPlayer, float damage)
-    : owner_(owner)
+    : owner_(EntityPools::Get().GetHandle(owner))
     , targetPlayer_(targetPlayer)
     , damage_(damage)
 {
@@ -36,7 +37,8 @@ Arrow::~Arrow() = default;
 void Arrow::Initialize(const Vector2& startPos, const Vector2& targetPos)
 {
     // GameObject作成
-    gameObject_ = std::make_unique<GameObject>("Arrow");
+    gameObject_ = EntityPools::Get().GameObjects().Create("Arrow",
+        ComponentLayout<Transform, SpriteRenderer, Collider2D>{});
     transform_ = gameObject_->AddComponent<Transform>(startPos);
     sprite_ = gameObject_->AddComponent<SpriteRenderer>();
 
@@ -56,13 +58,17 @@ void Arrow::Initialize(const Vector2& startPos, const Vector2& targetPos)
             return;
         }
 
+        const EntityPools& pools = EntityPools::Get();
+        Individual* owner = pools.Resolve(owner_);
+        Individual* target = pools.Resolve(target_);
+
         // Individual対象
-        if (target_ != nullptr && target_->GetCollider() == other) {
-            if (target_->IsAlive()) {
-                target_->TakeDamage(damage_);
+        if (target != nullptr && target->GetCollider() == other) {
+            if (target->IsAlive()) {
+                target->TakeDamage(damage_);
                 isActive_ = false;
-                if (owner_ != nullptr) {
-                    LOG_INFO("[Arrow] Hit! " + owner_->GetId() + " -> " + target_->GetId() +
+                if (owner != nullptr) {
+                    LOG_INFO("[Arrow] Hit! " + owner->GetId() + " -> " + target->GetId() +
                              " for " + std::to_string(damage_) + " damage");
                 }
             }
@@ -74,8 +80,8 @@ void Arrow::Initialize(const Vector2& startPos, const Vector2& targetPos)
             if (targetPlayer_->IsAlive()) {
                 targetPlayer_->TakeDamage(damage_);
                 isActive_ = false;
-                if (owner_ != nullptr) {
-                    LOG_INFO("[Arrow] Hit! " + owner_->GetId() + " -> Player for " +
+                if (owner != nullptr) {
+                    LOG_INFO("[Arrow] Hit! " + owner->GetId() + " -> Player for " +
                              std::to_string(damage_) + " damage");
                 }
             }
@@ -10,6 +10,7 @@
 #include "engine/component/collider2d.h"
 #include "engine/math/math_types.h"
 #include "engine/texture/texture_types.h"
+#include "common/utility/object_pool.h"
 #include <memory>
 #include <string>
 
@@ -60,13 +61,13 @@ public:
     [[nodiscard]] Vector2 GetPosition() const;
 
 private:
-    // 所有者・ターゲット
-    Individual* owner_ = nullptr;
-    Individual* target_ = nullptr;
+    // 所有者・ターゲット（個体はハンドルで保持し、飛行中に解放されても参照しない）
+    PoolHandle<Individual> owner_;
+    PoolHandle<Individual> target_;
     Player* targetPlayer_ = nullptr;
 
-    // GameObject
-    std::unique_ptr<GameObject> gameObject_;
+    // GameObject（EntityPoolsから確保）
+    PoolPtr<GameObject> gameObject_;
     Transform* transform_ = nullptr;
     SpriteRenderer* sprite_ = nullptr;
     Collider2D* collider_ = nullptr;
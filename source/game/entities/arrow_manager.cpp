@@ -5,6 +5,7 @@
 #include "arrow_manager.h"
 #include "individual.h"
 #include "player.h"
+#include "entity_pools.h"
 #include "engine/c_systems/sprite_batch.h"
 #include "common/logging/logging.h"
 #include <algorithm>
@@ -54,7 +55,7 @@ void ArrowManager::Shoot(Individual* owner, Individual* target, const Vector2& s
         return;
     }
 
-    std::unique_ptr<Arrow> arrow = std::make_unique<Arrow>(owner, target, damage);
+    PoolPtr<Arrow> arrow = EntityPools::Get().Arrows().Create(owner, target, damage);
     arrow->Initialize(startPos, target->GetPosition());
     arrows_.push_back(std::move(arrow));
 }
@@ -83,7 +84,7 @@ void ArrowManager::ShootAtPlayer(Individual* owner, Player* targetPlayer, const
         return;
     }
 
-    std::unique_ptr<Arrow> arrow = std::make_unique<Arrow>(owner, targetPlayer, damage);
+    PoolPtr<Arrow> arrow = EntityPools::Get().Arrows().Create(owner, targetPlayer, damage);
     arrow->Initialize(startPos, targetPlayer->GetPosition());
     arrows_.push_back(std::move(arrow));
 }
@@ -92,7 +93,7 @@ void ArrowManager::ShootAtPlayer(Individual* owner, Player* targetPlayer, const
 void ArrowManager::Update(float dt)
 {
     // 全矢を更新
-    for (std::unique_ptr<Arrow>& arrow : arrows_) {
+    for (PoolPtr<Arrow>& arrow : arrows_) {
         arrow->Update(dt);
     }
 
@@ -103,7 +104,7 @@ void ArrowManager::Update(float dt)
 //----------------------------------------------------------------------------
 void ArrowManager::Render(SpriteBatch& spriteBatch)
 {
-    for (std::unique_ptr<Arrow>& arrow : arrows_) {
+    for (PoolPtr<Arrow>& arrow : arrows_) {
         arrow->Render(spriteBatch);
     }
 }
@@ -119,7 +120,7 @@ void ArrowManager::RemoveInactiveArrows()
 {
     arrows_.erase(
         std::remove_if(arrows_.begin(), arrows_.end(),
-            [](const std::unique_ptr<Arrow>& arrow) {
+            [](const PoolPtr<Arrow>& arrow) {
                 return !arrow->IsActive();
             }),
         arrows_.end()
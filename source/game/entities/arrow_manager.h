@@ -5,6 +5,7 @@
 #pragma once
 
 #include "arrow.h"
+#include "common/utility/object_pool.h"
 #include <vector>
 #include <memory>
 #include <cassert>
@@ -70,5 +71,5 @@ private:
 
     static inline std::unique_ptr<ArrowManager> instance_ = nullptr;
 
-    std::vector<std::unique_ptr<Arrow>> arrows_;
+    std::vector<PoolPtr<Arrow>> arrows_;  //!< EntityPoolsから確保
 };
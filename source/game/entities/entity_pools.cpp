@@ -0,0 +1,61 @@
+//----------------------------------------------------------------------------
+//! @file   entity_pools.cpp
+//! @brief  エンティティ用オブジェクトプール実装
+//----------------------------------------------------------------------------
+#include "entity_pools.h"
+#include "common/logging/logging.h"
+#include <string>
+
+namespace {
+    //! @brief 1プール分の統計を1行にまとめる
+    std::string FormatStats(const char* name, const PoolStats& stats)
+    {
+        return std::string("  ") + name +
+            ": live " + std::to_string(stats.live) +
+            " / cap " + std::to_string(stats.capacity) +
+            ", peak " + std::to_string(stats.peak) +
+            ", create " + std::to_string(stats.creates) +
+            ", release " + std::to_string(stats.releases) +
+            ", block alloc " + std::to_string(stats.blockAllocations);
+    }
+}
+
+//----------------------------------------------------------------------------
+EntityPools& EntityPools::Get()
+{
+    assert(instance_ && "EntityPools::Create() not called");
+    return *instance_;
+}
+
+//----------------------------------------------------------------------------
+void EntityPools::Create()
+{
+    if (!instance_) {
+        instance_.reset(new EntityPools());
+    }
+}
+
+//----------------------------------------------------------------------------
+void EntityPools::Destroy()
+{
+    instance_.reset();
+}
+
+//----------------------------------------------------------------------------
+void EntityPools::ReportWave(int wave)
+{
+    LOG_INFO("[EntityPools] Wave " + std::to_string(wave) + " pool stats:");
+    LOG_INFO(FormatStats("Group", groups_.GetStats()));
+    LOG_INFO(FormatStats("Individual", individuals_.GetStats()));
+    LOG_INFO(FormatStats("StateMachine", stateMachines_.GetStats()));
+    LOG_INFO(FormatStats("GameObject", gameObjects_.GetStats()));
+    LOG_INFO(FormatStats("Arrow", arrows_.GetStats()));
+    LOG_INFO(FormatStats("Bond", bonds_.GetStats()));
+
+    groups_.ResetCounters();
+    individuals_.ResetCounters();
+    stateMachines_.ResetCounters();
+    gameObjects_.ResetCounters();
+    arrows_.ResetCounters();
+    bonds_.ResetCounters();
+}
@@ -0,0 +1,110 @@
+//----------------------------------------------------------------------------
+//! @file   entity_pools.h
+//! @brief  エンティティ用オブジェクトプール - Group/Individual/Arrow/Bondとその付属物
+//!
+//! @details
+//! スポーン・死亡・発射・縁の作成のたびに発生していた個別のヒープ確保を、
+//! 型ごとのObjectPool（固定長ブロック＋フリーリスト）からの割り当てに置き換える。
+//! ElfとKnightは同じIndividualプールに置き、ハンドルはPoolHandle<Individual>で共通にする。
+//!
+//! ReportWave()でウェーブごとの使用数・ピーク・生成/解放回数・ブロック確保回数をログ出力する。
+//----------------------------------------------------------------------------
+#pragma once
+
+#include "common/utility/object_pool.h"
+#include "elf.h"
+#include "knight.h"
+#include "group.h"
+#include "arrow.h"
+#include "game/bond/bond.h"
+#include "game/systems/animation/individual_state_machine.h"
+#include "engine/component/game_object.h"
+#include <algorithm>
+#include <memory>
+#include <cassert>
+
+//! @brief 個体（Elf/Knight）のハンドル
+using IndividualHandle = PoolHandle<Individual>;
+
+//----------------------------------------------------------------------------
+//! @brief エンティティプール（シングルトン）
+//! @note GroupManager/BondManager/ArrowManagerより先に生成し、後に破棄すること
+//----------------------------------------------------------------------------
+class EntityPools
+{
+public:
+    //! @brief 個体スロットのサイズ（派生型の最大値）
+    static constexpr size_t kIndividualSlotSize = (std::max)(sizeof(Elf), sizeof(Knight));
+
+    //! @brief 個体スロットのアラインメント（派生型の最大値）
+    static constexpr size_t kIndividualSlotAlign = (std::max)(alignof(Elf), alignof(Knight));
+
+    using GameObjectPool = ObjectPool<GameObject>;
+    using StateMachinePool = ObjectPool<IndividualStateMachine>;
+    using IndividualPool = ObjectPool<Individual, kIndividualSlotSize, kIndividualSlotAlign>;
+    using GroupPool = ObjectPool<Group, sizeof(Group), alignof(Group), 16>;
+    using ArrowPool = ObjectPool<Arrow>;
+    using BondPool = ObjectPool<Bond, sizeof(Bond), alignof(Bond), 32>;
+
+    //! @brief シングルトンインスタンス取得
+    static EntityPools& Get();
+
+    //! @brief インスタンス生成
+    static void Create();
+
+    //! @brief インスタンス破棄
+    static void Destroy();
+
+    //! @brief デストラクタ
+    ~EntityPools() = default;
+
+    //------------------------------------------------------------------------
+    // プール
+    //------------------------------------------------------------------------
+
+    [[nodiscard]] GameObjectPool& GameObjects() { return gameObjects_; }
+    [[nodiscard]] StateMachinePool& StateMachines() { return stateMachines_; }
+    [[nodiscard]] IndividualPool& Individuals() { return individuals_; }
+    [[nodiscard]] GroupPool& Groups() { return groups_; }
+    [[nodiscard]] ArrowPool& Arrows() { return arrows_; }
+    [[nodiscard]] BondPool& Bonds() { return bonds_; }
+
+    //------------------------------------------------------------------------
+    // 個体ハンドル
+    //------------------------------------------------------------------------
+
+    //! @brief 個体のハンドルを取得（プール外の個体なら無効なハンドル）
+    [[nodiscard]] IndividualHandle GetHandle(const Individual* individual) const
+    {
+        return individuals_.HandleOf(individual);
+    }
+
+    //! @brief ハンドルから個体を取得（解放済みならnullptr）
+    [[nodiscard]] Individual* Resolve(IndividualHandle handle) const
+    {
+        return individuals_.Get(handle);
+    }
+
+    //------------------------------------------------------------------------
+    // 統計
+    //------------------------------------------------------------------------
+
+    //! @brief ウェーブ中のプール統計をログ出力し、回数カウンタをリセット
+    //! @param wave ウェーブ番号（1始まり）
+    void ReportWave(int wave);
+
+private:
+    EntityPools() = default;
+    EntityPools(const EntityPools&) = delete;
+    EntityPools& operator=(const EntityPools&) = delete;
+
+    static inline std::unique_ptr<EntityPools> instance_ = nullptr;
+
+    // 破棄はメンバの逆順。所有する側（Group→Individual→GameObject等）を後に宣言する
+    GameObjectPool gameObjects_;      //!< Individual/ArrowのGameObject
+    StateMachinePool stateMachines_;  //!< IndividualのStateMachine
+    BondPool bonds_;                  //!< 縁
+    IndividualPool individuals_;      //!< 個体（Elf/Knight）
+    ArrowPool arrows_;                //!< 矢
+    GroupPool groups_;                //!< グループ
+};
@@ -9,6 +9,7 @@
 #include "game/systems/event/game_events.h"
 #include "game/bond/bond_manager.h"
 #include "game/bond/bond.h"
+#include "game/systems/group_manager.h"
 #include "engine/c_systems/sprite_batch.h"
 #include "common/logging/logging.h"
 #include <random>
@@ -19,8 +20,9 @@
 Group::Group(const std::string& id)
     : id_(id)
 {
-    // IndividualDiedEventを購読（所属個体死亡時にFormation再構築）
-    individualDiedSubscriptionId_ = EventBus::Get().Subscribe<IndividualDiedEvent>(
+    // 自グループの個体のIndividualDiedEventのみ購読（所属個体死亡時にFormation再構築）
+    individualDiedSubscriptionId_ = EventBus::Get().SubscribeKeyed<IndividualDiedEvent>(
+        this,
         [this](const IndividualDiedEvent& e) {
             OnIndividualDied(e.individual, e.ownerGroup);
         });
@@ -41,7 +43,7 @@ void Group::Initialize(const Vector2& centerPosition)
     }
 
     // Formationを初期化
-    std::vector<Individual*> individuals = GetAliveIndividuals();
+    std::span<Individual* const> individuals = GetAliveIndividuals();
 
     if (individuals.empty()) {
         LOG_WARN("[Group] BUG: Initialize called but all individuals are dead: " + id_);
@@ -68,6 +70,7 @@ void Group::Shutdown()
         individualDiedSubscriptionId_ = 0;
     }
 
+    alive_.clear();
     individuals_.clear();
     isDefeated_ = false;
 }
@@ -78,23 +81,17 @@ void Group::Update(float dt)
     // 硬直中は移動しない（速度をリセット）
     bool isStaggered = StaggerSystem::Get().IsStaggered(this);
     if (isStaggered) {
-        for (std::unique_ptr<Individual>& individual : individuals_) {
+        for (PoolPtr<Individual>& individual : individuals_) {
             if (individual && individual->IsAlive()) {
                 individual->SetDesiredVelocity(Vector2(0.0f, 0.0f));
             }
         }
     }
 
-    // 生存個体リストを取得（分離計算用）
-    std::vector<Individual*> aliveIndividuals = GetAliveIndividuals();
-
-    // 分離オフセット計算（位置更新前に全個体分を計算）
-    for (Individual* individual : aliveIndividuals) {
-        individual->CalculateSeparation(aliveIndividuals);
-    }
+    // 分離オフセットはSeparationGrid::ComputeSeparation()で全グループ分を計算済み
 
     // 全個体を更新
-    for (std::unique_ptr<Individual>& individual : individuals_) {
+    for (PoolPtr<Individual>& individual : individuals_) {
         if (individual && individual->IsAlive()) {
             individual->Update(dt);
         }
@@ -108,7 +105,7 @@ void Group::Update(float dt)
 void Group::Render(SpriteBatch& spriteBatch)
 {
     // 全個体を描画
-    for (std::unique_ptr<Individual>& individual : individuals_) {
+    for (PoolPtr<Individual>& individual : individuals_) {
         if (individual && individual->IsAlive()) {
             individual->Render(spriteBatch);
         }
@@ -116,7 +113,7 @@ void Group::Render(SpriteBatch& spriteBatch)
 }
 
 //----------------------------------------------------------------------------
-void Group::AddIndividual(std::unique_ptr<Individual> individual)
+void Group::AddIndividual(PoolPtr<Individual> individual)
 {
     if (!individual) {
         LOG_WARN("[Group] BUG: AddIndividual called with null individual");
@@ -129,66 +126,45 @@ void Group::AddIndividual(std::unique_ptr<Individual> individual)
     }
 
     individual->SetOwnerGroup(this);
+    individual->groupAliveIndex_ = static_cast<uint32_t>(alive_.size());
+    alive_.push_back(individual.get());
+    if (IsRegistered()) {
+        GroupManager::Get().TrackAlive(individual.get());
+    }
     individuals_.push_back(std::move(individual));
 
     LOG_INFO("[Group] " + id_ + " added individual, count: " + std::to_string(individuals_.size()));
 }
 
-//----------------------------------------------------------------------------
-std::vector<Individual*> Group::GetAliveIndividuals() const
-{
-    std::vector<Individual*> alive;
-    for (const std::unique_ptr<Individual>& individual : individuals_) {
-        if (individual && individual->IsAlive()) {
-            alive.push_back(individual.get());
-        }
-    }
-    return alive;
-}
-
 //----------------------------------------------------------------------------
 Individual* Group::GetRandomAliveIndividual() const
 {
-    std::vector<Individual*> alive = GetAliveIndividuals();
-    if (alive.empty()) return nullptr;
+    if (alive_.empty()) return nullptr;
 
     // ランダムに選択
     std::random_device rd;
     std::mt19937 gen(rd());
-    std::uniform_int_distribution<size_t> dist(0, alive.size() - 1);
+    std::uniform_int_distribution<size_t> dist(0, alive_.size() - 1);
 
-    return alive[dist(gen)];
-}
-
-//----------------------------------------------------------------------------
-size_t Group::GetAliveCount() const
-{
-    size_t count = 0;
-    for (const std::unique_ptr<Individual>& individual : individuals_) {
-        if (individual && individual->IsAlive()) {
-            ++count;
-        }
-    }
-    return count;
+    return alive_[dist(gen)];
 }
 
 //----------------------------------------------------------------------------
 Vector2 Group::GetPosition() const
 {
-    std::vector<Individual*> alive = GetAliveIndividuals();
-    if (alive.empty()) {
+    if (alive_.empty()) {
         return Vector2::Zero;
     }
 
     // 全生存個体の平均位置を計算
     Vector2 sum = Vector2::Zero;
-    for (Individual* individual : alive) {
+    for (Individual* individual : alive_) {
         Vector2 pos = individual->GetPosition();
         sum.x += pos.x;
         sum.y += pos.y;
     }
 
-    float count = static_cast<float>(alive.size());
+    float count = static_cast<float>(alive_.size());
     return Vector2(sum.x / count, sum.y / count);
 }
 
@@ -203,7 +179,7 @@ void Group::SetPosition(const Vector2& position)
     Vector2 delta = Vector2(targetPos.x - currentCenter.x, targetPos.y - currentCenter.y);
 
     // 全個体を相対移動
-    for (std::unique_ptr<Individual>& individual : individuals_) {
+    for (PoolPtr<Individual>& individual : individuals_) {
         if (individual && individual->IsAlive()) {
             Vector2 pos = individual->GetPosition();
             individual->SetPosition(Vector2(pos.x + delta.x, pos.y + delta.y));
@@ -220,7 +196,7 @@ float Group::GetHpRatio() const
     float totalHp = 0.0f;
     float totalMaxHp = 0.0f;
 
-    for (const std::unique_ptr<Individual>& individual : individuals_) {
+    for (const PoolPtr<Individual>& individual : individuals_) {
         if (individual) {
             totalHp += individual->GetHp();
             totalMaxHp += individual->GetMaxHp();
@@ -254,7 +230,7 @@ void Group::SetThreatModifier(float modifier)
 float Group::GetMaxAttackRange() const
 {
     float maxRange = 0.0f;
-    for (const std::unique_ptr<Individual>& individual : individuals_) {
+    for (const PoolPtr<Individual>& individual : individuals_) {
         if (individual && individual->IsAlive()) {
             float range = individual->GetAttackRange();
             if (range > maxRange) {
@@ -268,8 +244,7 @@ float Group::GetMaxAttackRange() const
 //----------------------------------------------------------------------------
 void Group::RebuildFormation()
 {
-    std::vector<Individual*> alive = GetAliveIndividuals();
-    formation_.Rebuild(alive);
+    formation_.Rebuild(alive_);
 }
 
 //----------------------------------------------------------------------------
@@ -336,13 +311,33 @@ void Group::CheckDefeated()
 }
 
 //----------------------------------------------------------------------------
-void Group::OnIndividualDied([[maybe_unused]] Individual* individual, Group* ownerGroup)
+void Group::OnIndividualDied(Individual* individual, Group* ownerGroup)
 {
     // nullチェック + 自分のグループの個体が死亡した場合のみ処理
-    if (ownerGroup == nullptr || ownerGroup != this) return;
+    if (ownerGroup == nullptr || ownerGroup != this || individual == nullptr) return;
+
+    // 生存リストから外す（グループ内・全体とも）
+    RemoveAlive(individual);
+    if (IsRegistered()) {
+        GroupManager::Get().UntrackAlive(individual);
+    }
 
     LOG_INFO("[Group] " + id_ + " individual died, rebuilding formation");
 
     // Formationを再構築
     RebuildFormation();
 }
+
+//----------------------------------------------------------------------------
+void Group::RemoveAlive(Individual* individual)
+{
+    const uint32_t index = individual->groupAliveIndex_;
+    if (index >= alive_.size() || alive_[index] != individual) return;
+
+    // 末尾の個体を空いた位置へ移す
+    Individual* last = alive_.back();
+    alive_[index] = last;
+    last->groupAliveIndex_ = index;
+    alive_.pop_back();
+    individual->groupAliveIndex_ = Individual::kNotInAliveList;
+}
@@ -5,9 +5,11 @@
 #pragma once
 
 #include "individual.h"
+#include "common/utility/object_pool.h"
 #include "game/systems/movement/formation.h"
 #include <memory>
 #include <vector>
+#include <span>
 #include <string>
 #include <functional>
 
@@ -62,12 +64,14 @@ public:
     //------------------------------------------------------------------------
 
     //! @brief 個体を追加
-    //! @param individual 追加する個体（所有権を移譲）
-    void AddIndividual(std::unique_ptr<Individual> individual);
+    //! @param individual 追加する個体（所有権を移譲、EntityPoolsから確保したもの）
+    void AddIndividual(PoolPtr<Individual> individual);
 
-    //! @brief 生存個体リストを取得
-    //! @return 生存中の個体リスト
-    [[nodiscard]] std::vector<Individual*> GetAliveIndividuals() const;
+    //! @brief 生存個体リストを取得（コピーなし）
+    //! @return 生存中の個体（順不同）
+    //! @note 個体の死亡時にswap-removeで即座に更新される。
+    //!       走査中に同グループの個体が死亡しうる処理では、先にコピーしてから走査すること
+    [[nodiscard]] std::span<Individual* const> GetAliveIndividuals() const { return alive_; }
 
     //! @brief ランダムな生存個体を取得
     //! @return ランダムに選ばれた生存個体（全滅時はnullptr）
@@ -77,7 +81,7 @@ public:
     [[nodiscard]] size_t GetIndividualCount() const { return individuals_.size(); }
 
     //! @brief 生存個体数を取得
-    [[nodiscard]] size_t GetAliveCount() const;
+    [[nodiscard]] size_t GetAliveCount() const { return alive_.size(); }
 
     //------------------------------------------------------------------------
     // 位置・状態
@@ -132,8 +136,17 @@ public:
     //! @brief ID取得
     [[nodiscard]] const std::string& GetId() const { return id_; }
 
+    //! @brief 未登録を示す密なID
+    static constexpr uint32_t kInvalidDenseId = UINT32_MAX;
+
+    //! @brief 密なID取得（GroupManager登録中のみ有効、0始まりで解放後は再利用される）
+    [[nodiscard]] uint32_t GetDenseId() const { return denseId_; }
+
+    //! @brief GroupManagerに登録済みか
+    [[nodiscard]] bool IsRegistered() const { return denseId_ != kInvalidDenseId; }
+
     //! @brief 全個体へのアクセス（読み取り専用）
-    [[nodiscard]] const std::vector<std::unique_ptr<Individual>>& GetIndividuals() const { return individuals_; }
+    [[nodiscard]] const std::vector<PoolPtr<Individual>>& GetIndividuals() const { return individuals_; }
 
     //! @brief グループ内の最大攻撃範囲を取得
     [[nodiscard]] float GetMaxAttackRange() const;
@@ -198,13 +211,17 @@ private:
     void CheckDefeated();
 
     //! @brief 個体死亡イベントハンドラ
-    void OnIndividualDied([[maybe_unused]] Individual* individual, Group* ownerGroup);
+    void OnIndividualDied(Individual* individual, Group* ownerGroup);
+
+    //! @brief 生存リストから外す（swap-remove）
+    void RemoveAlive(Individual* individual);
 
     // 識別
     std::string id_;
 
     // 個体リスト
-    std::vector<std::unique_ptr<Individual>> individuals_;
+    std::vector<PoolPtr<Individual>> individuals_;
+    std::vector<Individual*> alive_;   //!< 生存個体（individuals_の部分集合、順不同）
 
     // 脅威度
     float baseThreat_ = 100.0f;
@@ -225,6 +242,10 @@ private:
     // AI参照（外部で管理）
     GroupAI* ai_ = nullptr;
 
+    // GroupManagerが割り当てる密なID（未登録ならkInvalidDenseId）
+    uint32_t denseId_ = kInvalidDenseId;
+    friend class GroupManager;
+
     //! @brief IndividualDiedEventの購読ID
     uint32_t individualDiedSubscriptionId_ = 0;
 
@@ -4,6 +4,7 @@
 //----------------------------------------------------------------------------
 #include "individual.h"
 #include "group.h"
+#include "entity_pools.h"
 #include "player.h"
 #include "game/ai/group_ai.h"
 #include "game/systems/bind_system.h"
@@ -15,6 +16,7 @@
 #include "game/systems/game_constants.h"
 #include "game/relationships/relationship_facade.h"
 #include "game/systems/movement/formation.h"
+#include "game/systems/movement/separation_grid.h"
 #include "game/bond/bondable_entity.h"
 #include "game/systems/animation/anim_state.h"
 #include "game/systems/animation/animation_decision_context.h"
@@ -63,8 +65,15 @@ Individual::~Individual()
 //----------------------------------------------------------------------------
 void Individual::Initialize(const Vector2& position)
 {
-    // GameObject作成
-    gameObject_ = std::make_unique<GameObject>(id_);
+    // GameObject作成（アニメーション有無でアーキタイプを分ける）
+    EntityPools& pools = EntityPools::Get();
+    if (animRows_ > 1 || animCols_ > 1) {
+        gameObject_ = pools.GameObjects().Create(id_,
+            ComponentLayout<Transform, SpriteRenderer, Animator, Collider2D>{});
+    } else {
+        gameObject_ = pools.GameObjects().Create(id_,
+            ComponentLayout<Transform, SpriteRenderer, Collider2D>{});
+    }
 
     // Transform
     transform_ = gameObject_->AddComponent<Transform>();
@@ -83,7 +92,7 @@ void Individual::Initialize(const Vector2& position)
     }
 
     // StateMachine
-    stateMachine_ = std::make_unique<IndividualStateMachine>(this, animator_);
+    stateMachine_ = pools.StateMachines().Create(this, animator_);
     SetupStateMachine();
 
     // Collider
@@ -234,7 +243,7 @@ void Individual::TakeDamage(float damage)
         LOG_INFO("[Individual] " + id_ + " died");
 
         // 死亡イベント発行
-        EventBus::Get().Publish(IndividualDiedEvent{ this });
+        EventBus::Get().Publish(IndividualDiedEvent{ this, ownerGroup_ });
     }
 }
 
@@ -321,7 +330,7 @@ void Individual::SetupCollider()
 }
 
 //----------------------------------------------------------------------------
-void Individual::CalculateSeparation(const std::vector<Individual*>& others)
+void Individual::CalculateSeparation(const SeparationGrid& grid)
 {
     separationOffset_ = Vector2::Zero;
 
@@ -329,10 +338,10 @@ void Individual::CalculateSeparation(const std::vector<Individual*>& others)
 
     Vector2 myPos = GetPosition();
 
-    for (Individual* other : others) {
-        if (!other || other == this || !other->IsAlive()) continue;
+    // グリッドには生存個体のみ登録済み（位置はBuild()時点のスナップショット）
+    grid.ForEachNear(myPos, separationRadius_, [&](Individual* other, const Vector2& otherPos) {
+        if (other == this) return;
 
-        Vector2 otherPos = other->GetPosition();
         Vector2 diff = Vector2(myPos.x - otherPos.x, myPos.y - otherPos.y);
         float distance = diff.Length();
 
@@ -344,7 +353,7 @@ void Individual::CalculateSeparation(const std::vector<Individual*>& others)
             separationOffset_.x += diff.x * strength * separationForce_;
             separationOffset_.y += diff.y * strength * separationForce_;
         }
-    }
+    });
 }
 
 //----------------------------------------------------------------------------
@@ -10,6 +10,7 @@
 #include "engine/component/animator.h"
 #include "engine/component/collider2d.h"
 #include "engine/texture/texture_types.h"
+#include "common/utility/object_pool.h"
 #include "game/systems/animation/individual_state_machine.h"
 #include "game/systems/animation/individual_intent.h"
 #include "game/systems/animation/animation_controller.h"  // AnimationState enum
@@ -22,6 +23,7 @@
 class Group;
 class Player;
 class SpriteBatch;
+class SeparationGrid;
 struct AnimationDecisionContext;
 
 //----------------------------------------------------------------------------
@@ -219,9 +221,9 @@ public:
     //! @brief 分離オフセットを設定
     void SetSeparationOffset(const Vector2& offset) { separationOffset_ = offset; }
 
-    //! @brief 分離オフセットを計算（同グループ内の重なり回避）
-    //! @param others 同グループ内の他の個体
-    void CalculateSeparation(const std::vector<Individual*>& others);
+    //! @brief 分離オフセットを計算（グループを問わず近くの個体との重なり回避）
+    //! @param grid 今フレーム構築済みの近傍グリッド
+    void CalculateSeparation(const SeparationGrid& grid);
 
     //! @brief 分離半径を取得
     [[nodiscard]] float GetSeparationRadius() const { return separationRadius_; }
@@ -303,7 +305,7 @@ protected:
     std::string id_;
 
     // GameObject & コンポーネント
-    std::unique_ptr<GameObject> gameObject_;
+    PoolPtr<GameObject> gameObject_;           //!< EntityPoolsから確保
     Transform* transform_ = nullptr;
     SpriteRenderer* sprite_ = nullptr;
     Animator* animator_ = nullptr;
@@ -351,10 +353,21 @@ protected:
     int animFrameInterval_ = 6;
 
     // StateMachine
-    std::unique_ptr<IndividualStateMachine> stateMachine_;
+    PoolPtr<IndividualStateMachine> stateMachine_;  //!< EntityPoolsから確保
 
 #ifdef _DEBUG
     // デバッグログ用カウンター（const関数内で使用するためmutable）
     mutable int debugLogCounter_ = 0;
 #endif
+
+private:
+    friend class Group;
+    friend class GroupManager;
+
+    //! @brief 生存リストに載っていないことを示す位置
+    static constexpr uint32_t kNotInAliveList = UINT32_MAX;
+
+    // 生存リスト内の位置（死亡時のswap-removeをO(1)にする）
+    uint32_t groupAliveIndex_ = kNotInAliveList;   //!< Group::alive_内の位置
+    uint32_t globalAliveIndex_ = kNotInAliveList;  //!< GroupManager::alive_内の位置
 };
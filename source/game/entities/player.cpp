@@ -33,7 +33,8 @@ void Player::Initialize(const Vector2& position)
     texture_ = TextureManager::Get().LoadTexture2D("player.png");
 
     // GameObject作成
-    gameObject_ = std::make_unique<GameObject>("Player");
+    gameObject_ = std::make_unique<GameObject>("Player",
+        ComponentLayout<Transform, SpriteRenderer, Collider2D>{});
 
     // Transform
     transform_ = gameObject_->AddComponent<Transform>();
@@ -14,6 +14,12 @@
 #include "common/logging/logging.h"
 #include "engine/scene/scene_manager.h"
 #include "engine/c_systems/collision_manager.h"
+#include "engine/component/component_storage.h"
+#include "engine/component/component_update_registry.h"
+#include "engine/component/transform_hierarchy.h"
+#include "engine/component/animator_pool.h"
+#include "engine/component/animator.h"
+#include "engine/component/collider2d.h"
 
 #include "scenes/title_scene.h"
 #include "scenes/test_scene.h"
@@ -26,6 +32,7 @@
 #include "engine/debug/circle_renderer.h"
 #include "engine/core/job_system.h"
 #include "engine/core/service_locator.h"
+#include "engine/event/event_bus.h"
 
 // シェーダーコンパイラ（グローバルインスタンス）
 static std::unique_ptr<D3DShaderCompiler> g_shaderCompiler;
@@ -46,6 +53,10 @@ bool Game::Initialize()
     RenderStateManager::Create();
     SpriteBatch::Create();
     CollisionManager::Create();
+    ComponentStorage::Create();
+    ComponentUpdateRegistry::Create();
+    AnimatorPool::Create();
+    TransformHierarchy::Create();
     SceneManager::Create();
 #ifdef _DEBUG
     DebugDraw::Create();
@@ -61,6 +72,10 @@ bool Game::Initialize()
     // 2. CollisionManager初期化（セルサイズはコライダーサイズの2倍が適切）
     CollisionManager::Get().Initialize(64);
 
+    // コンポーネント一括更新の登録（実行順: コライダー登録 → アニメーション）
+    ComponentUpdateRegistry::Get().Register<Collider2D, &Collider2D::SyncAll>(0);
+    ComponentUpdateRegistry::Get().Register<Animator, &Animator::UpdateAll>(10);
+
     // 3. ファイルシステムマウント
     LOG_INFO("[Game] Project root: " + PathUtility::toNarrowString(projectRoot));
     LOG_INFO("[Game] Assets root: " + PathUtility::toNarrowString(assetsRoot));
@@ -147,6 +162,10 @@ void Game::Shutdown() noexcept
     DebugDraw::Destroy();
 #endif
     SceneManager::Destroy();
+    TransformHierarchy::Destroy();
+    AnimatorPool::Destroy();
+    ComponentUpdateRegistry::Destroy();
+    ComponentStorage::Destroy();  // 格納中のGameObjectはシーンと共に破棄済み
     CollisionManager::Destroy();
     SpriteBatch::Destroy();
     RenderStateManager::Destroy();
@@ -168,6 +187,12 @@ void Game::Update()
         currentScene_->Update();
     }
 
+    // 型別のコンポーネント一括更新（シーン内の全GameObject::Update()の後）
+    ComponentUpdateRegistry::Get().Run();
+
+    // 親子階層のワールド変換を深さ順に一括更新（描画前）
+    TransformHierarchy::Get().Update();
+
     // メインスレッドジョブを処理
     JobSystem::Get().ProcessMainThreadJobs();
 }
@@ -186,5 +211,9 @@ void Game::EndFrame()
     // フレーム内ジョブの完了を待機
     JobSystem::Get().EndFrame();
 
+    // フレーム末尾の遅延イベント配信（購読スロットの回収・統計の集計もここで行う）
+    // ワーカーのPublishが解除済みスロットを辿らないよう、ジョブ完了待ちの後に行う
+    EventBus::Get().Dispatch(EventPhase::EndOfFrame);
+
     SceneManager::Get().ApplyPendingChange(currentScene_);
 }
@@ -48,6 +48,8 @@ uint32_t RelationshipGraph::AddEdge(const BondableEntity& a, const BondableEntit
     nodeEntities_[idA] = a;
     nodeEntities_[idB] = b;
 
+    ++revision_;
+
     LOG_INFO("[RelationshipGraph] Edge added: " + idA + " <-> " + idB +
              " (type=" + std::to_string(static_cast<int>(type)) + ")");
 
@@ -84,6 +86,7 @@ bool RelationshipGraph::RemoveEdge(uint32_t edgeId)
 
     // エッジ削除
     edges_.erase(it);
+    ++revision_;
 
     return true;
 }
@@ -126,6 +129,7 @@ void RelationshipGraph::Clear()
     typeIndex_.clear();
     nodeEntities_.clear();
     nextEdgeId_ = 1;
+    ++revision_;
     LOG_INFO("[RelationshipGraph] Cleared");
 }
 
@@ -99,6 +99,9 @@ public:
     //! @brief エッジ数を取得
     [[nodiscard]] size_t GetEdgeCount() const { return edges_.size(); }
 
+    //! @brief エッジの追加・削除のたびに進むカウンタ（キャッシュの無効化判定用）
+    [[nodiscard]] uint64_t GetRevision() const { return revision_; }
+
     //! @brief 全エッジを取得
     [[nodiscard]] std::vector<const EdgeData*> GetAllEdges() const;
 
@@ -137,6 +140,7 @@ private:
     Cluster BFS(const std::string& startId, BondType* filterType) const;
 
     uint32_t nextEdgeId_ = 1;  //!< 次のエッジID
+    uint64_t revision_ = 0;    //!< 変更カウンタ
 
     //! @brief 全エッジ（ID→データ）
     std::unordered_map<uint32_t, EdgeData> edges_;
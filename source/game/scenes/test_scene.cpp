@@ -21,6 +21,7 @@
 // ゲームシステム
 #include "game/entities/elf.h"
 #include "game/entities/knight.h"
+#include "game/entities/entity_pools.h"
 #include "game/entities/arrow_manager.h"
 #include "game/bond/bond_manager.h"
 #include "engine/time/time_manager.h"
@@ -34,6 +35,9 @@
 #include "game/systems/stagger_system.h"
 #include "game/systems/insulation_system.h"
 #include "game/systems/faction_manager.h"
+#include "game/systems/movement/separation_grid.h"
+#include "game/ai/group_target_index.h"
+#include "game/ai/ai_lod_controller.h"
 #include "engine/event/event_bus.h"
 #include "game/systems/event/game_events.h"
 #include "game/ui/radial_menu.h"
@@ -133,7 +137,7 @@ void TestScene::OnEnter()
     // 持ち越しグループを味方として復元
     const std::vector<CarryOverGroupData>& carryOverGroups = StageProgressManager::Get().GetCarryOverGroups();
     for (const CarryOverGroupData& data : carryOverGroups) {
-        std::unique_ptr<Group> group = std::make_unique<Group>(data.id);
+        PoolPtr<Group> group = EntityPools::Get().Groups().Create(data.id);
         group->SetBaseThreat(data.threat);
         group->SetDetectionRange(300.0f);  // デフォルト値
         group->SetFaction(GroupFaction::Ally);  // 味方として設定
@@ -143,7 +147,7 @@ void TestScene::OnEnter()
 
         // 個体を復元
         for (int i = 0; i < data.aliveCount; ++i) {
-            std::unique_ptr<Knight> knight = std::make_unique<Knight>(data.id + "_K" + std::to_string(i));
+            PoolPtr<Knight> knight = EntityPools::Get().Individuals().Create<Knight>(data.id + "_K" + std::to_string(i));
             knight->Initialize(groupCenter);
             knight->SetColor(Color(0.3f, 0.8f, 1.0f, 1.0f));  // 味方色（シアン）
             knight->SetMaxHp(data.aliveCount > 0 ? data.totalHp / data.aliveCount : data.totalHp);
@@ -247,7 +251,7 @@ void TestScene::OnEnter()
             if (!group || group->IsDefeated()) continue;
             if (!group->IsAlly()) continue;  // 味方のみ
 
-            const std::vector<Individual*>& aliveMembers = group->GetAliveIndividuals();
+            std::span<Individual* const> aliveMembers = group->GetAliveIndividuals();
             CarryOverGroupData data;
             data.id = group->GetId();
             data.aliveCount = static_cast<int>(aliveMembers.size());
@@ -487,6 +491,12 @@ void TestScene::Update()
 
     // AI更新（時間停止中は動かない）
     if (!TimeManager::Get().IsFrozen()) {
+        // 全グループのターゲット検索を先にまとめて解決
+        GroupTargetIndex::Get().Build();
+        AILodController::Get().BeginFrame(camera_);
+
+        // 判断フェーズ（読み取り専用、並列）→ 適用フェーズ（状態変更・イベント発行、直列）
+        GroupAI::DecideAll(groupAIs_);
         for (std::unique_ptr<GroupAI>& ai : groupAIs_) {
             ai->Update(dt);
         }
@@ -499,7 +509,10 @@ void TestScene::Update()
         }
     }
 
-    // グループ更新
+    // グループ更新（分離用の近傍グリッドを構築し、全個体の分離オフセットを先に並列計算）
+    SeparationGrid& separationGrid = SeparationGrid::Get();
+    separationGrid.Build();
+    separationGrid.ComputeSeparation();
     for (const auto& group : GroupManager::Get().GetAllGroups()) {
         group->Update(dt);
     }
@@ -512,6 +525,9 @@ void TestScene::Update()
     // 硬直システム更新
     StaggerSystem::Get().Update(dt);
 
+    // ゲームロジック直後の遅延イベント配信
+    EventBus::Get().Dispatch(EventPhase::PostUpdate);
+
     // 矢の更新（時間停止中も飛び続ける）
     ArrowManager::Get().Update(rawDt);
 
@@ -654,8 +670,8 @@ void TestScene::HandleInput(float /*dt*/)
         Collider2D* playerCollider = player_->GetCollider();
         Bond* bondToCut = nullptr;
 
-        const std::vector<std::unique_ptr<Bond>>& bonds = BondManager::Get().GetAllBonds();
-        for (const std::unique_ptr<Bond>& bond : bonds) {
+        const std::vector<PoolPtr<Bond>>& bonds = BondManager::Get().GetAllBonds();
+        for (const PoolPtr<Bond>& bond : bonds) {
             Vector2 posA = BondableHelper::GetPosition(bond->GetEntityA());
             Vector2 posB = BondableHelper::GetPosition(bond->GetEntityB());
 
@@ -751,7 +767,7 @@ Group* TestScene::SpawnGroup(const GroupData& gd)
         return 0;
     };
 
-    std::unique_ptr<Group> group = std::make_unique<Group>(gd.id);
+    PoolPtr<Group> group = EntityPools::Get().Groups().Create(gd.id);
     group->SetBaseThreat(gd.threat);
     group->SetDetectionRange(gd.detectionRange);
 
@@ -762,14 +778,14 @@ Group* TestScene::SpawnGroup(const GroupData& gd)
     // 個体追加
     for (int i = 0; i < gd.count; ++i) {
         if (gd.species == "Elf") {
-            std::unique_ptr<Elf> elf = std::make_unique<Elf>(gd.id + "_E" + std::to_string(i));
+            PoolPtr<Elf> elf = EntityPools::Get().Individuals().Create<Elf>(gd.id + "_E" + std::to_string(i));
             elf->Initialize(groupCenter);
             elf->SetMaxHp(gd.hp);
             elf->SetAttackDamage(gd.attack);
             elf->SetMoveSpeed(gd.speed);
             group->AddIndividual(std::move(elf));
         } else if (gd.species == "Knight") {
-            std::unique_ptr<Knight> knight = std::make_unique<Knight>(gd.id + "_K" + std::to_string(i));
+            PoolPtr<Knight> knight = EntityPools::Get().Individuals().Create<Knight>(gd.id + "_K" + std::to_string(i));
             knight->Initialize(groupCenter);
             knight->SetColor(factionColor);
             knight->SetMaxHp(gd.hp);
@@ -1030,14 +1046,14 @@ void TestScene::DrawBondTexture(const Vector2& posA, const Vector2& posB, Textur
 //----------------------------------------------------------------------------
 void TestScene::DrawBonds()
 {
-    const std::vector<std::unique_ptr<Bond>>& bonds = BondManager::Get().GetAllBonds();
+    const std::vector<PoolPtr<Bond>>& bonds = BondManager::Get().GetAllBonds();
 
     static int logCounter = 0;
     if (++logCounter % 60 == 1) {  // 1秒に1回ログ
         LOG_DEBUG("[DrawBonds] Bond count: " + std::to_string(bonds.size()));
     }
 
-    for (const std::unique_ptr<Bond>& bond : bonds) {
+    for (const PoolPtr<Bond>& bond : bonds) {
         // 全滅したグループの縁は描画しない
         if (Group* groupA = BondableHelper::AsGroup(bond->GetEntityA())) {
             if (groupA->IsDefeated()) continue;
@@ -1300,6 +1316,11 @@ void TestScene::LogAIStatus()
 
     // 縁の数
     LOG_INFO("  Bonds: " + std::to_string(BondManager::Get().GetAllBonds().size()));
+
+    // 今フレームのAI思考回数
+    const AILodController& lod = AILodController::Get();
+    LOG_INFO("  AI thinks/frame: " + std::to_string(lod.GetThinkCount()) +
+             " (deferred " + std::to_string(lod.GetDeferredCount()) + ")");
 }
 
 //----------------------------------------------------------------------------
@@ -9,7 +9,7 @@
 #include "game/entities/group.h"
 #include "game/entities/individual.h"
 #include "game/entities/player.h"
-#include "game/relationships/relationship_facade.h"
+#include "hostility_matrix.h"
 #include "engine/event/event_bus.h"
 #include "game/systems/event/game_events.h"
 #include "common/logging/logging.h"
@@ -155,15 +155,24 @@ Group* CombatSystem::SelectTarget(Group* attacker, const std::vector<Group*>& ca
 {
     if (!attacker) return nullptr;
 
+    if (!attacker->IsRegistered()) return nullptr;
+
     Group* bestTarget = nullptr;
     float highestThreat = -1.0f;
     Vector2 attackerPos = attacker->GetPosition();
     float detectionRange = attacker->GetDetectionRange();
 
+    // 攻撃者の敵対ビット行（候補ごとの敵対判定は1ビットの読み出し）
+    std::span<const uint64_t> hostileRow = HostilityMatrix::Get().GetHostileRow(attacker->GetDenseId());
+
     // 渡されたスナップショットを使用（一貫性のため）
     for (Group* candidate : candidates) {
         if (!candidate || candidate == attacker) continue;
-        if (candidate->IsDefeated()) continue;
+        if (candidate->IsDefeated() || !candidate->IsRegistered()) continue;
+
+        // 縁で繋がっていたら攻撃しない（距離計算より先に判定）
+        const uint32_t candidateId = candidate->GetDenseId();
+        if (!((hostileRow[candidateId >> 6] >> (candidateId & 63)) & 1u)) continue;
 
         // 索敵範囲チェック
         Vector2 candidatePos = candidate->GetPosition();
@@ -171,9 +180,6 @@ Group* CombatSystem::SelectTarget(Group* attacker, const std::vector<Group*>& ca
 
         if (distance > detectionRange) continue;
 
-        // 縁で繋がっていたら攻撃しない
-        if (!AreHostile(attacker, candidate)) continue;
-
         // 脅威度で比較
         float threat = candidate->GetThreat();
         if (threat > highestThreat) {
@@ -204,16 +210,8 @@ bool CombatSystem::CanAttackPlayer(Group* attacker) const
 //----------------------------------------------------------------------------
 bool CombatSystem::AreHostile(Group* a, Group* b) const
 {
-    if (!a || !b) return false;
-
-    // 味方同士は敵対しない
-    if (a->IsAlly() && b->IsAlly()) return false;
-
-    // RelationshipFacadeで敵対判定（推移的接続を考慮）
-    BondableEntity entityA = a;
-    BondableEntity entityB = b;
-
-    return RelationshipFacade::Get().AreHostile(entityA, entityB);
+    // 味方同士でなく、縁で（推移的に）繋がっていなければ敵対（HostilityMatrixのキャッシュ）
+    return HostilityMatrix::Get().IsHostile(a, b);
 }
 
 //----------------------------------------------------------------------------
@@ -221,13 +219,8 @@ bool CombatSystem::IsHostileToPlayer(Group* group) const
 {
     if (!group || !player_) return false;
 
-    // 味方グループはプレイヤーに敵対しない
-    if (group->IsAlly()) return false;
-
-    BondableEntity groupEntity = group;
-    BondableEntity playerEntity = player_;
-
-    return RelationshipFacade::Get().AreHostile(groupEntity, playerEntity);
+    // 味方グループでなく、プレイヤーと縁で繋がっていなければ敵対（HostilityMatrixのキャッシュ）
+    return HostilityMatrix::Get().IsHostileToPlayer(group);
 }
 
 //----------------------------------------------------------------------------
@@ -101,12 +101,18 @@ struct IndividualDiedEvent
 {
     Individual* individual;
     Group* ownerGroup;
+
+    //! @brief キー付き購読のルーティングキー（所属グループ）
+    [[nodiscard]] const void* GetRoutingKey() const noexcept { return ownerGroup; }
 };
 
 //! @brief グループ全滅イベント
 struct GroupDefeatedEvent
 {
     Group* group;
+
+    //! @brief キー付き購読のルーティングキー（全滅したグループ）
+    [[nodiscard]] const void* GetRoutingKey() const noexcept { return group; }
 };
 
 //! @brief プレイヤー死亡イベント
@@ -148,7 +148,9 @@ void FriendsDamageSharing::ApplyDamageWithSharing(Individual* targetIndividual,
     for (Group* group : friendsCluster) {
         if (!group || group->IsDefeated()) continue;
 
-        std::vector<Individual*> aliveIndividuals = group->GetAliveIndividuals();
+        // 分配中に死亡した個体は生存リストから外れるため、走査用にコピーする
+        std::span<Individual* const> alive = group->GetAliveIndividuals();
+        std::vector<Individual*> aliveIndividuals(alive.begin(), alive.end());
         if (aliveIndividuals.empty()) continue;
 
         // グループ内で均等分配
@@ -8,7 +8,7 @@
 #include <algorithm>
 
 //----------------------------------------------------------------------------
-Group* GroupManager::AddGroup(std::unique_ptr<Group> group)
+Group* GroupManager::AddGroup(PoolPtr<Group> group)
 {
     if (!group) {
         LOG_WARN("[GroupManager] Attempted to add null group");
@@ -17,6 +17,14 @@ Group* GroupManager::AddGroup(std::unique_ptr<Group> group)
 
     Group* ptr = group.get();
     std::string id = ptr->GetId();
+
+    AssignDenseId(ptr);
+
+    // 登録前に追加された生存個体を全体の生存リストへ
+    for (Individual* individual : ptr->GetAliveIndividuals()) {
+        TrackAlive(individual);
+    }
+
     groups_.push_back(std::move(group));
 
     LOG_INFO("[GroupManager] Added group: " + id);
@@ -33,11 +41,17 @@ void GroupManager::RemoveGroup(Group* group)
 
     // グループを検索して削除
     auto it = std::find_if(groups_.begin(), groups_.end(),
-        [group](const std::unique_ptr<Group>& g) {
+        [group](const PoolPtr<Group>& g) {
             return g.get() == group;
         });
 
     if (it != groups_.end()) {
+        // 破棄される個体を全体の生存リストから外す
+        for (Individual* individual : group->GetAliveIndividuals()) {
+            UntrackAlive(individual);
+        }
+        ReleaseDenseId(group);
+
         std::string id = (*it)->GetId();
         groups_.erase(it);
         LOG_INFO("[GroupManager] Removed group: " + id);
@@ -48,6 +62,10 @@ void GroupManager::RemoveGroup(Group* group)
 void GroupManager::Clear()
 {
     waveAssignments_.clear();
+    aliveIndividuals_.clear();
+    denseGroups_.clear();
+    freeDenseIds_.clear();
+    ++membershipRevision_;
     groups_.clear();
     LOG_INFO("[GroupManager] All groups cleared");
 }
@@ -145,3 +163,51 @@ void GroupManager::ClearWaveAssignments()
 {
     waveAssignments_.clear();
 }
+
+//----------------------------------------------------------------------------
+void GroupManager::AssignDenseId(Group* group)
+{
+    if (freeDenseIds_.empty()) {
+        group->denseId_ = static_cast<uint32_t>(denseGroups_.size());
+        denseGroups_.push_back(group);
+    } else {
+        group->denseId_ = freeDenseIds_.back();
+        freeDenseIds_.pop_back();
+        denseGroups_[group->denseId_] = group;
+    }
+    ++membershipRevision_;
+}
+
+//----------------------------------------------------------------------------
+void GroupManager::ReleaseDenseId(Group* group)
+{
+    if (!group->IsRegistered()) return;
+
+    denseGroups_[group->denseId_] = nullptr;
+    freeDenseIds_.push_back(group->denseId_);
+    group->denseId_ = Group::kInvalidDenseId;
+    ++membershipRevision_;
+}
+
+//----------------------------------------------------------------------------
+void GroupManager::TrackAlive(Individual* individual)
+{
+    if (individual->globalAliveIndex_ != Individual::kNotInAliveList) return;
+
+    individual->globalAliveIndex_ = static_cast<uint32_t>(aliveIndividuals_.size());
+    aliveIndividuals_.push_back(individual);
+}
+
+//----------------------------------------------------------------------------
+void GroupManager::UntrackAlive(Individual* individual)
+{
+    const uint32_t index = individual->globalAliveIndex_;
+    if (index >= aliveIndividuals_.size() || aliveIndividuals_[index] != individual) return;
+
+    // 末尾の個体を空いた位置へ移す
+    Individual* last = aliveIndividuals_.back();
+    aliveIndividuals_[index] = last;
+    last->globalAliveIndex_ = index;
+    aliveIndividuals_.pop_back();
+    individual->globalAliveIndex_ = Individual::kNotInAliveList;
+}
@@ -6,6 +6,7 @@
 
 #include "game/entities/group.h"
 #include <memory>
+#include <span>
 #include <vector>
 #include <unordered_map>
 #include <string>
@@ -49,7 +50,7 @@ public:
     //! @brief グループを登録（所有権を移譲）
     //! @param group 追加するグループ
     //! @return 登録したグループへのポインタ
-    Group* AddGroup(std::unique_ptr<Group> group);
+    Group* AddGroup(PoolPtr<Group> group);
 
     //! @brief グループを削除
     //! @param group 削除するグループ
@@ -63,7 +64,7 @@ public:
     //------------------------------------------------------------------------
 
     //! @brief 全グループを取得（読み取り専用）
-    [[nodiscard]] const std::vector<std::unique_ptr<Group>>& GetAllGroups() const
+    [[nodiscard]] const std::vector<PoolPtr<Group>>& GetAllGroups() const
     {
         return groups_;
     }
@@ -77,6 +78,24 @@ public:
     //! @brief 生存中のグループのみ取得（!IsDefeated()）
     [[nodiscard]] std::vector<Group*> GetAliveGroups() const;
 
+    //! @brief 密なID→グループの表を取得
+    //! @return 添字がGroup::GetDenseId()。解放済みのIDはnullptr
+    [[nodiscard]] std::span<Group* const> GetDenseGroups() const
+    {
+        return denseGroups_;
+    }
+
+    //! @brief 登録グループの増減のたびに進むカウンタ（キャッシュの無効化判定用）
+    [[nodiscard]] uint64_t GetMembershipRevision() const { return membershipRevision_; }
+
+    //! @brief 登録済み全グループの生存個体を取得（コピーなし）
+    //! @return 生存中の個体（順不同）
+    //! @note Group::GetAliveIndividuals()と同じく、個体の死亡時にswap-removeで即座に更新される
+    [[nodiscard]] std::span<Individual* const> GetAliveIndividuals() const
+    {
+        return aliveIndividuals_;
+    }
+
     //! @brief IDでグループを検索
     //! @param id 検索するグループID
     //! @return 見つかったグループ、なければnullptr
@@ -109,12 +128,30 @@ public:
     void ClearWaveAssignments();
 
 private:
+    friend class Group;
+
     GroupManager() = default;
     GroupManager(const GroupManager&) = delete;
     GroupManager& operator=(const GroupManager&) = delete;
 
+    //! @brief 密なIDを割り当てる
+    void AssignDenseId(Group* group);
+
+    //! @brief 密なIDを解放する
+    void ReleaseDenseId(Group* group);
+
+    //! @brief 全体の生存リストに追加（Group::AddIndividual/AddGroupから）
+    void TrackAlive(Individual* individual);
+
+    //! @brief 全体の生存リストから外す（swap-remove、個体死亡/グループ削除時）
+    void UntrackAlive(Individual* individual);
+
     static inline std::unique_ptr<GroupManager> instance_ = nullptr;
 
-    std::vector<std::unique_ptr<Group>> groups_;          //!< 全グループ（所有権保持）
+    std::vector<PoolPtr<Group>> groups_;                  //!< 全グループ（所有権保持、EntityPoolsから確保）
     std::unordered_map<Group*, int> waveAssignments_;     //!< グループ→ウェーブ番号
+    std::vector<Individual*> aliveIndividuals_;           //!< 全グループの生存個体（順不同）
+    std::vector<Group*> denseGroups_;                     //!< 密なID→グループ（解放済みはnullptr）
+    std::vector<uint32_t> freeDenseIds_;                  //!< 再利用待ちの密なID
+    uint64_t membershipRevision_ = 0;                     //!< 登録グループの増減カウンタ
 };
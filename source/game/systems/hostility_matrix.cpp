@@ -0,0 +1,309 @@
+//----------------------------------------------------------------------------
+//! @file   hostility_matrix.cpp
+//! @brief  HostilityMatrix実装
+//----------------------------------------------------------------------------
+#include "hostility_matrix.h"
+#include "game/systems/group_manager.h"
+#include "game/entities/group.h"
+#include "game/relationships/relationship_facade.h"
+#include "engine/event/event_bus.h"
+#include "game/systems/event/game_events.h"
+#include <cassert>
+
+//----------------------------------------------------------------------------
+HostilityMatrix::HostilityMatrix()
+{
+    // 敵対関係が変わるイベントを購読（該当する行だけ更新）
+    bondCreatedSubscriptionId_ = EventBus::Get().Subscribe<BondCreatedEvent>(
+        [this](const BondCreatedEvent& e) {
+            OnBondCreated(e.entityA, e.entityB);
+        });
+    bondRemovedSubscriptionId_ = EventBus::Get().Subscribe<BondRemovedEvent>(
+        [this](const BondRemovedEvent& e) {
+            OnBondRemoved(e.entityA, e.entityB);
+        });
+    groupBecameAllySubscriptionId_ = EventBus::Get().Subscribe<GroupBecameAllyEvent>(
+        [this](const GroupBecameAllyEvent& e) {
+            OnGroupBecameAlly(e.group);
+        });
+}
+
+//----------------------------------------------------------------------------
+HostilityMatrix::~HostilityMatrix()
+{
+    // イベント購読を解除
+    if (bondCreatedSubscriptionId_ != 0) {
+        EventBus::Get().Unsubscribe<BondCreatedEvent>(bondCreatedSubscriptionId_);
+        bondCreatedSubscriptionId_ = 0;
+    }
+    if (bondRemovedSubscriptionId_ != 0) {
+        EventBus::Get().Unsubscribe<BondRemovedEvent>(bondRemovedSubscriptionId_);
+        bondRemovedSubscriptionId_ = 0;
+    }
+    if (groupBecameAllySubscriptionId_ != 0) {
+        EventBus::Get().Unsubscribe<GroupBecameAllyEvent>(groupBecameAllySubscriptionId_);
+        groupBecameAllySubscriptionId_ = 0;
+    }
+}
+
+//----------------------------------------------------------------------------
+HostilityMatrix& HostilityMatrix::Get()
+{
+    assert(instance_ && "HostilityMatrix::Create() not called");
+    return *instance_;
+}
+
+//----------------------------------------------------------------------------
+void HostilityMatrix::Create()
+{
+    if (!instance_) {
+        instance_.reset(new HostilityMatrix());
+    }
+}
+
+//----------------------------------------------------------------------------
+void HostilityMatrix::Destroy()
+{
+    instance_.reset();
+}
+
+//----------------------------------------------------------------------------
+bool HostilityMatrix::IsHostile(const Group* a, const Group* b)
+{
+    if (!a || !b) return false;
+    if (!a->IsRegistered() || !b->IsRegistered()) return false;
+
+    Refresh();
+    return TestBit(hostile_, BitIndex(a->GetDenseId(), b->GetDenseId()));
+}
+
+//----------------------------------------------------------------------------
+bool HostilityMatrix::IsHostileToPlayer(const Group* group)
+{
+    if (!group || !group->IsRegistered()) return false;
+
+    Refresh();
+    return TestBit(hostileToPlayer_, group->GetDenseId());
+}
+
+//----------------------------------------------------------------------------
+std::span<const uint64_t> HostilityMatrix::GetHostileRow(uint32_t denseId)
+{
+    Refresh();
+    if (denseId >= groupCount_) return {};
+    return std::span<const uint64_t>(hostile_.data() + static_cast<size_t>(denseId) * wordsPerRow_, wordsPerRow_);
+}
+
+//----------------------------------------------------------------------------
+void HostilityMatrix::Refresh()
+{
+    if (dirty_ ||
+        membershipRevision_ != GroupManager::Get().GetMembershipRevision() ||
+        graphRevision_ != RelationshipFacade::Get().GetGraph().GetRevision() ||
+        player_ != RelationshipFacade::Get().GetPlayer()) {
+        Rebuild();
+    }
+}
+
+//----------------------------------------------------------------------------
+void HostilityMatrix::Rebuild()
+{
+    const GroupManager& groupManager = GroupManager::Get();
+    const RelationshipFacade& facade = RelationshipFacade::Get();
+
+    std::span<Group* const> dense = groupManager.GetDenseGroups();
+    groups_.assign(dense.begin(), dense.end());
+    groupCount_ = groups_.size();
+    wordsPerRow_ = (groupCount_ + 63) / 64;
+
+    hostile_.assign(groupCount_ * wordsPerRow_, 0);
+    hostileToPlayer_.assign(wordsPerRow_, 0);
+    component_.assign(groupCount_, kNoComponent);
+    ally_.assign(groupCount_, 0);
+
+    denseIdOf_.clear();
+    for (uint32_t i = 0; i < groupCount_; ++i) {
+        if (!groups_[i]) continue;
+        denseIdOf_[groups_[i]] = i;
+        ally_[i] = groups_[i]->IsAlly() ? 1 : 0;
+    }
+
+    // 縁グラフの連結成分ごとに番号を振る（プレイヤーの成分から）
+    nextComponent_ = 0;
+    playerComponent_ = kNoComponent;
+    player_ = facade.GetPlayer();
+    if (player_) {
+        LabelComponent(BondableEntity(player_), nextComponent_++);
+    }
+    for (uint32_t i = 0; i < groupCount_; ++i) {
+        if (groups_[i] && component_[i] == kNoComponent) {
+            LabelComponent(BondableEntity(groups_[i]), nextComponent_++);
+        }
+    }
+
+    // 全行を計算（対称なので行のみ書けばよい）
+    for (uint32_t i = 0; i < groupCount_; ++i) {
+        for (uint32_t j = 0; j < groupCount_; ++j) {
+            if (ComputeHostile(i, j)) {
+                WriteBit(hostile_, BitIndex(i, j), true);
+            }
+        }
+        if (groups_[i] && !ally_[i] && component_[i] != playerComponent_) {
+            WriteBit(hostileToPlayer_, i, true);
+        }
+    }
+
+    graphRevision_ = facade.GetGraph().GetRevision();
+    membershipRevision_ = groupManager.GetMembershipRevision();
+    dirty_ = false;
+    ++rebuildCount_;
+}
+
+//----------------------------------------------------------------------------
+void HostilityMatrix::UpdateRow(uint32_t row)
+{
+    for (uint32_t j = 0; j < groupCount_; ++j) {
+        const bool hostile = ComputeHostile(row, j);
+        WriteBit(hostile_, BitIndex(row, j), hostile);
+        WriteBit(hostile_, BitIndex(j, row), hostile);
+    }
+    WriteBit(hostileToPlayer_, row,
+             groups_[row] && !ally_[row] && component_[row] != playerComponent_);
+    ++rowUpdateCount_;
+}
+
+//----------------------------------------------------------------------------
+bool HostilityMatrix::ComputeHostile(uint32_t i, uint32_t j) const
+{
+    if (i == j || !groups_[i] || !groups_[j]) return false;
+
+    // 味方同士は敵対しない
+    if (ally_[i] && ally_[j]) return false;
+
+    // 縁で（推移的に）繋がっていれば敵対しない
+    return component_[i] != component_[j];
+}
+
+//----------------------------------------------------------------------------
+void HostilityMatrix::LabelComponent(const BondableEntity& start, uint32_t label)
+{
+    // 孤立ノード（縁を結んだことがない）は空の成分が返るので、開始点には必ず付ける
+    if (Player* player = BondableHelper::AsPlayer(start)) {
+        if (player == player_) playerComponent_ = label;
+    } else if (Group* group = BondableHelper::AsGroup(start)) {
+        if (auto it = denseIdOf_.find(group); it != denseIdOf_.end()) {
+            component_[it->second] = label;
+        }
+    }
+
+    Cluster cluster = RelationshipFacade::Get().GetGraph().GetConnectedComponent(start);
+    for (const BondableEntity& entity : cluster.entities) {
+        if (Player* player = BondableHelper::AsPlayer(entity)) {
+            if (player == player_) playerComponent_ = label;
+        } else if (Group* group = BondableHelper::AsGroup(entity)) {
+            if (auto it = denseIdOf_.find(group); it != denseIdOf_.end()) {
+                component_[it->second] = label;
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+uint32_t HostilityMatrix::ComponentOf(const BondableEntity& entity) const
+{
+    if (Player* player = BondableHelper::AsPlayer(entity)) {
+        return (player == player_) ? playerComponent_ : kNoComponent;
+    }
+    if (Group* group = BondableHelper::AsGroup(entity)) {
+        if (auto it = denseIdOf_.find(group); it != denseIdOf_.end()) {
+            return component_[it->second];
+        }
+    }
+    return kNoComponent;
+}
+
+//----------------------------------------------------------------------------
+bool HostilityMatrix::CanApplyIncrementally() const
+{
+    return !dirty_ &&
+        membershipRevision_ == GroupManager::Get().GetMembershipRevision() &&
+        player_ == RelationshipFacade::Get().GetPlayer() &&
+        RelationshipFacade::Get().GetGraph().GetRevision() == graphRevision_ + 1;
+}
+
+//----------------------------------------------------------------------------
+void HostilityMatrix::OnBondCreated(const BondableEntity& a, const BondableEntity& b)
+{
+    if (!CanApplyIncrementally()) {
+        dirty_ = true;
+        return;
+    }
+
+    const uint32_t componentA = ComponentOf(a);
+    const uint32_t componentB = ComponentOf(b);
+    if (componentA == kNoComponent || componentB == kNoComponent) {
+        dirty_ = true;
+        return;
+    }
+    graphRevision_ = RelationshipFacade::Get().GetGraph().GetRevision();
+    if (componentA == componentB) return;
+
+    // Bの成分をAの成分に統合し、統合後の成分の行を更新
+    if (playerComponent_ == componentB) {
+        playerComponent_ = componentA;
+    }
+    for (uint32_t i = 0; i < groupCount_; ++i) {
+        if (component_[i] == componentB) {
+            component_[i] = componentA;
+        }
+    }
+    for (uint32_t i = 0; i < groupCount_; ++i) {
+        if (groups_[i] && component_[i] == componentA) {
+            UpdateRow(i);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+void HostilityMatrix::OnBondRemoved(const BondableEntity& a, const BondableEntity& b)
+{
+    if (!CanApplyIncrementally()) {
+        dirty_ = true;
+        return;
+    }
+
+    const uint32_t oldComponent = ComponentOf(a);
+    if (oldComponent == kNoComponent || ComponentOf(b) != oldComponent) {
+        dirty_ = true;
+        return;
+    }
+    graphRevision_ = RelationshipFacade::Get().GetGraph().GetRevision();
+
+    // Bから辿れる範囲に新しい番号を付ける（まだAと繋がっていれば成分全体が新番号になる）
+    const uint32_t newComponent = nextComponent_++;
+    LabelComponent(b, newComponent);
+
+    for (uint32_t i = 0; i < groupCount_; ++i) {
+        if (groups_[i] && (component_[i] == oldComponent || component_[i] == newComponent)) {
+            UpdateRow(i);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+void HostilityMatrix::OnGroupBecameAlly(Group* group)
+{
+    if (!group || dirty_ || membershipRevision_ != GroupManager::Get().GetMembershipRevision()) {
+        dirty_ = true;
+        return;
+    }
+
+    auto it = denseIdOf_.find(group);
+    if (it == denseIdOf_.end()) {
+        dirty_ = true;
+        return;
+    }
+
+    ally_[it->second] = 1;
+    UpdateRow(it->second);
+}
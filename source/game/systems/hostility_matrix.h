@@ -0,0 +1,164 @@
+//----------------------------------------------------------------------------
+//! @file   hostility_matrix.h
+//! @brief  HostilityMatrix - グループ間敵対関係のビット行列キャッシュ
+//----------------------------------------------------------------------------
+#pragma once
+
+#include "game/bond/bondable_entity.h"
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+// 前方宣言
+class Group;
+
+//----------------------------------------------------------------------------
+//! @brief グループ間敵対関係のキャッシュ（シングルトン）
+//! @details CombatSystem::AreHostile()と同じ規則（縁で推移的に繋がっていない、かつ
+//!          味方同士でない）を、GroupManagerの密なIDで引くビット行列として保持する。
+//!          敵対判定は1ビットの読み出しになる。
+//!
+//!          縁グラフの連結成分番号を各グループに持たせ、変化した成分の行だけを書き直す。
+//!          - BondCreatedEvent: 2つの成分を統合し、統合後の成分の行を更新
+//!          - BondRemovedEvent: 切れた2端点からBFSして成分を分割し、元の成分の行を更新
+//!          - GroupBecameAllyEvent: そのグループの行を更新
+//!          イベントを伴わないグラフ変更（CSVからの縁作成、全滅時のCutAll等）や
+//!          グループの登録・削除は、RelationshipGraph/GroupManagerの変更カウンタで検出し、
+//!          次の参照時に全体を作り直す。
+//!
+//! @note スレッドセーフ性: 更新はメインスレッドのみ。
+//!       ワーカーから参照する場合は、先にメインスレッドでRefresh()を呼んでおくこと
+//----------------------------------------------------------------------------
+class HostilityMatrix
+{
+public:
+    //! @brief シングルトンインスタンス取得
+    static HostilityMatrix& Get();
+
+    //! @brief インスタンス生成
+    static void Create();
+
+    //! @brief インスタンス破棄
+    static void Destroy();
+
+    //! @brief デストラクタ
+    ~HostilityMatrix();
+
+    //------------------------------------------------------------------------
+    // 判定
+    //------------------------------------------------------------------------
+
+    //! @brief 2グループが敵対しているか
+    //! @note どちらかがGroupManager未登録ならfalse
+    [[nodiscard]] bool IsHostile(const Group* a, const Group* b);
+
+    //! @brief グループがプレイヤーに敵対しているか
+    //! @note 未登録グループならfalse
+    [[nodiscard]] bool IsHostileToPlayer(const Group* group);
+
+    //! @brief 指定グループの敵対ビット行を取得
+    //! @param denseId Group::GetDenseId()
+    //! @return ビットjが立っていれば密なIDjのグループと敵対
+    [[nodiscard]] std::span<const uint64_t> GetHostileRow(uint32_t denseId);
+
+    //------------------------------------------------------------------------
+    // 更新
+    //------------------------------------------------------------------------
+
+    //! @brief 変更カウンタを確認し、必要なら全体を作り直す
+    void Refresh();
+
+    //! @brief 次の参照時に全体を作り直す
+    void Invalidate() { dirty_ = true; }
+
+    //------------------------------------------------------------------------
+    // 統計
+    //------------------------------------------------------------------------
+
+    //! @brief 全体の作り直し回数
+    [[nodiscard]] uint64_t GetRebuildCount() const { return rebuildCount_; }
+
+    //! @brief 行単位の部分更新回数
+    [[nodiscard]] uint64_t GetRowUpdateCount() const { return rowUpdateCount_; }
+
+private:
+    HostilityMatrix();
+    HostilityMatrix(const HostilityMatrix&) = delete;
+    HostilityMatrix& operator=(const HostilityMatrix&) = delete;
+
+    //! @brief 成分番号なし
+    static constexpr uint32_t kNoComponent = UINT32_MAX;
+
+    //! @brief 全体を作り直す
+    void Rebuild();
+
+    //! @brief 1行（と対応する列）を再計算
+    void UpdateRow(uint32_t row);
+
+    //! @brief 密なIDi,jの敵対判定（キャッシュした成分番号・陣営から計算）
+    [[nodiscard]] bool ComputeHostile(uint32_t i, uint32_t j) const;
+
+    //! @brief (row, col)のビット位置
+    [[nodiscard]] size_t BitIndex(uint32_t row, uint32_t col) const
+    {
+        return static_cast<size_t>(row) * wordsPerRow_ * 64 + col;
+    }
+
+    //! @brief startの連結成分にlabelを付ける
+    void LabelComponent(const BondableEntity& start, uint32_t label);
+
+    //! @brief エンティティの成分番号（未登録グループはkNoComponent）
+    [[nodiscard]] uint32_t ComponentOf(const BondableEntity& entity) const;
+
+    //! @brief グラフ変更1回分だけ進んでいれば部分更新可能
+    [[nodiscard]] bool CanApplyIncrementally() const;
+
+    // イベントハンドラ
+    void OnBondCreated(const BondableEntity& a, const BondableEntity& b);
+    void OnBondRemoved(const BondableEntity& a, const BondableEntity& b);
+    void OnGroupBecameAlly(Group* group);
+
+    [[nodiscard]] bool TestBit(const std::vector<uint64_t>& bits, size_t index) const
+    {
+        return (bits[index >> 6] >> (index & 63)) & 1u;
+    }
+
+    void WriteBit(std::vector<uint64_t>& bits, size_t index, bool value)
+    {
+        const uint64_t mask = uint64_t{ 1 } << (index & 63);
+        bits[index >> 6] = value ? (bits[index >> 6] | mask) : (bits[index >> 6] & ~mask);
+    }
+
+    static inline std::unique_ptr<HostilityMatrix> instance_ = nullptr;
+
+    // 行列（密なID × 密なID、1行wordsPerRow_語）
+    std::vector<uint64_t> hostile_;         //!< グループ間の敵対ビット
+    std::vector<uint64_t> hostileToPlayer_; //!< プレイヤーへの敵対ビット
+    size_t groupCount_ = 0;                 //!< 行数（GroupManagerの密なID数）
+    size_t wordsPerRow_ = 0;                //!< 1行の語数
+
+    // 行の計算に使う状態（密なIDで引く）
+    std::vector<Group*> groups_;            //!< 密なID→グループ
+    std::vector<uint32_t> component_;       //!< 縁グラフの連結成分番号
+    std::vector<uint8_t> ally_;             //!< 味方陣営か
+    std::unordered_map<const Group*, uint32_t> denseIdOf_;  //!< グラフ上のグループ→密なID
+    Player* player_ = nullptr;                              //!< 反映済みのプレイヤー
+    uint32_t playerComponent_ = kNoComponent;               //!< プレイヤーの成分番号
+    uint32_t nextComponent_ = 0;                            //!< 次に割り当てる成分番号
+
+    // 無効化判定
+    uint64_t graphRevision_ = 0;            //!< 反映済みのグラフ変更カウンタ
+    uint64_t membershipRevision_ = 0;       //!< 反映済みのグループ増減カウンタ
+    bool dirty_ = true;                     //!< 全体の作り直しが必要
+
+    // 統計
+    uint64_t rebuildCount_ = 0;
+    uint64_t rowUpdateCount_ = 0;
+
+    // イベント購読ID
+    uint32_t bondCreatedSubscriptionId_ = 0;
+    uint32_t bondRemovedSubscriptionId_ = 0;
+    uint32_t groupBecameAllySubscriptionId_ = 0;
+};
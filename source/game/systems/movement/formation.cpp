@@ -19,7 +19,7 @@ Formation::Formation() = default;
 Formation::~Formation() = default;
 
 //----------------------------------------------------------------------------
-void Formation::Initialize(const std::vector<Individual*>& individuals, const Vector2& center)
+void Formation::Initialize(std::span<Individual* const> individuals, const Vector2& center)
 {
     center_ = center;
 
@@ -33,7 +33,7 @@ void Formation::Initialize(const std::vector<Individual*>& individuals, const Ve
 }
 
 //----------------------------------------------------------------------------
-void Formation::Rebuild(const std::vector<Individual*>& aliveIndividuals)
+void Formation::Rebuild(std::span<Individual* const> aliveIndividuals)
 {
     // 生存個体数でスロットを再生成
     GenerateSlots(aliveIndividuals.size());
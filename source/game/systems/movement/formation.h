@@ -5,6 +5,7 @@
 #pragma once
 
 #include <SimpleMath.h>
+#include <span>
 #include <vector>
 
 using DirectX::SimpleMath::Vector2;
@@ -51,11 +52,11 @@ public:
     //! @brief 初期化
     //! @param individuals 所属する個体リスト
     //! @param center 陣形の中心位置
-    void Initialize(const std::vector<Individual*>& individuals, const Vector2& center);
+    void Initialize(std::span<Individual* const> individuals, const Vector2& center);
 
     //! @brief 陣形を再生成（個体死亡時など）
     //! @param aliveIndividuals 生存個体リスト
-    void Rebuild(const std::vector<Individual*>& aliveIndividuals);
+    void Rebuild(std::span<Individual* const> aliveIndividuals);
 
     //! @brief 中心位置を更新
     //! @param center 新しい中心位置
@@ -0,0 +1,153 @@
+//----------------------------------------------------------------------------
+//! @file   separation_grid.cpp
+//! @brief  SeparationGrid実装
+//----------------------------------------------------------------------------
+#include "separation_grid.h"
+#include "game/entities/group.h"
+#include "game/systems/group_manager.h"
+#include "engine/core/job_system.h"
+#include <cassert>
+#include <cmath>
+
+namespace {
+    constexpr float kMinCellSize = 1.0f;       //!< セルサイズの下限
+    constexpr size_t kMinCellBudget = 1024;    //!< セル数上限の最小値
+    constexpr size_t kCellsPerEntry = 4;       //!< 個体1体あたりのセル数上限
+    constexpr uint32_t kMinParallelCount = 256; //!< 分離計算を並列化する最小個体数
+}
+
+//----------------------------------------------------------------------------
+SeparationGrid& SeparationGrid::Get()
+{
+    assert(instance_ && "SeparationGrid::Create() not called");
+    return *instance_;
+}
+
+//----------------------------------------------------------------------------
+void SeparationGrid::Create()
+{
+    if (!instance_) {
+        instance_.reset(new SeparationGrid());
+    }
+}
+
+//----------------------------------------------------------------------------
+void SeparationGrid::Destroy()
+{
+    instance_.reset();
+}
+
+//----------------------------------------------------------------------------
+void SeparationGrid::Build()
+{
+    gathered_.clear();
+    gatheredPos_.clear();
+
+    // 全グループの生存個体と位置を収集
+    float maxRadius = 0.0f;
+    for (Individual* individual : GroupManager::Get().GetAliveIndividuals()) {
+        gathered_.push_back(individual);
+        gatheredPos_.push_back(individual->GetPosition());
+        maxRadius = (std::max)(maxRadius, individual->GetSeparationRadius());
+    }
+
+    if (gathered_.empty()) {
+        Clear();
+        return;
+    }
+
+    // 範囲
+    float minX = gatheredPos_[0].x;
+    float minY = gatheredPos_[0].y;
+    float maxX = minX;
+    float maxY = minY;
+    for (const Vector2& pos : gatheredPos_) {
+        minX = (std::min)(minX, pos.x);
+        minY = (std::min)(minY, pos.y);
+        maxX = (std::max)(maxX, pos.x);
+        maxY = (std::max)(maxY, pos.y);
+    }
+
+    // セルサイズ＝最大分離半径（3x3セルで探索が完結する）
+    // 個体が広く散らばってセル数が上限を超える場合はセルを大きくする
+    const size_t count = gathered_.size();
+    const size_t cellBudget = (std::max)(kMinCellBudget, count * kCellsPerEntry);
+    cellSize_ = (std::max)(maxRadius, kMinCellSize);
+    for (;;) {
+        columns_ = static_cast<int>((maxX - minX) / cellSize_) + 1;
+        rows_ = static_cast<int>((maxY - minY) / cellSize_) + 1;
+        const size_t cells = static_cast<size_t>(columns_) * static_cast<size_t>(rows_);
+        if (cells <= cellBudget) break;
+        cellSize_ *= std::sqrt(static_cast<float>(cells) / static_cast<float>(cellBudget)) * 1.01f;
+    }
+    inverseCellSize_ = 1.0f / cellSize_;
+    originX_ = minX;
+    originY_ = minY;
+
+    // セル順の計数ソート
+    const size_t cellCount = GetCellCount();
+    cellStart_.assign(cellCount + 1, 0);
+    gatheredCell_.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        const int cx = (std::min)(CellX(gatheredPos_[i].x), columns_ - 1);
+        const int cy = (std::min)(CellY(gatheredPos_[i].y), rows_ - 1);
+        const uint32_t cell = static_cast<uint32_t>(cy * columns_ + cx);
+        gatheredCell_[i] = cell;
+        ++cellStart_[cell + 1];
+    }
+    for (size_t cell = 0; cell < cellCount; ++cell) {
+        cellStart_[cell + 1] += cellStart_[cell];
+    }
+
+    entries_.resize(count);
+    posX_.resize(count);
+    posY_.resize(count);
+    std::vector<uint32_t>& cursor = gatheredCell_;  // セル番号を書き込み位置で上書きして再利用
+    for (size_t i = 0; i < count; ++i) {
+        cursor[i] = cellStart_[cursor[i]]++;
+    }
+    // cellStart_はセル末尾を指すようになったので1つずらして戻す
+    for (size_t cell = cellCount; cell > 0; --cell) {
+        cellStart_[cell] = cellStart_[cell - 1];
+    }
+    cellStart_[0] = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t slot = cursor[i];
+        entries_[slot] = gathered_[i];
+        posX_[slot] = gatheredPos_[i].x;
+        posY_[slot] = gatheredPos_[i].y;
+    }
+}
+
+//----------------------------------------------------------------------------
+void SeparationGrid::ComputeSeparation()
+{
+    const uint32_t count = static_cast<uint32_t>(entries_.size());
+    auto computeRange = [this](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            entries_[i]->CalculateSeparation(*this);
+        }
+    };
+
+    // セル順に並んだentries_を分割するので、各ワーカーの近傍探索は局所的になる
+    if (count >= kMinParallelCount && JobSystem::IsCreated() && JobSystem::Get().GetWorkerCount() > 0) {
+        JobSystem::Get().ParallelForRange(0, count, computeRange).Wait();
+    } else {
+        computeRange(0, count);
+    }
+}
+
+//----------------------------------------------------------------------------
+void SeparationGrid::Clear()
+{
+    gathered_.clear();
+    gatheredPos_.clear();
+    gatheredCell_.clear();
+    entries_.clear();
+    posX_.clear();
+    posY_.clear();
+    cellStart_.clear();
+    columns_ = 0;
+    rows_ = 0;
+}
@@ -0,0 +1,133 @@
+//----------------------------------------------------------------------------
+//! @file   separation_grid.h
+//! @brief  SeparationGrid - 全生存個体の近傍探索用一様グリッド
+//----------------------------------------------------------------------------
+#pragma once
+
+#include <SimpleMath.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using DirectX::SimpleMath::Vector2;
+
+// 前方宣言
+class Individual;
+
+//----------------------------------------------------------------------------
+//! @brief 分離（重なり回避）用の近傍グリッド（シングルトン）
+//! @details 毎フレーム、全グループの生存個体の位置をスナップショットして一様グリッドに
+//!          振り分ける（セル順の計数ソート、O(n)）。セルサイズは最大の分離半径以上にするため、
+//!          各個体の近傍探索は自分の分離半径が掛かるセル（最大3x3）だけを走査すればよい。
+//!          グループをまたいで探索するため、重なったグループ同士も分離する。
+//! @note Build()以降に移動・死亡した個体はスナップショットの位置・状態のまま扱われる
+//----------------------------------------------------------------------------
+class SeparationGrid
+{
+public:
+    //! @brief シングルトンインスタンス取得
+    static SeparationGrid& Get();
+
+    //! @brief インスタンス生成
+    static void Create();
+
+    //! @brief インスタンス破棄
+    static void Destroy();
+
+    //! @brief デストラクタ
+    ~SeparationGrid() = default;
+
+    //------------------------------------------------------------------------
+    // 構築
+    //------------------------------------------------------------------------
+
+    //! @brief GroupManagerの全グループの生存個体からグリッドを構築
+    //! @note Group::Update()の前に1フレーム1回呼ぶ
+    void Build();
+
+    //! @brief 登録個体全員の分離オフセットを計算（ワーカーがあれば並列）
+    //! @note Build()の後、Group::Update()の前に呼ぶ。
+    //!       各個体は自分のオフセットにしか書かないため、ワーカー数によらず結果は同じ
+    void ComputeSeparation();
+
+    //! @brief 空にする
+    void Clear();
+
+    //------------------------------------------------------------------------
+    // 探索
+    //------------------------------------------------------------------------
+
+    //! @brief 中心から半径内に掛かるセルの個体を列挙
+    //! @param center 探索中心
+    //! @param radius 探索半径（距離の判定は呼び出し側で行う）
+    //! @param visit void(Individual* individual, const Vector2& position)
+    template<typename Visitor>
+    void ForEachNear(const Vector2& center, float radius, Visitor&& visit) const
+    {
+        if (entries_.empty()) return;
+
+        const int minX = (std::max)(CellX(center.x - radius), 0);
+        const int maxX = (std::min)(CellX(center.x + radius), columns_ - 1);
+        const int minY = (std::max)(CellY(center.y - radius), 0);
+        const int maxY = (std::min)(CellY(center.y + radius), rows_ - 1);
+        if (minX > maxX || minY > maxY) return;  // 構築範囲外
+
+        for (int cy = minY; cy <= maxY; ++cy) {
+            const uint32_t rowBase = static_cast<uint32_t>(cy * columns_);
+            const uint32_t begin = cellStart_[rowBase + minX];
+            const uint32_t end = cellStart_[rowBase + maxX + 1];
+            for (uint32_t i = begin; i < end; ++i) {
+                visit(entries_[i], Vector2(posX_[i], posY_[i]));
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // 統計
+    //------------------------------------------------------------------------
+
+    //! @brief 登録個体数
+    [[nodiscard]] size_t GetEntryCount() const { return entries_.size(); }
+
+    //! @brief セルサイズ
+    [[nodiscard]] float GetCellSize() const { return cellSize_; }
+
+    //! @brief セル数
+    [[nodiscard]] size_t GetCellCount() const { return static_cast<size_t>(columns_) * rows_; }
+
+private:
+    SeparationGrid() = default;
+    SeparationGrid(const SeparationGrid&) = delete;
+    SeparationGrid& operator=(const SeparationGrid&) = delete;
+
+    //! @brief 座標→セル番号（グリッド外は-1またはcountに丸める）
+    [[nodiscard]] int ClampedCell(float coord, float origin, int count) const
+    {
+        const float cell = std::floor((coord - origin) * inverseCellSize_);
+        return static_cast<int>((std::max)(-1.0f, (std::min)(cell, static_cast<float>(count))));
+    }
+    [[nodiscard]] int CellX(float x) const { return ClampedCell(x, originX_, columns_); }
+    [[nodiscard]] int CellY(float y) const { return ClampedCell(y, originY_, rows_); }
+
+    static inline std::unique_ptr<SeparationGrid> instance_ = nullptr;
+
+    // 構築用の一時データ（毎フレーム再利用）
+    std::vector<Individual*> gathered_;      //!< 生存個体（収集順）
+    std::vector<Vector2> gatheredPos_;       //!< 収集時の位置
+    std::vector<uint32_t> gatheredCell_;     //!< 所属セル
+
+    // セル順に並べたデータ
+    std::vector<Individual*> entries_;       //!< 個体
+    std::vector<float> posX_;                //!< 位置X
+    std::vector<float> posY_;                //!< 位置Y
+    std::vector<uint32_t> cellStart_;        //!< セル→entries_の開始位置（末尾に番兵）
+
+    float originX_ = 0.0f;
+    float originY_ = 0.0f;
+    float cellSize_ = 1.0f;
+    float inverseCellSize_ = 1.0f;
+    int columns_ = 0;
+    int rows_ = 0;
+};
@@ -7,9 +7,11 @@
 // Level 1: 基盤システム
 #include "engine/event/event_bus.h"
 #include "engine/time/time_manager.h"
+#include "game/entities/entity_pools.h"
 
 // Level 2: 基本システム
 #include "game/systems/group_manager.h"
+#include "game/systems/movement/separation_grid.h"
 #include "game/systems/fe_system.h"
 #include "game/bond/bond_manager.h"
 #include "game/systems/faction_manager.h"
@@ -19,7 +21,10 @@
 
 // Level 3: 関係性システム
 #include "game/relationships/relationship_facade.h"
+#include "game/systems/hostility_matrix.h"
 #include "game/systems/relationship_context.h"
+#include "game/ai/group_target_index.h"
+#include "game/ai/ai_lod_controller.h"
 
 // Level 4: 戦闘関連
 #include "game/systems/cut_system.h"
@@ -40,6 +45,13 @@
 
 #include "common/logging/logging.h"
 
+#if EVENT_BUS_STATS
+namespace {
+    //! EventBus統計の定期ダンプ間隔（EndOfFrameのDispatch回数）
+    constexpr uint32_t kEventBusStatsDumpFrames = 600;
+}
+#endif
+
 //----------------------------------------------------------------------------
 void SystemManager::CreateAll()
 {
@@ -49,10 +61,16 @@ void SystemManager::CreateAll()
 
     // Level 1: 基盤システム（他の全てが依存）
     EventBus::Create();
+#if EVENT_BUS_STATS
+    // イベント型ごとの発行数・ハンドラ処理時間を定期的にログ出力（約10秒ごと）
+    EventBus::Get().SetStatsDump(kEventBusStatsDumpFrames, [](const std::string& text) { LOG_INFO(text); });
+#endif
     TimeManager::Create();
+    EntityPools::Create();  // エンティティを所有する全システムより先に生成
 
     // Level 2: 基本システム
     GroupManager::Create();
+    SeparationGrid::Create();
     FESystem::Create();
     BondManager::Create();
     FactionManager::Create();
@@ -63,6 +81,9 @@ void SystemManager::CreateAll()
     // Level 3: 関係性システム（BondManager等に依存）
     RelationshipFacade::Create();
     RelationshipContext::Create();
+    HostilityMatrix::Create();
+    GroupTargetIndex::Create();
+    AILodController::Create();
 
     // Level 4: 戦闘関連（RelationshipFacade, TimeManager等に依存）
     CutSystem::Create();
@@ -110,6 +131,9 @@ void SystemManager::DestroyAll()
     CutSystem::Destroy();
 
     // Level 3: 関係性システム
+    AILodController::Destroy();
+    GroupTargetIndex::Destroy();
+    HostilityMatrix::Destroy();
     RelationshipContext::Destroy();
     RelationshipFacade::Destroy();
 
@@ -120,9 +144,11 @@ void SystemManager::DestroyAll()
     FactionManager::Destroy();
     BondManager::Destroy();
     FESystem::Destroy();
+    SeparationGrid::Destroy();
     GroupManager::Destroy();
 
     // Level 1: 基盤システム（最後に破棄）
+    EntityPools::Destroy();  // エンティティを所有する全システムの破棄後
     TimeManager::Destroy();
     EventBus::Destroy();
 
@@ -5,6 +5,7 @@
 #include "wave_manager.h"
 #include "game/entities/group.h"
 #include "game/systems/group_manager.h"
+#include "game/entities/entity_pools.h"
 #include "common/logging/logging.h"
 
 //----------------------------------------------------------------------------
@@ -34,6 +35,7 @@ void WaveManager::Update()
         waveCleared_ = true;
 
         LOG_INFO("[WaveManager] Wave " + std::to_string(currentWave_) + " cleared!");
+        EntityPools::Get().ReportWave(currentWave_);
 
         if (onWaveCleared_) {
             onWaveCleared_(currentWave_);
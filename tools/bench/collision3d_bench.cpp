@@ -0,0 +1,600 @@
+//----------------------------------------------------------------------------
+//! @file   collision3d_bench.cpp
+//! @brief  CollisionManager3D ヘッドレスベンチマーク・ナローフェーズ検証
+//!
+//! @details
+//! ウィンドウ・D3D11を使わずにCollisionManager3Dを駆動し、
+//! 球・AABB・カプセルが混在するシーンで固定ステップごとの処理時間を計測します。
+//! 接触ペア列のハッシュとイベントストリームのハッシュを出力するので、
+//! 最適化の前後で結果が変わっていないことを確認できます。
+//!
+//! --validate を指定すると、毎ステップ全ペアを
+//! Narrowphase3Dのスカラー参照実装で総当たり判定し、
+//! CollisionManager3D（SIMDバッチ判定）の結果と照合します。
+//!
+//! シーン:
+//! - uniform : 大きさの揃った形状が地面付近（Y: 0〜200）に分布
+//! - hetero  : 大きさが0.25〜20倍にばらつき、Yにも疎に分布（Y: 0〜2000）
+//!
+//! --broadphase でグリッドと動的AABBツリーを切り替えられる。
+//! どちらでも接触ペア列は同一になるため、ハッシュで結果を比較できる。
+//!
+//! --narrowphase=<N> を指定すると、シーンとは別に
+//! 球-球・球-AABBのランダムな4ペアバッチをN個生成し、
+//! スカラー参照版とSIMD版の速度と一致を比較します。
+//!
+//! コマンドライン引数:
+//!   --help               ヘルプ表示
+//!   --count=<N>          コライダー数（既定: 3000）
+//!   --ticks=<M>          固定ステップ数（既定: 600）
+//!   --mix=<S>:<A>:<C>    球:AABB:カプセルの比率（既定: 40:30:30）
+//!   --scene=<名前>       uniform | hetero（既定: uniform）
+//!   --broadphase=<名前>  grid | tree（既定: grid）
+//!   --queries=<Q>        ステップごとのRaycast/QueryAABB/QuerySphere回数（既定: 0）
+//!   --seed=<S>           乱数シード（既定: 1）
+//!   --cell-size=<C>      グリッドセルサイズ（既定: 100）
+//!   --world=<W>          ワールドの一辺（XZ、既定: 3000）
+//!   --validate           スカラー参照実装との照合
+//!   --narrowphase=<N>    ナローフェーズ単体ベンチマーク（4ペアバッチ数）
+//!   --expect-hash=<16進> 期待する接触ペアハッシュ（不一致なら終了コード1）
+//----------------------------------------------------------------------------
+#include "engine/c_systems/collision_manager3d.h"
+#include "engine/c_systems/collision_narrowphase3d.h"
+#include "engine/component/collider3d.h"
+#include "collision_bench_common.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace {
+
+using CollisionBench::Random;
+using CollisionBench::EventCounts;
+using CollisionBench::HashValue;
+
+//----------------------------------------------------------------------------
+// 設定
+//----------------------------------------------------------------------------
+
+//! ベンチマーク設定
+struct BenchConfig
+{
+    uint32_t count = 3000;                      //!< コライダー数
+    uint32_t ticks = 600;                       //!< 固定ステップ数
+    uint32_t mix[3] = { 40, 30, 30 };           //!< 球:AABB:カプセル
+    bool hetero = false;                        //!< 大きさ・高さがばらつくシーン
+    Broadphase3D broadphase = Broadphase3D::Grid;
+    uint32_t queries = 0;                       //!< ステップごとのクエリ回数（種類ごと）
+    uint64_t seed = 1;                          //!< 乱数シード
+    int cellSize = 100;                         //!< グリッドセルサイズ
+    float worldSize = 3000.0f;                  //!< ワールドの一辺（XZ）
+    bool validate = false;                      //!< 参照実装と照合するか
+    uint32_t narrowphaseBatches = 0;            //!< ナローフェーズ単体ベンチのバッチ数
+    bool checkHash = false;                     //!< ハッシュを検証するか
+    uint64_t expectedHash = 0;                  //!< 期待するハッシュ
+};
+
+//! 使用方法を表示
+void PrintUsage(const char* programName)
+{
+    std::printf("使用方法: %s [オプション]\n"
+                "\nオプション:\n"
+                "  --help               このヘルプを表示\n"
+                "  --count=<N>          コライダー数（既定: 3000）\n"
+                "  --ticks=<M>          固定ステップ数（既定: 600）\n"
+                "  --mix=<S>:<A>:<C>    球:AABB:カプセルの比率（既定: 40:30:30）\n"
+                "  --scene=<名前>       uniform | hetero（既定: uniform）\n"
+                "  --broadphase=<名前>  grid | tree（既定: grid）\n"
+                "  --queries=<Q>        ステップごとのクエリ回数（既定: 0）\n"
+                "  --seed=<S>           乱数シード（既定: 1）\n"
+                "  --cell-size=<C>      グリッドセルサイズ（既定: 100）\n"
+                "  --world=<W>          ワールドの一辺（既定: 3000）\n"
+                "  --validate           スカラー参照実装との照合\n"
+                "  --narrowphase=<N>    ナローフェーズ単体ベンチマーク（4ペアバッチ数）\n"
+                "  --expect-hash=<16進> 期待する接触ペアハッシュ\n",
+                programName);
+}
+
+//! コマンドライン引数を解析
+//! @return 成功したらtrue
+bool ParseCommandLine(int argc, char* argv[], BenchConfig& config)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+
+        if (arg == "--help") {
+            PrintUsage(argv[0]);
+            std::exit(0);
+        }
+        else if (arg.rfind("--count=", 0) == 0) {
+            config.count = static_cast<uint32_t>(std::strtoul(arg.c_str() + 8, nullptr, 10));
+        }
+        else if (arg.rfind("--ticks=", 0) == 0) {
+            config.ticks = static_cast<uint32_t>(std::strtoul(arg.c_str() + 8, nullptr, 10));
+        }
+        else if (arg.rfind("--mix=", 0) == 0) {
+            unsigned s = 0, a = 0, c = 0;
+            if (std::sscanf(arg.c_str() + 6, "%u:%u:%u", &s, &a, &c) != 3 || s + a + c == 0) {
+                std::fprintf(stderr, "--mix は <球>:<AABB>:<カプセル> で指定してください\n");
+                return false;
+            }
+            config.mix[0] = s;
+            config.mix[1] = a;
+            config.mix[2] = c;
+        }
+        else if (arg.rfind("--scene=", 0) == 0) {
+            std::string name = arg.substr(8);
+            if (name == "uniform")      config.hetero = false;
+            else if (name == "hetero")  config.hetero = true;
+            else {
+                std::fprintf(stderr, "不明なシーン: %s\n", name.c_str());
+                return false;
+            }
+        }
+        else if (arg.rfind("--broadphase=", 0) == 0) {
+            std::string name = arg.substr(13);
+            if (name == "grid")         config.broadphase = Broadphase3D::Grid;
+            else if (name == "tree")    config.broadphase = Broadphase3D::DynamicTree;
+            else {
+                std::fprintf(stderr, "不明なブロードフェーズ: %s\n", name.c_str());
+                return false;
+            }
+        }
+        else if (arg.rfind("--queries=", 0) == 0) {
+            config.queries = static_cast<uint32_t>(std::strtoul(arg.c_str() + 10, nullptr, 10));
+        }
+        else if (arg.rfind("--seed=", 0) == 0) {
+            config.seed = std::strtoull(arg.c_str() + 7, nullptr, 10);
+        }
+        else if (arg.rfind("--cell-size=", 0) == 0) {
+            config.cellSize = std::atoi(arg.c_str() + 12);
+        }
+        else if (arg.rfind("--world=", 0) == 0) {
+            config.worldSize = static_cast<float>(std::atof(arg.c_str() + 8));
+        }
+        else if (arg == "--validate") {
+            config.validate = true;
+        }
+        else if (arg.rfind("--narrowphase=", 0) == 0) {
+            config.narrowphaseBatches = static_cast<uint32_t>(std::strtoul(arg.c_str() + 14, nullptr, 10));
+        }
+        else if (arg.rfind("--expect-hash=", 0) == 0) {
+            config.checkHash = true;
+            config.expectedHash = std::strtoull(arg.c_str() + 14, nullptr, 16);
+        }
+        else {
+            std::fprintf(stderr, "不明な引数: %s\n", arg.c_str());
+            return false;
+        }
+    }
+
+    if (config.count == 0 || config.count >= CollisionConstants3D::kInvalidIndex) {
+        std::fprintf(stderr, "--count は 1〜%u の範囲で指定してください\n",
+                     static_cast<unsigned>(CollisionConstants3D::kInvalidIndex - 1));
+        return false;
+    }
+    if (config.worldSize <= 0.0f) {
+        std::fprintf(stderr, "--world は正の値で指定してください\n");
+        return false;
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------
+// シーン（SoA）
+//----------------------------------------------------------------------------
+
+constexpr float kDt = CollisionManager3D::GetFixedDeltaTime();
+constexpr float kWorldHeight = 200.0f;          //!< Y方向の高さ（地面付近に集まる想定）
+constexpr float kHeteroWorldHeight = 2000.0f;   //!< heteroシーンのY方向の高さ
+constexpr float kHeteroMinScale = 0.25f;        //!< heteroシーンの大きさ倍率（最小）
+constexpr float kHeteroScaleRange = 80.0f;      //!< 最大倍率 / 最小倍率
+constexpr float kMaxSpeed = 120.0f;
+constexpr float kAccel = 400.0f;
+
+//! ベンチマーク用シーン
+class BenchScene
+{
+public:
+    explicit BenchScene(const BenchConfig& config) : config_(config), random_(config.seed) {}
+
+    //! コライダーを生成して登録
+    void Spawn()
+    {
+        auto& mgr = CollisionManager3D::Get();
+        const uint32_t n = config_.count;
+        const uint32_t mixTotal = config_.mix[0] + config_.mix[1] + config_.mix[2];
+
+        posX_.resize(n); posY_.resize(n); posZ_.resize(n);
+        velX_.resize(n); velZ_.resize(n);
+        colliders_.reserve(n);
+        handles_.reserve(n);
+
+        for (uint32_t i = 0; i < n; ++i) {
+            // 比率どおりに形状を割り当て（iの剰余で決定的に分配）
+            uint32_t slot = i % mixTotal;
+            ColliderShape3D shape = slot < config_.mix[0] ? ColliderShape3D::Sphere
+                : slot < config_.mix[0] + config_.mix[1] ? ColliderShape3D::AABB
+                : ColliderShape3D::Capsule;
+
+            // heteroでは倍率を対数一様に取り、小物と巨大物を混在させる
+            float scale = config_.hetero
+                ? kHeteroMinScale * std::pow(kHeteroScaleRange, random_.NextFloat())
+                : 1.0f;
+
+            posX_[i] = random_.Range(0.0f, config_.worldSize);
+            posY_[i] = random_.Range(0.0f, config_.hetero ? kHeteroWorldHeight : kWorldHeight);
+            posZ_[i] = random_.Range(0.0f, config_.worldSize);
+            velX_[i] = random_.Range(-kMaxSpeed, kMaxSpeed);
+            velZ_[i] = random_.Range(-kMaxSpeed, kMaxSpeed);
+
+            auto collider = std::make_unique<Collider3D>();
+            Collider3DHandle handle = mgr.Register(collider.get(), shape);
+            switch (shape) {
+            case ColliderShape3D::Sphere:
+                mgr.SetSphereRadius(handle, random_.Range(10.0f, 20.0f) * scale);
+                break;
+            case ColliderShape3D::AABB:
+                mgr.SetAABBSize(handle, Vector3(random_.Range(20.0f, 40.0f) * scale,
+                                                random_.Range(20.0f, 40.0f) * scale,
+                                                random_.Range(20.0f, 40.0f) * scale));
+                break;
+            case ColliderShape3D::Capsule:
+                mgr.SetSphereRadius(handle, random_.Range(8.0f, 15.0f) * scale);
+                mgr.SetCapsuleHalfHeight(handle, random_.Range(10.0f, 25.0f) * scale);
+                break;
+            }
+            mgr.SetPosition(handle, Vector3(posX_[i], posY_[i], posZ_[i]));
+
+            colliders_.push_back(std::move(collider));
+            handles_.push_back(handle);
+        }
+    }
+
+    //! 1ステップ分移動し、CollisionManager3Dへ位置を反映
+    void Step()
+    {
+        auto& mgr = CollisionManager3D::Get();
+        const uint32_t n = config_.count;
+        for (uint32_t i = 0; i < n; ++i) {
+            velX_[i] = std::clamp(velX_[i] + random_.Range(-kAccel, kAccel) * kDt, -kMaxSpeed, kMaxSpeed);
+            velZ_[i] = std::clamp(velZ_[i] + random_.Range(-kAccel, kAccel) * kDt, -kMaxSpeed, kMaxSpeed);
+            posX_[i] += velX_[i] * kDt;
+            posZ_[i] += velZ_[i] * kDt;
+
+            // 壁で反射
+            if (posX_[i] < 0.0f || posX_[i] > config_.worldSize) {
+                velX_[i] = -velX_[i];
+                posX_[i] = std::clamp(posX_[i], 0.0f, config_.worldSize);
+            }
+            if (posZ_[i] < 0.0f || posZ_[i] > config_.worldSize) {
+                velZ_[i] = -velZ_[i];
+                posZ_[i] = std::clamp(posZ_[i], 0.0f, config_.worldSize);
+            }
+            mgr.SetPosition(handles_[i], Vector3(posX_[i], posY_[i], posZ_[i]));
+        }
+    }
+
+    //! ランダムなRaycast/QueryAABB/QuerySphereをcount回ずつ実行
+    //! @return ヒット数の合計
+    uint64_t RunQueries(uint32_t count)
+    {
+        auto& mgr = CollisionManager3D::Get();
+        float height = config_.hetero ? kHeteroWorldHeight : kWorldHeight;
+        uint64_t hits = 0;
+
+        for (uint32_t q = 0; q < count; ++q) {
+            Vector3 origin(random_.Range(0.0f, config_.worldSize),
+                           random_.Range(0.0f, height),
+                           random_.Range(0.0f, config_.worldSize));
+            Vector3 dir(random_.Range(-1.0f, 1.0f), random_.Range(-0.2f, 0.2f), random_.Range(-1.0f, 1.0f));
+            if (dir.LengthSquared() < 0.0001f) dir = Vector3(1.0f, 0.0f, 0.0f);
+            if (mgr.Raycast(origin, dir, config_.worldSize * 0.5f)) ++hits;
+
+            AABB3D box(origin.x, origin.y, origin.z, 150.0f, 150.0f, 150.0f);
+            mgr.QueryAABB(box, queryResults_);
+            hits += queryResults_.size();
+
+            mgr.QuerySphere(BoundingSphere3D(origin, 100.0f), queryResults_);
+            hits += queryResults_.size();
+        }
+        return hits;
+    }
+
+    //! 全ペアをスカラー参照実装で総当たり判定
+    //! @param[out] pairs 接触ペアキー（昇順）
+    void ComputeReferencePairs(std::vector<uint32_t>& pairs) const
+    {
+        using namespace Narrowphase3D;
+        const auto& mgr = CollisionManager3D::Get();
+        pairs.clear();
+
+        const size_t n = handles_.size();
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = i + 1; j < n; ++j) {
+                Collider3DHandle a = handles_[i];
+                Collider3DHandle b = handles_[j];
+                if (a.index > b.index) std::swap(a, b);
+                if ((mgr.GetLayer(a) & mgr.GetMask(b)) == 0 ||
+                    (mgr.GetLayer(b) & mgr.GetMask(a)) == 0) {
+                    continue;
+                }
+                if (TestReference(a, b)) {
+                    pairs.push_back((static_cast<uint32_t>(a.index) << 16) | b.index);
+                }
+            }
+        }
+        std::sort(pairs.begin(), pairs.end());
+    }
+
+private:
+    static Narrowphase3D::Sphere ToSphere(Collider3DHandle h)
+    {
+        const auto& mgr = CollisionManager3D::Get();
+        BoundingSphere3D s = mgr.GetBoundingSphere(h);
+        return { s.center.x, s.center.y, s.center.z, s.radius };
+    }
+
+    static Narrowphase3D::Box ToBox(Collider3DHandle h)
+    {
+        // GetAABB()経由だと min/max からの再計算で丸めが変わるため、中心とサイズから組み立てる
+        const auto& mgr = CollisionManager3D::Get();
+        Vector3 c = mgr.GetBoundingSphere(h).center;
+        Vector3 size = mgr.GetSize(h);
+        return { c.x, c.y, c.z, size.x * 0.5f, size.y * 0.5f, size.z * 0.5f };
+    }
+
+    static Narrowphase3D::Capsule ToCapsule(Collider3DHandle h)
+    {
+        const auto& mgr = CollisionManager3D::Get();
+        BoundingSphere3D s = mgr.GetBoundingSphere(h);
+        return { s.center.x, s.center.y, s.center.z, mgr.GetCapsuleHalfHeight(h), s.radius };
+    }
+
+    //! 形状組み合わせごとのスカラー参照判定
+    static bool TestReference(Collider3DHandle a, Collider3DHandle b)
+    {
+        using namespace Narrowphase3D;
+        const auto& mgr = CollisionManager3D::Get();
+        ColliderShape3D sa = mgr.GetShape(a);
+        ColliderShape3D sb = mgr.GetShape(b);
+
+        if (sb == ColliderShape3D::Capsule && sa != ColliderShape3D::Capsule) {
+            std::swap(a, b);
+            std::swap(sa, sb);
+        }
+        if (sa == ColliderShape3D::AABB && sb == ColliderShape3D::Sphere) {
+            std::swap(a, b);
+            std::swap(sa, sb);
+        }
+
+        if (sa == ColliderShape3D::Capsule) {
+            if (sb == ColliderShape3D::Capsule) return CapsuleCapsule(ToCapsule(a), ToCapsule(b));
+            if (sb == ColliderShape3D::Sphere)  return CapsuleSphere(ToCapsule(a), ToSphere(b));
+            return CapsuleBox(ToCapsule(a), ToBox(b));
+        }
+        if (sa == ColliderShape3D::Sphere) {
+            if (sb == ColliderShape3D::Sphere) return SphereSphere(ToSphere(a), ToSphere(b));
+            return SphereBox(ToSphere(a), ToBox(b));
+        }
+        return BoxBox(ToBox(a), ToBox(b));
+    }
+
+    const BenchConfig& config_;
+    Random random_;
+
+    std::vector<float> posX_, posY_, posZ_;
+    std::vector<float> velX_, velZ_;
+
+    std::vector<std::unique_ptr<Collider3D>> colliders_;
+    std::vector<Collider3DHandle> handles_;
+    std::vector<Collider3D*> queryResults_;
+};
+
+//----------------------------------------------------------------------------
+// ナローフェーズ単体ベンチマーク
+//----------------------------------------------------------------------------
+
+//! SIMD版とスカラー参照版を同じ入力で実行し、速度と一致を比較
+//! @return 不一致レーン数
+uint64_t RunNarrowphaseBench(uint32_t batchCount, uint64_t seed)
+{
+    using namespace Narrowphase3D;
+    using Clock = std::chrono::steady_clock;
+
+    Random random(seed);
+
+    // 境界付近の判定も含むよう、約半数がヒットする分布にする
+    std::vector<SphereSphereBatch> ss(batchCount);
+    std::vector<SphereBoxBatch> sb(batchCount);
+    for (uint32_t i = 0; i < batchCount; ++i) {
+        for (int lane = 0; lane < 4; ++lane) {
+            ss[i].ax[lane] = random.Range(0.0f, 60.0f);
+            ss[i].ay[lane] = random.Range(0.0f, 60.0f);
+            ss[i].az[lane] = random.Range(0.0f, 60.0f);
+            ss[i].ar[lane] = random.Range(5.0f, 20.0f);
+            ss[i].bx[lane] = random.Range(0.0f, 60.0f);
+            ss[i].by[lane] = random.Range(0.0f, 60.0f);
+            ss[i].bz[lane] = random.Range(0.0f, 60.0f);
+            ss[i].br[lane] = random.Range(5.0f, 20.0f);
+
+            sb[i].sx[lane] = random.Range(0.0f, 60.0f);
+            sb[i].sy[lane] = random.Range(0.0f, 60.0f);
+            sb[i].sz[lane] = random.Range(0.0f, 60.0f);
+            sb[i].sr[lane] = random.Range(5.0f, 20.0f);
+            sb[i].bx[lane] = random.Range(0.0f, 60.0f);
+            sb[i].by[lane] = random.Range(0.0f, 60.0f);
+            sb[i].bz[lane] = random.Range(0.0f, 60.0f);
+            sb[i].hw[lane] = random.Range(5.0f, 20.0f);
+            sb[i].hh[lane] = random.Range(5.0f, 20.0f);
+            sb[i].hd[lane] = random.Range(5.0f, 20.0f);
+        }
+    }
+
+    std::vector<uint8_t> refMask(batchCount), simdMask(batchCount);
+    auto measure = [&](auto&& func) {
+        auto begin = Clock::now();
+        func();
+        return std::chrono::duration<double, std::nano>(Clock::now() - begin).count();
+    };
+
+    uint64_t mismatches = 0;
+    auto compare = [&]() {
+        for (uint32_t i = 0; i < batchCount; ++i) {
+            uint32_t diff = refMask[i] ^ simdMask[i];
+            for (; diff; diff &= diff - 1) ++mismatches;
+        }
+    };
+    double pairs = static_cast<double>((std::max)(batchCount, 1u)) * 4.0;
+
+    double ssRef = measure([&] { for (uint32_t i = 0; i < batchCount; ++i) refMask[i] = static_cast<uint8_t>(SphereSphere4Reference(ss[i])); });
+    double ssSimd = measure([&] { for (uint32_t i = 0; i < batchCount; ++i) simdMask[i] = static_cast<uint8_t>(SphereSphere4(ss[i])); });
+    compare();
+    double sbRef = measure([&] { for (uint32_t i = 0; i < batchCount; ++i) refMask[i] = static_cast<uint8_t>(SphereBox4Reference(sb[i])); });
+    double sbSimd = measure([&] { for (uint32_t i = 0; i < batchCount; ++i) simdMask[i] = static_cast<uint8_t>(SphereBox4(sb[i])); });
+    compare();
+
+    std::printf("=== ナローフェーズ（%u バッチ × 4 ペア, SIMD: %s）===\n",
+                batchCount, COLLISION_NARROWPHASE_SIMD ? "SSE" : "なし");
+    std::printf("球-球    [ns/pair]  参照: %.3f  SIMD: %.3f  (x%.2f)\n",
+                ssRef / pairs, ssSimd / pairs, ssSimd > 0.0 ? ssRef / ssSimd : 0.0);
+    std::printf("球-AABB  [ns/pair]  参照: %.3f  SIMD: %.3f  (x%.2f)\n",
+                sbRef / pairs, sbSimd / pairs, sbSimd > 0.0 ? sbRef / sbSimd : 0.0);
+    std::printf("不一致レーン      %" PRIu64 "\n", mismatches);
+    return mismatches;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
+// メインエントリーポイント
+//----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+#ifdef _WIN32
+    // コンソール出力をUTF-8に設定
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    BenchConfig config;
+    if (!ParseCommandLine(argc, argv, config)) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    if (config.narrowphaseBatches > 0) {
+        return RunNarrowphaseBench(config.narrowphaseBatches, config.seed) == 0 ? 0 : 1;
+    }
+
+    CollisionManager3D::Create();
+    CollisionManager3D::Get().Initialize(config.cellSize, config.broadphase);
+
+    int exitCode = 0;
+    {
+        BenchScene scene(config);
+        scene.Spawn();
+
+        std::vector<double> tickMs;
+        tickMs.reserve(config.ticks);
+        double queryMs = 0.0;
+        uint64_t queryHits = 0;
+        uint64_t pairTotal = 0;
+        size_t pairMax = 0;
+        uint64_t mismatchTicks = 0;
+        uint64_t hash = CollisionBench::kHashSeed;
+        uint64_t eventHash = CollisionBench::kHashSeed;
+        EventCounts eventCounts;
+        std::vector<uint32_t> referencePairs;
+
+        auto& mgr = CollisionManager3D::Get();
+        for (uint32_t tick = 0; tick < config.ticks; ++tick) {
+            scene.Step();
+
+            // 1回のUpdate()でちょうど1固定ステップ進める
+            auto begin = std::chrono::steady_clock::now();
+            mgr.Update(kDt);
+            auto end = std::chrono::steady_clock::now();
+            tickMs.push_back(std::chrono::duration<double, std::milli>(end - begin).count());
+
+            if (config.queries > 0) {
+                auto queryBegin = std::chrono::steady_clock::now();
+                queryHits += scene.RunQueries(config.queries);
+                queryMs += std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - queryBegin).count();
+            }
+
+            auto pairs = mgr.GetContactPairs();
+            pairTotal += pairs.size();
+            pairMax = (std::max)(pairMax, pairs.size());
+
+            HashValue(hash, tick);
+            HashValue(hash, static_cast<uint32_t>(pairs.size()));
+            for (uint32_t key : pairs) {
+                HashValue(hash, key);
+            }
+
+            eventCounts.Add(mgr);
+            CollisionBench::HashEvents(eventHash, tick, mgr);
+
+            if (config.validate) {
+                scene.ComputeReferencePairs(referencePairs);
+                if (!std::equal(pairs.begin(), pairs.end(), referencePairs.begin(), referencePairs.end())) {
+                    if (mismatchTicks == 0) {
+                        std::printf("[不一致] ステップ %u: マネージャー %zu ペア / 参照 %zu ペア\n",
+                                    tick, pairs.size(), referencePairs.size());
+                    }
+                    ++mismatchTicks;
+                }
+            }
+        }
+
+        double ticks = static_cast<double>((std::max)(config.ticks, 1u));
+
+        std::printf("=== CollisionManager3D ベンチマーク ===\n");
+        std::printf("シーン: %s  ブロードフェーズ: %s\n",
+                    config.hetero ? "hetero" : "uniform",
+                    config.broadphase == Broadphase3D::DynamicTree ? "tree" : "grid");
+        std::printf("コライダー: %u (球:AABB:カプセル = %u:%u:%u)  ステップ: %u  セル: %d  ワールド: %.0f  シード: %" PRIu64 "\n",
+                    config.count, config.mix[0], config.mix[1], config.mix[2],
+                    config.ticks, config.cellSize, config.worldSize, config.seed);
+        double totalMs = CollisionBench::PrintStepTimes(tickMs);
+        std::printf("接触ペア数        平均: %.1f  最大: %zu\n",
+                    static_cast<double>(pairTotal) / ticks, pairMax);
+        CollisionBench::PrintEventCounts(eventCounts, totalMs);
+        if (config.queries > 0) {
+            std::printf("クエリ時間 [ms]   平均: %.4f /ステップ（%u × 3種）  ヒット: %" PRIu64 "\n",
+                        queryMs / ticks, config.queries, queryHits);
+        }
+        std::printf("接触ペアハッシュ  %016" PRIx64 "\n", hash);
+        std::printf("イベントハッシュ  %016" PRIx64 "\n", eventHash);
+
+        if (config.validate) {
+            if (mismatchTicks > 0) {
+                std::printf("[失敗] 参照実装と %" PRIu64 " ステップで不一致\n", mismatchTicks);
+                exitCode = 1;
+            } else {
+                std::printf("[成功] 全ステップで参照実装と一致\n");
+            }
+        }
+
+        if (config.checkHash && !CollisionBench::CheckHash(hash, config.expectedHash)) {
+            exitCode = 1;
+        }
+    }
+
+    CollisionManager3D::Get().Shutdown();
+    CollisionManager3D::Destroy();
+    return exitCode;
+}
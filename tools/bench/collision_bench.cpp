@@ -0,0 +1,547 @@
+//----------------------------------------------------------------------------
+//! @file   collision_bench.cpp
+//! @brief  CollisionManager ヘッドレスベンチマーク・決定性検証
+//!
+//! @details
+//! ウィンドウ・D3D11を使わずにCollisionManagerを駆動し、
+//! 固定ステップごとの処理時間とイベントストリームを計測します。
+//! イベントストリームのハッシュを比較することで、
+//! ブロードフェーズ最適化の前後でEnter/Stay/Exitの列が
+//! 完全に一致することを確認できます。
+//!
+//! 移動パターン:
+//! - random     : 一様ランダムウォーク（Individual相当）
+//! - formation  : 円形陣形のクラスタ（Formation相当）が目標へ移動
+//! - projectile : 長距離の直進弾（Arrow相当）75% + 標的のランダムウォーク 25%
+//! - mixed      : 上記3種を1/3ずつ
+//!
+//! コマンドライン引数:
+//!   --help               ヘルプ表示
+//!   --count=<N>          コライダー数（既定: 2000）
+//!   --ticks=<M>          固定ステップ数（既定: 600）
+//!   --pattern=<名前>     移動パターン（既定: mixed）
+//!   --seed=<S>           乱数シード（既定: 1）
+//!   --cell-size=<C>      グリッドセルサイズ（既定: 64、ゲーム本体と同じ）
+//!   --world=<W>          ワールドの一辺（既定: 4096）
+//!   --callbacks          全コライダーにEnter/Stay/Exitコールバックを登録
+//!   --expect-hash=<16進> 期待するイベントハッシュ（不一致なら終了コード1）
+//!
+//! @note 浮動小数点演算の結果はコンパイラ・最適化設定に依存するため、
+//!       ハッシュ比較は同一ビルド設定同士で行うこと。
+//----------------------------------------------------------------------------
+#include "engine/c_systems/collision_manager.h"
+#include "engine/c_systems/collision_layers.h"
+#include "engine/component/collider2d.h"
+#include "collision_bench_common.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace {
+
+using CollisionBench::Random;
+using CollisionBench::EventCounts;
+
+//----------------------------------------------------------------------------
+// 設定
+//----------------------------------------------------------------------------
+
+//! 移動パターン
+enum class MotionPattern
+{
+    Random,
+    Formation,
+    Projectile,
+    Mixed
+};
+
+//! ベンチマーク設定
+struct BenchConfig
+{
+    uint32_t count = 2000;                      //!< コライダー数
+    uint32_t ticks = 600;                       //!< 固定ステップ数
+    MotionPattern pattern = MotionPattern::Mixed;
+    uint64_t seed = 1;                          //!< 乱数シード
+    int cellSize = 64;                          //!< グリッドセルサイズ
+    float worldSize = 4096.0f;                  //!< ワールドの一辺
+    bool callbacks = false;                     //!< コールバックを登録するか
+    bool checkHash = false;                     //!< ハッシュを検証するか
+    uint64_t expectedHash = 0;                  //!< 期待するハッシュ
+};
+
+//! パターン名
+const char* GetPatternName(MotionPattern pattern)
+{
+    switch (pattern) {
+    case MotionPattern::Random:     return "random";
+    case MotionPattern::Formation:  return "formation";
+    case MotionPattern::Projectile: return "projectile";
+    case MotionPattern::Mixed:      return "mixed";
+    }
+    return "unknown";
+}
+
+//! 使用方法を表示
+void PrintUsage(const char* programName)
+{
+    std::printf("使用方法: %s [オプション]\n"
+                "\nオプション:\n"
+                "  --help               このヘルプを表示\n"
+                "  --count=<N>          コライダー数（既定: 2000）\n"
+                "  --ticks=<M>          固定ステップ数（既定: 600）\n"
+                "  --pattern=<名前>     random | formation | projectile | mixed（既定: mixed）\n"
+                "  --seed=<S>           乱数シード（既定: 1）\n"
+                "  --cell-size=<C>      グリッドセルサイズ（既定: 64）\n"
+                "  --world=<W>          ワールドの一辺（既定: 4096）\n"
+                "  --callbacks          全コライダーにコールバックを登録\n"
+                "  --expect-hash=<16進> 期待するイベントハッシュ\n",
+                programName);
+}
+
+//! コマンドライン引数を解析
+//! @return 成功したらtrue
+bool ParseCommandLine(int argc, char* argv[], BenchConfig& config)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+
+        if (arg == "--help") {
+            PrintUsage(argv[0]);
+            std::exit(0);
+        }
+        else if (arg.rfind("--count=", 0) == 0) {
+            config.count = static_cast<uint32_t>(std::strtoul(arg.c_str() + 8, nullptr, 10));
+        }
+        else if (arg.rfind("--ticks=", 0) == 0) {
+            config.ticks = static_cast<uint32_t>(std::strtoul(arg.c_str() + 8, nullptr, 10));
+        }
+        else if (arg.rfind("--pattern=", 0) == 0) {
+            std::string name = arg.substr(10);
+            if (name == "random")          config.pattern = MotionPattern::Random;
+            else if (name == "formation")  config.pattern = MotionPattern::Formation;
+            else if (name == "projectile") config.pattern = MotionPattern::Projectile;
+            else if (name == "mixed")      config.pattern = MotionPattern::Mixed;
+            else {
+                std::fprintf(stderr, "不明なパターン: %s\n", name.c_str());
+                return false;
+            }
+        }
+        else if (arg.rfind("--seed=", 0) == 0) {
+            config.seed = std::strtoull(arg.c_str() + 7, nullptr, 10);
+        }
+        else if (arg.rfind("--cell-size=", 0) == 0) {
+            config.cellSize = std::atoi(arg.c_str() + 12);
+        }
+        else if (arg.rfind("--world=", 0) == 0) {
+            config.worldSize = static_cast<float>(std::atof(arg.c_str() + 8));
+        }
+        else if (arg == "--callbacks") {
+            config.callbacks = true;
+        }
+        else if (arg.rfind("--expect-hash=", 0) == 0) {
+            config.checkHash = true;
+            config.expectedHash = std::strtoull(arg.c_str() + 14, nullptr, 16);
+        }
+        else {
+            std::fprintf(stderr, "不明な引数: %s\n", arg.c_str());
+            return false;
+        }
+    }
+
+    if (config.count == 0 || config.count >= CollisionConstants::kInvalidIndex) {
+        std::fprintf(stderr, "--count は 1〜%u の範囲で指定してください\n",
+                     static_cast<unsigned>(CollisionConstants::kInvalidIndex - 1));
+        return false;
+    }
+    if (config.worldSize <= 0.0f) {
+        std::fprintf(stderr, "--world は正の値で指定してください\n");
+        return false;
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------
+// シーン（SoA）
+//----------------------------------------------------------------------------
+
+//! エージェント種別
+enum class AgentKind : uint8_t
+{
+    Walker,     //!< ランダムウォーク
+    Member,     //!< 陣形メンバー
+    Projectile  //!< 直進弾
+};
+
+constexpr float kDt = CollisionManager::GetFixedDeltaTime();
+constexpr float kTwoPi = 6.28318530718f;
+constexpr float kWalkerSize = 32.0f;            //!< Individual相当のサイズ
+constexpr float kWalkerMaxSpeed = 120.0f;
+constexpr float kWalkerAccel = 400.0f;
+constexpr float kProjectileSize = 8.0f;         //!< Arrow相当のサイズ
+constexpr float kProjectileSpeed = 600.0f;
+constexpr uint32_t kFormationSize = 12;         //!< 1陣形あたりの人数
+constexpr float kFormationSpacing = 40.0f;
+constexpr float kFormationSpeed = 80.0f;
+constexpr float kFormationFollow = 0.2f;        //!< スロットへの追従率（ステップあたり）
+
+//! 陣形クラスタ
+struct Cluster
+{
+    float centerX = 0.0f;
+    float centerY = 0.0f;
+    float targetX = 0.0f;
+    float targetY = 0.0f;
+};
+
+//! ベンチマーク用シーン
+class BenchScene
+{
+public:
+    explicit BenchScene(const BenchConfig& config) : config_(config), random_(config.seed) {}
+
+    //! コライダーを生成して登録
+    void Spawn()
+    {
+        auto& mgr = CollisionManager::Get();
+        const uint32_t n = config_.count;
+
+        kind_.resize(n);
+        posX_.resize(n);
+        posY_.resize(n);
+        velX_.resize(n);
+        velY_.resize(n);
+        cluster_.assign(n, 0);
+        slotX_.assign(n, 0.0f);
+        slotY_.assign(n, 0.0f);
+
+        for (uint32_t i = 0; i < n; ++i) {
+            kind_[i] = ChooseKind(i);
+        }
+
+        // 陣形メンバーを kFormationSize 人ずつクラスタにまとめる
+        uint32_t memberCount = 0;
+        for (uint32_t i = 0; i < n; ++i) {
+            if (kind_[i] != AgentKind::Member) continue;
+            uint32_t clusterIndex = memberCount / kFormationSize;
+            if (clusterIndex >= clusters_.size()) {
+                Cluster c;
+                c.centerX = random_.Range(0.0f, config_.worldSize);
+                c.centerY = random_.Range(0.0f, config_.worldSize);
+                c.targetX = random_.Range(0.0f, config_.worldSize);
+                c.targetY = random_.Range(0.0f, config_.worldSize);
+                clusters_.push_back(c);
+            }
+            cluster_[i] = clusterIndex;
+            ++memberCount;
+        }
+        AssignSlots();
+
+        colliders_.reserve(n);
+        handles_.reserve(n);
+        for (uint32_t i = 0; i < n; ++i) {
+            switch (kind_[i]) {
+            case AgentKind::Walker:
+                posX_[i] = random_.Range(0.0f, config_.worldSize);
+                posY_[i] = random_.Range(0.0f, config_.worldSize);
+                velX_[i] = random_.Range(-kWalkerMaxSpeed, kWalkerMaxSpeed);
+                velY_[i] = random_.Range(-kWalkerMaxSpeed, kWalkerMaxSpeed);
+                break;
+            case AgentKind::Member: {
+                const Cluster& c = clusters_[cluster_[i]];
+                posX_[i] = c.centerX + slotX_[i];
+                posY_[i] = c.centerY + slotY_[i];
+                velX_[i] = 0.0f;
+                velY_[i] = 0.0f;
+                break;
+            }
+            case AgentKind::Projectile:
+                posX_[i] = random_.Range(0.0f, config_.worldSize);
+                posY_[i] = random_.Range(0.0f, config_.worldSize);
+                LaunchProjectile(i, false);
+                break;
+            }
+
+            auto collider = std::make_unique<Collider2D>();
+            ColliderHandle handle = mgr.Register(collider.get());
+            if (kind_[i] == AgentKind::Projectile) {
+                mgr.SetSize(handle, kProjectileSize, kProjectileSize);
+                mgr.SetLayer(handle, static_cast<uint8_t>(CollisionLayer::Arrow));
+                mgr.SetMask(handle, static_cast<uint8_t>(CollisionLayer::ArrowMask));
+                mgr.SetTrigger(handle, true);
+            } else {
+                mgr.SetSize(handle, kWalkerSize, kWalkerSize);
+                mgr.SetLayer(handle, static_cast<uint8_t>(CollisionLayer::Individual));
+                mgr.SetMask(handle, static_cast<uint8_t>(CollisionLayer::IndividualMask));
+            }
+            mgr.SetPosition(handle, posX_[i], posY_[i]);
+
+            colliders_.push_back(std::move(collider));
+            handles_.push_back(handle);
+        }
+    }
+
+    //! 全コライダーにカウント用コールバックを登録
+    void RegisterCallbacks(uint64_t& counter)
+    {
+        auto& mgr = CollisionManager::Get();
+        auto count = [&counter](Collider2D*, Collider2D*) { ++counter; };
+        for (ColliderHandle handle : handles_) {
+            mgr.SetOnCollisionEnter(handle, count);
+            mgr.SetOnCollision(handle, count);
+            mgr.SetOnCollisionExit(handle, count);
+        }
+    }
+
+    //! 1ステップ分移動し、CollisionManagerへ位置を反映
+    void Step()
+    {
+        for (Cluster& c : clusters_) {
+            StepCluster(c);
+        }
+
+        const uint32_t n = config_.count;
+        for (uint32_t i = 0; i < n; ++i) {
+            switch (kind_[i]) {
+            case AgentKind::Walker:     StepWalker(i);     break;
+            case AgentKind::Member:     StepMember(i);     break;
+            case AgentKind::Projectile: StepProjectile(i); break;
+            }
+        }
+
+        auto& mgr = CollisionManager::Get();
+        for (uint32_t i = 0; i < n; ++i) {
+            mgr.SetPosition(handles_[i], posX_[i], posY_[i]);
+        }
+    }
+
+private:
+    AgentKind ChooseKind(uint32_t i) const
+    {
+        switch (config_.pattern) {
+        case MotionPattern::Random:     return AgentKind::Walker;
+        case MotionPattern::Formation:  return AgentKind::Member;
+        case MotionPattern::Projectile: return (i % 4 == 0) ? AgentKind::Walker : AgentKind::Projectile;
+        case MotionPattern::Mixed:
+            if (i < config_.count / 3)         return AgentKind::Member;
+            if (i < config_.count * 2 / 3)     return AgentKind::Walker;
+            return AgentKind::Projectile;
+        }
+        return AgentKind::Walker;
+    }
+
+    //! 円形陣形のスロットオフセットを割り当て（Formation::CalculateCircleOffset相当）
+    void AssignSlots()
+    {
+        std::vector<uint32_t> clusterCounts(clusters_.size(), 0);
+        for (uint32_t i = 0; i < config_.count; ++i) {
+            if (kind_[i] == AgentKind::Member) ++clusterCounts[cluster_[i]];
+        }
+
+        std::vector<uint32_t> slotIndex(clusters_.size(), 0);
+        for (uint32_t i = 0; i < config_.count; ++i) {
+            if (kind_[i] != AgentKind::Member) continue;
+            uint32_t c = cluster_[i];
+            float total = static_cast<float>(clusterCounts[c]);
+            float radius = kFormationSpacing * total / kTwoPi;
+            if (radius < kFormationSpacing) radius = kFormationSpacing;
+            float angle = kTwoPi * static_cast<float>(slotIndex[c]++) / total;
+            slotX_[i] = std::cos(angle) * radius;
+            slotY_[i] = std::sin(angle) * radius;
+        }
+    }
+
+    void StepCluster(Cluster& c)
+    {
+        float dx = c.targetX - c.centerX;
+        float dy = c.targetY - c.centerY;
+        float dist = std::sqrt(dx * dx + dy * dy);
+        float step = kFormationSpeed * kDt;
+        if (dist <= step) {
+            c.centerX = c.targetX;
+            c.centerY = c.targetY;
+            c.targetX = random_.Range(0.0f, config_.worldSize);
+            c.targetY = random_.Range(0.0f, config_.worldSize);
+        } else {
+            c.centerX += dx / dist * step;
+            c.centerY += dy / dist * step;
+        }
+    }
+
+    void StepWalker(uint32_t i)
+    {
+        velX_[i] += random_.Range(-kWalkerAccel, kWalkerAccel) * kDt;
+        velY_[i] += random_.Range(-kWalkerAccel, kWalkerAccel) * kDt;
+        velX_[i] = std::clamp(velX_[i], -kWalkerMaxSpeed, kWalkerMaxSpeed);
+        velY_[i] = std::clamp(velY_[i], -kWalkerMaxSpeed, kWalkerMaxSpeed);
+
+        posX_[i] += velX_[i] * kDt;
+        posY_[i] += velY_[i] * kDt;
+
+        // 壁で反射
+        if (posX_[i] < 0.0f || posX_[i] > config_.worldSize) {
+            velX_[i] = -velX_[i];
+            posX_[i] = std::clamp(posX_[i], 0.0f, config_.worldSize);
+        }
+        if (posY_[i] < 0.0f || posY_[i] > config_.worldSize) {
+            velY_[i] = -velY_[i];
+            posY_[i] = std::clamp(posY_[i], 0.0f, config_.worldSize);
+        }
+    }
+
+    void StepMember(uint32_t i)
+    {
+        const Cluster& c = clusters_[cluster_[i]];
+        float goalX = c.centerX + slotX_[i];
+        float goalY = c.centerY + slotY_[i];
+        posX_[i] += (goalX - posX_[i]) * kFormationFollow + random_.Range(-1.0f, 1.0f);
+        posY_[i] += (goalY - posY_[i]) * kFormationFollow + random_.Range(-1.0f, 1.0f);
+    }
+
+    void StepProjectile(uint32_t i)
+    {
+        posX_[i] += velX_[i] * kDt;
+        posY_[i] += velY_[i] * kDt;
+
+        if (posX_[i] < 0.0f || posX_[i] > config_.worldSize ||
+            posY_[i] < 0.0f || posY_[i] > config_.worldSize) {
+            LaunchProjectile(i, true);
+        }
+    }
+
+    //! 弾を発射（fromEdge=trueなら外周のランダムな点からワールド内側へ）
+    void LaunchProjectile(uint32_t i, bool fromEdge)
+    {
+        if (fromEdge) {
+            float t = random_.Range(0.0f, config_.worldSize);
+            switch (random_.Next() % 4) {
+            case 0: posX_[i] = 0.0f;               posY_[i] = t; break;
+            case 1: posX_[i] = config_.worldSize;  posY_[i] = t; break;
+            case 2: posX_[i] = t; posY_[i] = 0.0f;              break;
+            default: posX_[i] = t; posY_[i] = config_.worldSize; break;
+            }
+        }
+
+        // ワールド中心付近を狙う
+        float half = config_.worldSize * 0.5f;
+        float aimX = half + random_.Range(-half * 0.5f, half * 0.5f);
+        float aimY = half + random_.Range(-half * 0.5f, half * 0.5f);
+        float dx = aimX - posX_[i];
+        float dy = aimY - posY_[i];
+        float len = std::sqrt(dx * dx + dy * dy);
+        if (len < 1.0f) {
+            dx = 1.0f;
+            dy = 0.0f;
+            len = 1.0f;
+        }
+        velX_[i] = dx / len * kProjectileSpeed;
+        velY_[i] = dy / len * kProjectileSpeed;
+    }
+
+    const BenchConfig& config_;
+    Random random_;
+
+    std::vector<AgentKind> kind_;
+    std::vector<float> posX_, posY_;
+    std::vector<float> velX_, velY_;
+    std::vector<uint32_t> cluster_;
+    std::vector<float> slotX_, slotY_;
+    std::vector<Cluster> clusters_;
+
+    std::vector<std::unique_ptr<Collider2D>> colliders_;
+    std::vector<ColliderHandle> handles_;
+};
+
+} // namespace
+
+//----------------------------------------------------------------------------
+// メインエントリーポイント
+//----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+#ifdef _WIN32
+    // コンソール出力をUTF-8に設定
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    BenchConfig config;
+    if (!ParseCommandLine(argc, argv, config)) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    CollisionManager::Create();
+    CollisionManager::Get().Initialize(config.cellSize);
+
+    uint64_t callbackCount = 0;
+    {
+        BenchScene scene(config);
+        scene.Spawn();
+        if (config.callbacks) {
+            scene.RegisterCallbacks(callbackCount);
+        }
+
+        std::vector<double> tickMs;
+        tickMs.reserve(config.ticks);
+        EventCounts eventCounts;
+        uint64_t pairTotal = 0;
+        size_t pairMax = 0;
+        uint64_t hash = CollisionBench::kHashSeed;
+
+        auto& mgr = CollisionManager::Get();
+        for (uint32_t tick = 0; tick < config.ticks; ++tick) {
+            scene.Step();
+
+            // 1回のUpdate()でちょうど1固定ステップ進める
+            auto begin = std::chrono::steady_clock::now();
+            mgr.Update(kDt);
+            auto end = std::chrono::steady_clock::now();
+            tickMs.push_back(std::chrono::duration<double, std::milli>(end - begin).count());
+
+            eventCounts.Add(mgr);
+
+            // Stay = 現ステップで重なっているペア数
+            size_t stay = mgr.GetEvents(CollisionEventType::Stay).size();
+            pairTotal += stay;
+            pairMax = (std::max)(pairMax, stay);
+
+            CollisionBench::HashEvents(hash, tick, mgr);
+        }
+
+        double ticks = static_cast<double>((std::max)(config.ticks, 1u));
+
+        std::printf("=== CollisionManager ベンチマーク ===\n");
+        std::printf("パターン: %s  コライダー: %u  ステップ: %u  セル: %d  ワールド: %.0f  シード: %" PRIu64 "%s\n",
+                    GetPatternName(config.pattern), config.count, config.ticks,
+                    config.cellSize, config.worldSize, config.seed,
+                    config.callbacks ? "  (コールバックあり)" : "");
+        double totalMs = CollisionBench::PrintStepTimes(tickMs);
+        std::printf("ペア数            平均: %.1f  最大: %zu\n",
+                    static_cast<double>(pairTotal) / ticks, pairMax);
+        CollisionBench::PrintEventCounts(eventCounts, totalMs);
+        if (config.callbacks) {
+            std::printf("コールバック      %" PRIu64 " 回\n", callbackCount);
+        }
+        std::printf("イベントハッシュ  %016" PRIx64 "\n", hash);
+
+        CollisionManager::Get().Shutdown();
+        CollisionManager::Destroy();
+
+        if (config.checkHash && !CollisionBench::CheckHash(hash, config.expectedHash)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,161 @@
+//----------------------------------------------------------------------------
+//! @file   collision_bench_common.h
+//! @brief  衝突判定ベンチマーク共通部（2D/3D）
+//!
+//! @details
+//! collision_bench と collision3d_bench で共有する乱数・ハッシュ・集計処理。
+//! 両マネージャーは CollisionWorld を基底に持つため、イベントストリームの
+//! ハッシュとEnter/Stay/Exitの集計は同じテンプレートで扱える。
+//----------------------------------------------------------------------------
+#pragma once
+
+#include "engine/c_systems/collision_world.h"
+#include "common/utility/hash.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace CollisionBench {
+
+//----------------------------------------------------------------------------
+// 乱数（プラットフォーム非依存・決定的）
+//----------------------------------------------------------------------------
+
+//! xorshift64* 乱数
+//! @note std::uniform_real_distributionは実装依存のため使用しない
+class Random
+{
+public:
+    explicit Random(uint64_t seed) : state_(seed ? seed : 0x9E3779B97F4A7C15ULL) {}
+
+    uint64_t Next() noexcept
+    {
+        state_ ^= state_ >> 12;
+        state_ ^= state_ << 25;
+        state_ ^= state_ >> 27;
+        return state_ * 2685821657736338717ULL;
+    }
+
+    //! [0, 1) の一様乱数
+    float NextFloat() noexcept
+    {
+        return static_cast<float>(Next() >> 40) * (1.0f / 16777216.0f);
+    }
+
+    //! [minValue, maxValue) の一様乱数
+    float Range(float minValue, float maxValue) noexcept
+    {
+        return minValue + (maxValue - minValue) * NextFloat();
+    }
+
+private:
+    uint64_t state_;
+};
+
+//----------------------------------------------------------------------------
+// ハッシュ
+//----------------------------------------------------------------------------
+
+//! FNV-1aの初期値
+constexpr uint64_t kHashSeed = 14695981039346656037ULL;
+
+//! 値をハッシュに追加
+inline void HashValue(uint64_t& hash, uint32_t value)
+{
+    hash = HashUtil::Fnv1a(&value, sizeof(value), hash);
+}
+
+//! 1ステップ分のイベントストリームをハッシュに追加
+template<typename World>
+void HashEvents(uint64_t& hash, uint32_t tick, const World& world)
+{
+    HashValue(hash, tick);
+
+    const CollisionEventType types[] = {
+        CollisionEventType::Enter, CollisionEventType::Stay, CollisionEventType::Exit
+    };
+    for (CollisionEventType type : types) {
+        auto events = world.GetEvents(type);
+        HashValue(hash, static_cast<uint32_t>(type));
+        HashValue(hash, static_cast<uint32_t>(events.size()));
+        for (const auto& e : events) {
+            HashValue(hash, (static_cast<uint32_t>(e.a.index) << 16) | e.b.index);
+            HashValue(hash, e.GetLayerPairKey());
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+// 集計
+//----------------------------------------------------------------------------
+
+//! Enter/Stay/Exitの累計
+struct EventCounts
+{
+    uint64_t enter = 0;
+    uint64_t stay = 0;
+    uint64_t exit = 0;
+
+    //! 直近のUpdate()分を加算
+    template<typename World>
+    void Add(const World& world)
+    {
+        enter += world.GetEvents(CollisionEventType::Enter).size();
+        stay += world.GetEvents(CollisionEventType::Stay).size();
+        exit += world.GetEvents(CollisionEventType::Exit).size();
+    }
+
+    [[nodiscard]] uint64_t Total() const noexcept { return enter + stay + exit; }
+};
+
+//! 昇順ソート済み配列からパーセンタイル値を取得（最近傍順位法）
+inline double Percentile(const std::vector<double>& sorted, double p)
+{
+    if (sorted.empty()) return 0.0;
+    size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * static_cast<double>(sorted.size())));
+    if (rank == 0) rank = 1;
+    return sorted[(std::min)(rank, sorted.size()) - 1];
+}
+
+//! ステップ時間のパーセンタイルを出力
+//! @return 合計時間 [ms]
+inline double PrintStepTimes(const std::vector<double>& tickMs)
+{
+    double totalMs = 0.0;
+    for (double ms : tickMs) totalMs += ms;
+    std::vector<double> sorted = tickMs;
+    std::sort(sorted.begin(), sorted.end());
+    double ticks = static_cast<double>((std::max)(tickMs.size(), size_t(1)));
+
+    std::printf("ステップ時間 [ms]  p50: %.4f  p90: %.4f  p99: %.4f  最大: %.4f  平均: %.4f\n",
+                Percentile(sorted, 50.0), Percentile(sorted, 90.0), Percentile(sorted, 99.0),
+                sorted.empty() ? 0.0 : sorted.back(), totalMs / ticks);
+    return totalMs;
+}
+
+//! イベント数と処理レートを出力
+inline void PrintEventCounts(const EventCounts& counts, double totalMs)
+{
+    double eventsPerSec = totalMs > 0.0 ? static_cast<double>(counts.Total()) / (totalMs / 1000.0) : 0.0;
+    std::printf("イベント          Enter: %" PRIu64 "  Stay: %" PRIu64 "  Exit: %" PRIu64
+                "  合計: %" PRIu64 "  (%.0f events/s)\n",
+                counts.enter, counts.stay, counts.exit, counts.Total(), eventsPerSec);
+}
+
+//! 期待ハッシュとの照合結果を出力
+//! @return 一致すればtrue
+inline bool CheckHash(uint64_t hash, uint64_t expected)
+{
+    if (hash != expected) {
+        std::printf("[失敗] ハッシュ不一致（期待値: %016" PRIx64 "）\n", expected);
+        return false;
+    }
+    std::printf("[成功] ハッシュ一致\n");
+    return true;
+}
+
+} // namespace CollisionBench
@@ -0,0 +1,366 @@
+//----------------------------------------------------------------------------
+//! @file   event_channel_bench.cpp
+//! @brief  EventChannel 全ワーカー同時投入テスト・決定性検証
+//!
+//! @details
+//! 全ワーカースレッドからEventChannelへイベントを大量にPushし、
+//! メインスレッドでEventBus経由（Flush→Dispatch）に配信する。
+//! 作業単位はワーカー間で動的に奪い合うため、スレッドの割り当ては毎回変わる。
+//! 配信されたイベント列のハッシュを単一スレッド実行の結果と照合し、
+//! スケジューリングに依存せず同じ順序で届くことを確認する。
+//!
+//! 検証項目:
+//! - 件数: Pushした全イベントが欠落・重複なく届く
+//! - 順序: シーケンス番号（作業単位）の昇順、同一作業単位内はPush順
+//! - 決定性: 単一スレッド実行とハッシュが一致
+//!
+//! コマンドライン引数:
+//!   --help               ヘルプ表示
+//!   --workers=<N>        ワーカースレッド数（既定: 論理コア数）
+//!   --items=<N>          1フレームの作業単位数（既定: 20000）
+//!   --max-events=<K>     1作業単位あたりの最大イベント数（既定: 8）
+//!   --frames=<F>         フレーム数（既定: 60）
+//!   --expect-hash=<16進> 期待するイベントハッシュ（不一致なら終了コード1）
+//----------------------------------------------------------------------------
+#include "engine/event/event_channel.h"
+#include "common/utility/hash.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace {
+
+//----------------------------------------------------------------------------
+// 設定
+//----------------------------------------------------------------------------
+
+//! ベンチマーク設定
+struct BenchConfig
+{
+    uint32_t workers = 0;           //!< ワーカースレッド数（0なら論理コア数）
+    uint32_t items = 20000;         //!< 1フレームの作業単位数
+    uint32_t maxEvents = 8;         //!< 1作業単位あたりの最大イベント数
+    uint32_t frames = 60;           //!< フレーム数
+    bool checkHash = false;         //!< ハッシュを検証するか
+    uint64_t expectedHash = 0;      //!< 期待するハッシュ
+};
+
+//! 使用方法を表示
+void PrintUsage(const char* programName)
+{
+    std::printf("使用方法: %s [オプション]\n"
+                "\nオプション:\n"
+                "  --help               このヘルプを表示\n"
+                "  --workers=<N>        ワーカースレッド数（既定: 論理コア数）\n"
+                "  --items=<N>          1フレームの作業単位数（既定: 20000）\n"
+                "  --max-events=<K>     1作業単位あたりの最大イベント数（既定: 8）\n"
+                "  --frames=<F>         フレーム数（既定: 60）\n"
+                "  --expect-hash=<16進> 期待するイベントハッシュ\n",
+                programName);
+}
+
+//! コマンドライン引数を解析
+//! @return 成功したらtrue
+bool ParseCommandLine(int argc, char* argv[], BenchConfig& config)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+
+        if (arg == "--help") {
+            PrintUsage(argv[0]);
+            std::exit(0);
+        }
+        else if (arg.rfind("--workers=", 0) == 0) {
+            config.workers = static_cast<uint32_t>(std::strtoul(arg.c_str() + 10, nullptr, 10));
+        }
+        else if (arg.rfind("--items=", 0) == 0) {
+            config.items = static_cast<uint32_t>(std::strtoul(arg.c_str() + 8, nullptr, 10));
+        }
+        else if (arg.rfind("--max-events=", 0) == 0) {
+            config.maxEvents = static_cast<uint32_t>(std::strtoul(arg.c_str() + 13, nullptr, 10));
+        }
+        else if (arg.rfind("--frames=", 0) == 0) {
+            config.frames = static_cast<uint32_t>(std::strtoul(arg.c_str() + 9, nullptr, 10));
+        }
+        else if (arg.rfind("--expect-hash=", 0) == 0) {
+            config.checkHash = true;
+            config.expectedHash = std::strtoull(arg.c_str() + 14, nullptr, 16);
+        }
+        else {
+            std::fprintf(stderr, "不明な引数: %s\n", arg.c_str());
+            return false;
+        }
+    }
+
+    if (config.workers == 0) {
+        config.workers = (std::max)(1u, std::thread::hardware_concurrency());
+    }
+    // メインスレッド分のスロットを残す
+    if (config.workers >= EventChannelThreadSlot::kMaxProducerThreads) {
+        std::fprintf(stderr, "--workers は 1〜%u の範囲で指定してください\n",
+                     EventChannelThreadSlot::kMaxProducerThreads - 1);
+        return false;
+    }
+    if (config.items == 0 || config.maxEvents == 0) {
+        std::fprintf(stderr, "--items と --max-events は1以上で指定してください\n");
+        return false;
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------
+// イベント
+//----------------------------------------------------------------------------
+
+//! 投入するイベント
+struct FloodEvent
+{
+    uint32_t frame;     //!< フレーム番号
+    uint32_t item;      //!< 作業単位番号
+    uint32_t index;     //!< 作業単位内の通し番号
+    uint32_t payload;   //!< 作業単位から決定的に求めた値
+};
+
+//! 整数ハッシュ（作業単位ごとのイベント数・値の決定用）
+uint32_t MixBits(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
+}
+
+//! 作業単位を処理してイベントをPush（ワーカー上で実行）
+void ProcessItem(EventChannel<FloodEvent>& channel, const BenchConfig& config,
+                 uint32_t frame, uint32_t item)
+{
+    uint32_t seed = MixBits(frame * 0x9E3779B9u ^ item);
+    uint32_t count = 1 + seed % config.maxEvents;
+    for (uint32_t i = 0; i < count; ++i) {
+        channel.Push(item, FloodEvent{ frame, item, i, MixBits(seed + i) });
+    }
+}
+
+//----------------------------------------------------------------------------
+// ワーカープール
+//----------------------------------------------------------------------------
+
+//! 作業単位を動的に奪い合うワーカープール（JobSystem::ParallelFor相当）
+//! @note 割り当てが毎回変わるよう、小さなチャンクで取り合う
+class FloodPool
+{
+public:
+    FloodPool(EventChannel<FloodEvent>& channel, const BenchConfig& config, uint32_t workers)
+        : channel_(channel), config_(config)
+    {
+        for (uint32_t i = 0; i < workers; ++i) {
+            threads_.emplace_back([this] { WorkerLoop(); });
+        }
+    }
+
+    ~FloodPool()
+    {
+        quit_.store(true, std::memory_order_release);
+        generation_.fetch_add(1, std::memory_order_acq_rel);
+        generation_.notify_all();
+        for (std::thread& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    //! 1フレーム分を全ワーカーで処理し、完了まで待機
+    void RunFrame(uint32_t frame)
+    {
+        frame_ = frame;
+        nextItem_.store(0, std::memory_order_relaxed);
+        remaining_.store(static_cast<uint32_t>(threads_.size()), std::memory_order_relaxed);
+        generation_.fetch_add(1, std::memory_order_acq_rel);
+        generation_.notify_all();
+
+        // 全ワーカーの完了待ち（ここが同期点）
+        uint32_t left = remaining_.load(std::memory_order_acquire);
+        while (left != 0) {
+            remaining_.wait(left, std::memory_order_acquire);
+            left = remaining_.load(std::memory_order_acquire);
+        }
+    }
+
+private:
+    static constexpr uint32_t kChunk = 16;
+
+    void WorkerLoop()
+    {
+        uint32_t seen = 0;
+        for (;;) {
+            generation_.wait(seen, std::memory_order_acquire);
+            seen = generation_.load(std::memory_order_acquire);
+            if (quit_.load(std::memory_order_acquire)) return;
+
+            for (;;) {
+                uint32_t begin = nextItem_.fetch_add(kChunk, std::memory_order_relaxed);
+                if (begin >= config_.items) break;
+                uint32_t end = (std::min)(begin + kChunk, config_.items);
+                for (uint32_t item = begin; item < end; ++item) {
+                    ProcessItem(channel_, config_, frame_, item);
+                }
+            }
+
+            if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                remaining_.notify_one();
+            }
+        }
+    }
+
+    EventChannel<FloodEvent>& channel_;
+    const BenchConfig& config_;
+    std::vector<std::thread> threads_;
+    uint32_t frame_ = 0;
+    std::atomic<uint32_t> nextItem_{ 0 };
+    std::atomic<uint32_t> remaining_{ 0 };
+    std::atomic<uint32_t> generation_{ 0 };
+    std::atomic<bool> quit_{ false };
+};
+
+//----------------------------------------------------------------------------
+// 検証
+//----------------------------------------------------------------------------
+
+//! 配信結果の集計・検証
+struct FloodResult
+{
+    uint64_t hash = 14695981039346656037ULL;  //!< 配信順のハッシュ
+    uint64_t delivered = 0;                   //!< 配信されたイベント数
+    uint64_t expected = 0;                    //!< Pushしたイベント数
+    uint64_t orderErrors = 0;                 //!< 順序違反の数
+    double pushMs = 0.0;                      //!< 投入時間の合計
+    double drainMs = 0.0;                     //!< Flush+Dispatch時間の合計
+};
+
+//! 指定ワーカー数で全フレームを実行
+FloodResult RunFlood(const BenchConfig& config, uint32_t workers)
+{
+    FloodResult result;
+    EventChannel<FloodEvent> channel;
+
+    // 前回の配信位置（順序検証用）
+    uint32_t lastItem = 0;
+    uint32_t nextIndex = 0;
+    bool first = true;
+
+    EventBus& bus = EventBus::Get();
+    uint32_t subscriptionId = bus.SubscribeBatch<FloodEvent>(
+        [&](std::span<const FloodEvent> events) {
+            for (const FloodEvent& e : events) {
+                bool sameItem = !first && e.item == lastItem;
+                bool ordered = sameItem ? e.index == nextIndex
+                                        : (first || e.item > lastItem) && e.index == 0;
+                if (!ordered) ++result.orderErrors;
+                lastItem = e.item;
+                nextIndex = e.index + 1;
+                first = false;
+                result.hash = HashUtil::Fnv1a(&e, sizeof(e), result.hash);
+            }
+            result.delivered += events.size();
+        });
+
+    {
+        FloodPool pool(channel, config, workers);
+        for (uint32_t frame = 0; frame < config.frames; ++frame) {
+            auto begin = std::chrono::steady_clock::now();
+            pool.RunFrame(frame);
+            auto pushed = std::chrono::steady_clock::now();
+
+            result.expected += channel.GetPendingCount();
+            first = true;
+            channel.Flush(bus, EventPhase::EndOfFrame);
+            bus.Dispatch(EventPhase::EndOfFrame);
+            auto drained = std::chrono::steady_clock::now();
+
+            result.pushMs += std::chrono::duration<double, std::milli>(pushed - begin).count();
+            result.drainMs += std::chrono::duration<double, std::milli>(drained - pushed).count();
+        }
+    }
+
+    bus.Unsubscribe<FloodEvent>(subscriptionId);
+    return result;
+}
+
+//! 結果を出力
+void PrintResult(const char* label, uint32_t workers, const FloodResult& result)
+{
+    double pushSec = result.pushMs / 1000.0;
+    std::printf("%-10s ワーカー: %2u  イベント: %" PRIu64 " / %" PRIu64
+                "  順序違反: %" PRIu64 "  投入: %.1f ms (%.1f M events/s)  配信: %.1f ms  ハッシュ: %016" PRIx64 "\n",
+                label, workers, result.delivered, result.expected, result.orderErrors,
+                result.pushMs, pushSec > 0.0 ? static_cast<double>(result.expected) / pushSec / 1.0e6 : 0.0,
+                result.drainMs, result.hash);
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
+// エントリポイント
+//----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+#ifdef _WIN32
+    // コンソール出力をUTF-8に設定
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    BenchConfig config;
+    if (!ParseCommandLine(argc, argv, config)) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    EventBus::Create();
+
+    std::printf("=== EventChannel 全ワーカー投入テスト ===\n");
+    std::printf("作業単位: %u  最大イベント/単位: %u  フレーム: %u\n",
+                config.items, config.maxEvents, config.frames);
+
+    FloodResult reference = RunFlood(config, 1);
+    PrintResult("単一", 1, reference);
+    FloodResult flood = RunFlood(config, config.workers);
+    PrintResult("全ワーカー", config.workers, flood);
+
+    EventBus::Destroy();
+
+    bool ok = true;
+    if (flood.delivered != flood.expected || reference.delivered != reference.expected) {
+        std::printf("[失敗] イベントの欠落または重複\n");
+        ok = false;
+    }
+    if (flood.orderErrors != 0 || reference.orderErrors != 0) {
+        std::printf("[失敗] 配信順序がシーケンス番号順ではない\n");
+        ok = false;
+    }
+    if (flood.hash != reference.hash) {
+        std::printf("[失敗] 単一スレッド実行とハッシュ不一致\n");
+        ok = false;
+    }
+    if (config.checkHash && flood.hash != config.expectedHash) {
+        std::printf("[失敗] ハッシュ不一致（期待値: %016" PRIx64 "）\n", config.expectedHash);
+        ok = false;
+    }
+    if (ok) {
+        std::printf("[成功] 全イベントがシーケンス番号順に決定的に配信された\n");
+    }
+    return ok ? 0 : 1;
+}